@@ -1,7 +1,12 @@
 #include "AssetPipeline.h"
 #include "AssetPackReader.h"
+#include "AssetPackWriter.h"
 #include "PipelineBuildConfig.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <expected>
+#include <fstream>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -16,19 +21,226 @@ void PrintUsage(const char* ProgramName)
             << "  build              Build all assets from scratch\n"
             << "  build-changed      Build only changed assets (incremental)\n"
             << "  inspect <pack>     Inspect a .snpak file\n"
+            << "  compact <pack>     Rewrite a pack without the data replaced by append-updates\n"
+            << "  merge <pack>...    Merge packs into the -o pack without recompressing (later packs win)\n"
             << "  list-plugins       List loaded plugins\n"
             << "  help               Show this help message\n\n"
             << "Options:\n"
             << "  -s, --source <dir>       Add source directory (can be used multiple times)\n"
             << "  -o, --output <file>      Output .snpak file path\n"
             << "  -p, --plugin <file>      Load plugin DLL/SO (can be used multiple times)\n"
-            << "  -c, --compression <mode> Compression mode: none, lz4, lz4hc, zstd, zstdfast (default: zstd)\n"
+            << "  -c, --compression <mode> Compression mode: none, lz4, lz4hc, zstd, zstdfast, auto (default: zstd)\n"
             << "  --compression-level <level> Compression level: fast, default, high, max (default: default)\n"
+            << "  --kind-compression <kind-uuid>=<mode>[:<level>]\n"
+            << "                           Compress the payload and bulk chunks of one asset kind with <mode>\n"
+            << "  --bulk-compression [<kind-uuid>/]<semantic>=<mode>[:<level>]\n"
+            << "                           Compress bulk chunks with <semantic> (unknown, level, aux, a number or *),\n"
+            << "                           optionally only for one asset kind. Later rules win over earlier ones\n"
+            << "                           of the same specificity; cooker-chosen overrides are kept\n"
+            << "  --train-dictionaries     Train a Zstd dictionary per asset kind for small zstd payloads\n"
+            << "  --solid-blocks <max-asset-size>[:<block-size>]\n"
+            << "                           Compress payloads of at most <max-asset-size> bytes together in shared\n"
+            << "                           blocks of about <block-size> bytes (default: 262144)\n"
+            << "  --layout-profile <file>  Lay chunks out in the load order recorded in <file> (one asset UUID\n"
+            << "                           per line, '#' starts a comment line); also applies to compact and merge\n"
+            << "  --compress-index         Store the pack index column-encoded and compressed; also applies to\n"
+            << "                           compact and merge\n"
+            << "  --compact-threshold <ratio>\n"
+            << "                           Only compact when at least <ratio> (0-1) of the pack is reclaimable;\n"
+            << "                           with build-changed, compact after appending once it is reached\n"
             << "  -v, --verbose            Enable verbose output\n"
             << "  --max-compression        Use maximum compression (slower)\n"
             << std::endl;
 }
 
+bool TryParseRatio(const std::string& Text, double& Out)
+{
+  char* End = nullptr;
+  const double Value = std::strtod(Text.c_str(), &End);
+  if (Text.empty() || *End != '\0' || !(Value >= 0.0 && Value <= 1.0))
+  {
+    return false;
+  }
+  Out = Value;
+  return true;
+}
+
+bool TryParseByteCount(const std::string& Text, uint32_t& Out)
+{
+  if (Text.empty() || Text.find_first_not_of("0123456789") != std::string::npos)
+  {
+    return false;
+  }
+  const unsigned long long Value = std::strtoull(Text.c_str(), nullptr, 10);
+  if (Value == 0 || Value > UINT32_MAX)
+  {
+    return false;
+  }
+  Out = static_cast<uint32_t>(Value);
+  return true;
+}
+
+std::expected<std::vector<AssetId>, std::string> ReadAccessOrderProfile(const std::string& Path)
+{
+  std::ifstream File(Path);
+  if (!File.is_open())
+  {
+    return std::unexpected("cannot open " + Path);
+  }
+
+  std::vector<AssetId> LoadOrder;
+  std::string Line;
+  for (size_t LineNumber = 1; std::getline(File, Line); ++LineNumber)
+  {
+    const size_t First = Line.find_first_not_of(" \t\r");
+    if (First == std::string::npos || Line[First] == '#')
+    {
+      continue;
+    }
+    const size_t Last = Line.find_last_not_of(" \t\r");
+    const AssetId Id = AssetId::FromString(Line.substr(First, Last - First + 1));
+    if (Id.IsNull())
+    {
+      return std::unexpected("invalid asset UUID on line " + std::to_string(LineNumber));
+    }
+    LoadOrder.push_back(Id);
+  }
+  return LoadOrder;
+}
+
+bool TryParseCompressionMode(const std::string& Mode, EPackCompression& Out)
+{
+  if (Mode == "none")
+  {
+    Out = EPackCompression::None;
+  }
+  else if (Mode == "lz4")
+  {
+    Out = EPackCompression::LZ4;
+  }
+  else if (Mode == "lz4hc")
+  {
+    Out = EPackCompression::LZ4HC;
+  }
+  else if (Mode == "zstd")
+  {
+    Out = EPackCompression::Zstd;
+  }
+  else if (Mode == "zstdfast")
+  {
+    Out = EPackCompression::ZstdFast;
+  }
+  else if (Mode == "auto")
+  {
+    Out = EPackCompression::Auto;
+  }
+  else
+  {
+    return false;
+  }
+  return true;
+}
+
+bool TryParseCompressionLevel(const std::string& Level, EPackCompressionLevel& Out)
+{
+  if (Level == "fast")
+  {
+    Out = EPackCompressionLevel::Fast;
+  }
+  else if (Level == "default")
+  {
+    Out = EPackCompressionLevel::Default;
+  }
+  else if (Level == "high")
+  {
+    Out = EPackCompressionLevel::High;
+  }
+  else if (Level == "max")
+  {
+    Out = EPackCompressionLevel::Max;
+  }
+  else
+  {
+    return false;
+  }
+  return true;
+}
+
+// Parse "<kind-uuid>=<mode>[:<level>]", or with bBulk "[<kind-uuid>/]<semantic>=<mode>[:<level>]"
+std::expected<PackCompressionRule, std::string> ParseCompressionRule(const std::string& Text, const bool bBulk)
+{
+  const size_t Equals = Text.find('=');
+  if (Equals == std::string::npos)
+  {
+    return std::unexpected("expected '=' between the selector and the compression mode");
+  }
+  std::string Selector = Text.substr(0, Equals);
+  std::string Mode = Text.substr(Equals + 1);
+
+  PackCompressionRule Rule;
+  if (const size_t Colon = Mode.find(':'); Colon != std::string::npos)
+  {
+    EPackCompressionLevel Level{};
+    if (!TryParseCompressionLevel(Mode.substr(Colon + 1), Level))
+    {
+      return std::unexpected("unknown compression level '" + Mode.substr(Colon + 1) + "'");
+    }
+    Rule.Level = Level;
+    Mode.resize(Colon);
+  }
+  if (!TryParseCompressionMode(Mode, Rule.Compression))
+  {
+    return std::unexpected("unknown compression mode '" + Mode + "'");
+  }
+
+  std::string Kind = Selector;
+  if (bBulk)
+  {
+    Rule.Scope = EPackCompressionScope::Bulk;
+    const size_t Slash = Selector.find('/');
+    std::string Semantic = Slash == std::string::npos ? Selector : Selector.substr(Slash + 1);
+    Kind = Slash == std::string::npos ? std::string() : Selector.substr(0, Slash);
+
+    if (Semantic == "unknown")
+    {
+      Rule.BulkSemantic = EBulkSemantic::Unknown;
+    }
+    else if (Semantic == "level")
+    {
+      Rule.BulkSemantic = EBulkSemantic::Reserved_Level;
+    }
+    else if (Semantic == "aux")
+    {
+      Rule.BulkSemantic = EBulkSemantic::Reserved_Aux;
+    }
+    else if (!Semantic.empty() && Semantic != "*")
+    {
+      char* End = nullptr;
+      const unsigned long Value = std::strtoul(Semantic.c_str(), &End, 0);
+      if (*End != '\0' || Value > UINT32_MAX)
+      {
+        return std::unexpected("unknown bulk semantic '" + Semantic + "'");
+      }
+      Rule.BulkSemantic = static_cast<EBulkSemantic>(Value);
+    }
+  }
+
+  if (!Kind.empty())
+  {
+    const TypeId KindId = TypeId::FromString(Kind);
+    if (KindId.IsNull())
+    {
+      return std::unexpected("invalid asset kind UUID '" + Kind + "'");
+    }
+    Rule.AssetKind = KindId;
+  }
+  else if (!bBulk)
+  {
+    return std::unexpected("missing asset kind UUID");
+  }
+  return Rule;
+}
+
 void CommandInspect(const std::string& PackPath)
 {
   AssetPackReader Reader;
@@ -41,7 +253,8 @@ void CommandInspect(const std::string& PackPath)
   }
 
   std::cout << "Pack: " << PackPath << "\n"
-            << "Assets: " << Reader.GetAssetCount() << "\n\n";
+            << "Assets: " << Reader.GetAssetCount() << "\n"
+            << "Index: " << (Reader.IsIndexCompressed() ? "compressed" : "uncompressed") << "\n\n";
 
   for (uint32_t i = 0; i < Reader.GetAssetCount(); ++i)
   {
@@ -66,6 +279,48 @@ void CommandInspect(const std::string& PackPath)
   }
 }
 
+void CommandCompact(const std::string& PackPath, double MinDeadRatio, const std::vector<AssetId>& LoadOrder, bool bCompressIndex)
+{
+  AssetPackWriter Writer;
+  Writer.SetAccessOrderProfile(LoadOrder);
+  Writer.SetCompressIndex(bCompressIndex);
+  auto Result = Writer.Compact(PackPath, MinDeadRatio);
+  if (!Result.has_value())
+  {
+    std::cerr << "Error: " << Result.error() << std::endl;
+    return;
+  }
+
+  const uint64_t Reclaimable = Result->SizeBefore - std::min(Result->SizeBefore, Result->SizeAfter);
+  if (!Result->bCompacted)
+  {
+    std::cout << "Pack: " << PackPath << "\n"
+              << "Not compacted: " << Reclaimable << " of " << Result->SizeBefore << " bytes reclaimable\n";
+    return;
+  }
+  std::cout << "Pack: " << PackPath << "\n"
+            << "Compacted: " << Result->SizeBefore << " -> " << Result->SizeAfter << " bytes (" << Result->ChunkCount
+            << " live chunks)\n";
+}
+
+void CommandMerge(const std::vector<std::string>& InputPaths, const std::string& OutputPath, const std::vector<AssetId>& LoadOrder,
+                  bool bCompressIndex)
+{
+  AssetPackWriter Writer;
+  Writer.SetAccessOrderProfile(LoadOrder);
+  Writer.SetCompressIndex(bCompressIndex);
+  auto Result = Writer.Merge(InputPaths, OutputPath);
+  if (!Result.has_value())
+  {
+    std::cerr << "Error: " << Result.error() << std::endl;
+    return;
+  }
+
+  std::cout << "Pack: " << OutputPath << "\n"
+            << "Merged " << InputPaths.size() << " packs: " << Result->AssetCount << " assets (" << Result->ReplacedAssetCount
+            << " replaced by later packs), " << Result->ChunkCount << " chunks, " << Result->FileSize << " bytes\n";
+}
+
 void CommandBuild(const PipelineBuildConfig& Config, bool bIncrementalOnly)
 {
   AssetPipelineEngine Engine;
@@ -94,6 +349,34 @@ void CommandBuild(const PipelineBuildConfig& Config, bool bIncrementalOnly)
             << "  Assets skipped: " << Result.AssetsSkipped << "\n"
             << "  Assets failed: " << Result.AssetsFailed << "\n";
 
+  if (!Result.CompressionStats.empty())
+  {
+    static constexpr const char* kCodecNames[] = {"none", "lz4", "lz4hc", "zstd", "zstdfast", "auto"};
+    std::cout << "\nCompression:\n";
+    for (const auto& Stats : Result.CompressionStats)
+    {
+      std::cout << "  " << kCodecNames[static_cast<size_t>(Stats.Compression)] << ": " << Stats.ChunkCount << " chunks";
+      if (Stats.AutoChunkCount > 0)
+      {
+        std::cout << " (" << Stats.AutoChunkCount << " auto)";
+      }
+      if (Stats.DictionaryChunkCount > 0)
+      {
+        std::cout << " (" << Stats.DictionaryChunkCount << " with dictionary)";
+      }
+      if (Stats.SolidPayloadCount > 0)
+      {
+        std::cout << " (" << Stats.SolidPayloadCount << " payloads in solid blocks)";
+      }
+      std::cout << ", " << Stats.UncompressedBytes << " -> " << Stats.StoredBytes << " bytes\n";
+    }
+  }
+
+  if (Result.CompactedBytes > 0)
+  {
+    std::cout << "\nCompacted pack: reclaimed " << Result.CompactedBytes << " bytes\n";
+  }
+
   if (!Result.Warnings.empty())
   {
     std::cout << "\nWarnings:\n";
@@ -166,6 +449,7 @@ int main(int argc, char* argv[])
 
   // Parse options
   PipelineBuildConfig Config;
+  std::vector<std::string> InputPacks;
 
   for (int i = 2; i < argc; ++i)
   {
@@ -186,27 +470,7 @@ int main(int argc, char* argv[])
     else if ((Arg == "-c" || Arg == "--compression") && i + 1 < argc)
     {
       std::string Mode = argv[++i];
-      if (Mode == "none")
-      {
-        Config.Compression = EPackCompression::None;
-      }
-      else if (Mode == "lz4")
-      {
-        Config.Compression = EPackCompression::LZ4;
-      }
-      else if (Mode == "lz4hc")
-      {
-        Config.Compression = EPackCompression::LZ4HC;
-      }
-      else if (Mode == "zstd")
-      {
-        Config.Compression = EPackCompression::Zstd;
-      }
-      else if (Mode == "zstdfast")
-      {
-        Config.Compression = EPackCompression::ZstdFast;
-      }
-      else
+      if (!TryParseCompressionMode(Mode, Config.Compression))
       {
         std::cerr << "Unknown compression mode: " << Mode << std::endl;
         return 1;
@@ -215,25 +479,59 @@ int main(int argc, char* argv[])
     else if (Arg == "--compression-level" && i + 1 < argc)
     {
       std::string Level = argv[++i];
-      if (Level == "fast")
+      if (!TryParseCompressionLevel(Level, Config.CompressionLevel))
       {
-        Config.CompressionLevel = EPackCompressionLevel::Fast;
+        std::cerr << "Unknown compression level: " << Level << std::endl;
+        return 1;
       }
-      else if (Level == "default")
+    }
+    else if ((Arg == "--kind-compression" || Arg == "--bulk-compression") && i + 1 < argc)
+    {
+      std::string Rule = argv[++i];
+      auto Parsed = ParseCompressionRule(Rule, Arg == "--bulk-compression");
+      if (!Parsed)
       {
-        Config.CompressionLevel = EPackCompressionLevel::Default;
+        std::cerr << "Invalid " << Arg << " rule '" << Rule << "': " << Parsed.error() << std::endl;
+        return 1;
       }
-      else if (Level == "high")
+      Config.CompressionPolicy.push_back(*Parsed);
+    }
+    else if (Arg == "--train-dictionaries")
+    {
+      Config.DictionaryTraining.bEnabled = true;
+    }
+    else if (Arg == "--compress-index")
+    {
+      Config.bCompressIndex = true;
+    }
+    else if (Arg == "--solid-blocks" && i + 1 < argc)
+    {
+      std::string Spec = argv[++i];
+      const size_t Colon = Spec.find(':');
+      if (!TryParseByteCount(Spec.substr(0, Colon), Config.SolidBlocks.MaxAssetSize) ||
+          (Colon != std::string::npos && !TryParseByteCount(Spec.substr(Colon + 1), Config.SolidBlocks.BlockSize)))
       {
-        Config.CompressionLevel = EPackCompressionLevel::High;
+        std::cerr << "Invalid --solid-blocks value: " << Spec << std::endl;
+        return 1;
       }
-      else if (Level == "max")
+    }
+    else if (Arg == "--layout-profile" && i + 1 < argc)
+    {
+      std::string ProfilePath = argv[++i];
+      auto LoadOrder = ReadAccessOrderProfile(ProfilePath);
+      if (!LoadOrder)
       {
-        Config.CompressionLevel = EPackCompressionLevel::Max;
+        std::cerr << "Invalid --layout-profile: " << LoadOrder.error() << std::endl;
+        return 1;
       }
-      else
+      Config.AccessOrderProfile = std::move(*LoadOrder);
+    }
+    else if (Arg == "--compact-threshold" && i + 1 < argc)
+    {
+      std::string Ratio = argv[++i];
+      if (!TryParseRatio(Ratio, Config.AutoCompactDeadRatio))
       {
-        std::cerr << "Unknown compression level: " << Level << std::endl;
+        std::cerr << "Invalid --compact-threshold value: " << Ratio << std::endl;
         return 1;
       }
     }
@@ -248,10 +546,14 @@ int main(int argc, char* argv[])
     else if (!Arg.empty() && Arg[0] != '-')
     {
       // Positional argument (e.g., pack path for inspect)
-      if (Command == "inspect" && Config.OutputPackPath.empty())
+      if ((Command == "inspect" || Command == "compact") && Config.OutputPackPath.empty())
       {
         Config.OutputPackPath = Arg;
       }
+      else if (Command == "merge")
+      {
+        InputPacks.push_back(Arg);
+      }
     }
     else
     {
@@ -298,6 +600,29 @@ int main(int argc, char* argv[])
     }
     CommandInspect(Config.OutputPackPath);
   }
+  else if (Command == "compact")
+  {
+    if (Config.OutputPackPath.empty())
+    {
+      std::cerr << "Error: Pack file path is required for compact\n";
+      return 1;
+    }
+    CommandCompact(Config.OutputPackPath, Config.AutoCompactDeadRatio, Config.AccessOrderProfile, Config.bCompressIndex);
+  }
+  else if (Command == "merge")
+  {
+    if (Config.OutputPackPath.empty())
+    {
+      std::cerr << "Error: Output path (-o) is required for merge\n";
+      return 1;
+    }
+    if (InputPacks.empty())
+    {
+      std::cerr << "Error: At least one input pack is required for merge\n";
+      return 1;
+    }
+    CommandMerge(InputPacks, Config.OutputPackPath, Config.AccessOrderProfile, Config.bCompressIndex);
+  }
   else if (Command == "list-plugins")
   {
     CommandListPlugins(Config);
@@ -128,11 +128,14 @@ endif()
 file(GLOB ZSTD_COMMON_SOURCES ${zstd_SOURCE_DIR}/lib/common/*.c)
 file(GLOB ZSTD_COMPRESS_SOURCES ${zstd_SOURCE_DIR}/lib/compress/*.c)
 file(GLOB ZSTD_DECOMPRESS_SOURCES ${zstd_SOURCE_DIR}/lib/decompress/*.c)
+# ZDICT_trainFromBuffer, used to train per-asset-kind pack dictionaries
+file(GLOB ZSTD_DICTBUILDER_SOURCES ${zstd_SOURCE_DIR}/lib/dictBuilder/*.c)
 
 add_library(libzstd_static STATIC
     ${ZSTD_COMMON_SOURCES}
     ${ZSTD_COMPRESS_SOURCES}
     ${ZSTD_DECOMPRESS_SOURCES}
+    ${ZSTD_DICTBUILDER_SOURCES}
 )
 target_include_directories(libzstd_static PUBLIC
     $<BUILD_INTERFACE:${zstd_SOURCE_DIR}/lib>
@@ -26,6 +26,7 @@
 #include <cstring>
 #include <cmath>
 #include <vector>
+#include <numeric>
 #include <atomic>
 #include <thread>
 #include <chrono>
@@ -46,8 +47,9 @@ struct GameTexture
     std::string Name;
     std::string Variant;
 
-    // Raw pixel data for deferred GL upload (populated by async load, consumed by Finalize)
-    std::vector<std::vector<uint8_t>> MipData;
+    // Mip pixels for deferred GL upload (populated by async load, consumed by Finalize). The views
+    // point straight into the pack mapping for uncompressed mips, so nothing is copied before upload.
+    std::vector<AssetDataView> MipData;
 
     ~GameTexture()
     {
@@ -75,7 +77,7 @@ struct GameTexture
         for (uint32_t Mip = 0; Mip < MipCount && Mip < MipData.size(); ++Mip)
         {
             glTexImage2D(GL_TEXTURE_2D, Mip, GL_RGBA8, MipWidth, MipHeight,
-                         0, GL_RGBA, GL_UNSIGNED_BYTE, MipData[Mip].data());
+                         0, GL_RGBA, GL_UNSIGNED_BYTE, MipData[Mip].GetData());
             MipWidth = std::max(1u, MipWidth / 2);
             MipHeight = std::max(1u, MipHeight / 2);
         }
@@ -90,7 +92,7 @@ struct GameTexture
 
         glBindTexture(GL_TEXTURE_2D, 0);
 
-        // Free the CPU-side data now that it's uploaded to GPU
+        // Release the CPU-side views (and the buffers or mapping they keep alive) now that it's uploaded to GPU
         MipData.clear();
         MipData.shrink_to_fit();
 
@@ -158,21 +160,22 @@ protected:
         Tex.Name = Ctx.Info.Name;
         Tex.Variant = Ctx.Info.VariantKey;
 
-        // Load each mip level from bulk chunks into CPU memory
+        // Load every mip level from bulk chunks into CPU memory in one batch: the mips are
+        // adjacent in the pack, so they are prefetched together and decoded in a single pass.
         // NOTE: No OpenGL calls here - this can run on any thread!
         // Call Tex.Finalize() from the main/GL thread to create the GPU texture.
-        Tex.MipData.reserve(Info.MipCount);
+        std::vector<uint32_t> Mips(Info.MipCount);
+        std::iota(Mips.begin(), Mips.end(), 0u);
 
-        for (uint32_t Mip = 0; Mip < Info.MipCount; ++Mip)
+        auto Pixels = Ctx.LoadBulkChunks(Mips);
+        if (!Pixels.has_value())
         {
-            auto Pixels = Ctx.LoadBulk(Mip);
-            if (!Pixels.has_value())
-            {
-                return std::unexpected("Failed to load mip " + std::to_string(Mip) + ": " + Pixels.error());
-            }
-            Tex.MipData.push_back(std::move(*Pixels));
+            return std::unexpected("Failed to load mips: " + Pixels.error());
         }
 
+        // Keep the views rather than copying the pixels; Finalize uploads straight from them
+        Tex.MipData = std::move(*Pixels);
+
         return Tex;
     }
 };
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "Export.h"
+#include "Uuid.h"
+
+namespace SnAPI::AssetPipeline
+{
+
+// Read-only bytes handed out by the pack view APIs.
+// The view shares ownership of whatever backs the bytes (the pack's memory mapping or a
+// decode buffer), so it stays valid after the reader that produced it is closed or destroyed.
+class SNAPI_ASSETPIPELINE_API AssetDataView
+{
+public:
+    AssetDataView() = default;
+
+    // Wrap Bytes, keeping Owner alive for as long as any copy of the view exists.
+    // bZeroCopy marks views that point straight at stored pack bytes.
+    AssetDataView(std::span<const uint8_t> Bytes, std::shared_ptr<const void> Owner, bool bZeroCopy = false)
+        : m_Bytes(Bytes)
+        , m_Owner(std::move(Owner))
+        , m_bZeroCopy(bZeroCopy)
+    {
+    }
+
+    // Take ownership of a decoded buffer
+    static AssetDataView FromVector(std::vector<uint8_t> Bytes)
+    {
+        auto Buffer = std::make_shared<const std::vector<uint8_t>>(std::move(Bytes));
+        const std::span<const uint8_t> Span(Buffer->data(), Buffer->size());
+        return AssetDataView(Span, std::move(Buffer), false);
+    }
+
+    const uint8_t* GetData() const { return m_Bytes.data(); }
+    size_t GetSize() const { return m_Bytes.size(); }
+    bool IsEmpty() const { return m_Bytes.empty(); }
+    std::span<const uint8_t> GetSpan() const { return m_Bytes; }
+
+    // True when the bytes live in the pack mapping, or in pack bytes staged for the load (see
+    // ScopedPackStagedReads), i.e. no decode or copy happened
+    bool IsZeroCopy() const { return m_bZeroCopy; }
+
+    // Copy the bytes into an owning vector
+    std::vector<uint8_t> ToVector() const { return {m_Bytes.begin(), m_Bytes.end()}; }
+
+    // Drop the bytes and release the owner
+    void Reset()
+    {
+        m_Bytes = {};
+        m_Owner.reset();
+        m_bZeroCopy = false;
+    }
+
+private:
+    std::span<const uint8_t> m_Bytes;
+    std::shared_ptr<const void> m_Owner;
+    bool m_bZeroCopy = false;
+};
+
+// Cooked payload whose bytes are an AssetDataView instead of an owning vector
+struct SNAPI_ASSETPIPELINE_API TypedPayloadView
+{
+    TypeId PayloadType;
+    uint32_t SchemaVersion = 0;
+    AssetDataView Bytes;
+};
+
+} // namespace SnAPI::AssetPipeline
@@ -2,10 +2,12 @@
 
 #include <any>
 #include <cstdint>
+#include <cstring>
 #include <exception>
 #include <expected>
 #include <functional>
 #include <memory>
+#include <span>
 #include <string>
 #include <typeindex>
 #include <unordered_map>
@@ -40,6 +42,15 @@ struct AssetLoadContext
     // Function to load bulk chunks by index
     std::function<std::expected<std::vector<uint8_t>, std::string>(uint32_t)> LoadBulk;
 
+    // Optional view-returning variant of LoadBulk (set for pack-backed loads)
+    std::function<std::expected<AssetDataView, std::string>(uint32_t)> LoadBulkView;
+
+    // Optional variant of LoadBulk that decodes into caller memory (set for pack-backed loads)
+    std::function<std::expected<size_t, std::string>(uint32_t, std::span<uint8_t>)> LoadBulkInto;
+
+    // Optional batched variant of LoadBulkView (set for pack-backed loads)
+    std::function<std::expected<std::vector<AssetDataView>, std::string>(std::span<const uint32_t>, uint32_t)> LoadBulkViews;
+
     // Function to load bulk chunk info
     std::function<std::expected<AssetPackReader::BulkChunkInfo, std::string>(uint32_t)> GetBulkInfo;
 
@@ -52,6 +63,73 @@ struct AssetLoadContext
     // User-supplied parameters, factories cast to their expected type
     std::any Params;
 
+    // Load a bulk chunk as a read-only view. Uncompressed pack chunks (e.g. pre-compressed
+    // BCn mips) reach the factory as a span into the pack mapping without being copied.
+    std::expected<AssetDataView, std::string> LoadBulkData(uint32_t Index) const
+    {
+        if (LoadBulkView)
+        {
+            return LoadBulkView(Index);
+        }
+        if (!LoadBulk)
+        {
+            return std::unexpected("No bulk loader available");
+        }
+        auto Bytes = LoadBulk(Index);
+        if (!Bytes.has_value())
+        {
+            return std::unexpected(Bytes.error());
+        }
+        return AssetDataView::FromVector(std::move(*Bytes));
+    }
+
+    // Load a bulk chunk into factory-owned memory (e.g. a staging buffer). Output must hold at
+    // least GetBulkInfo(Index)->UncompressedSize bytes. Returns the number of bytes written.
+    std::expected<size_t, std::string> LoadBulkData(uint32_t Index, std::span<uint8_t> Output) const
+    {
+        if (LoadBulkInto)
+        {
+            return LoadBulkInto(Index, Output);
+        }
+        auto Bytes = LoadBulkData(Index);
+        if (!Bytes.has_value())
+        {
+            return std::unexpected(Bytes.error());
+        }
+        if (Output.size() < Bytes->GetSize())
+        {
+            return std::unexpected("Output buffer too small for bulk chunk " + std::to_string(Index));
+        }
+        if (!Bytes->IsEmpty())
+        {
+            std::memcpy(Output.data(), Bytes->GetData(), Bytes->GetSize());
+        }
+        return Bytes->GetSize();
+    }
+
+    // Load several bulk chunks at once (e.g. every mip of a texture), one view per index in order.
+    // Pack-backed loads prefetch adjacent chunks together and decode them in one pass on up to
+    // MaxThreads threads (0 = one per hardware thread); other sources load each index in turn.
+    std::expected<std::vector<AssetDataView>, std::string> LoadBulkChunks(std::span<const uint32_t> Indices, uint32_t MaxThreads = 1) const
+    {
+        if (LoadBulkViews)
+        {
+            return LoadBulkViews(Indices, MaxThreads);
+        }
+        std::vector<AssetDataView> Views;
+        Views.reserve(Indices.size());
+        for (const uint32_t Index : Indices)
+        {
+            auto View = LoadBulkData(Index);
+            if (!View.has_value())
+            {
+                return std::unexpected(View.error());
+            }
+            Views.push_back(std::move(*View));
+        }
+        return Views;
+    }
+
     // Helper to deserialize the cooked payload using the registry
     // T must match the struct type for the payload's TypeId
     template<typename T>
@@ -149,8 +227,8 @@ protected:
 // Mount options for packs
 struct SNAPI_ASSETPIPELINE_API PackMountOptions
 {
-    int32_t Priority = 0;           // Higher priority packs override lower (for overlays/patches)
-    bool bLoadToMemory = false;     // Load entire pack to memory (for small packs)
+    int32_t Priority = 0;           // Higher priority packs override lower (for overlays/patches); ties go to the earlier mount
+    bool bLoadToMemory = false;     // Load entire pack to memory at mount (for small packs; sets ReadOptions.bResident)
     std::string MountPoint = "";    // Virtual path prefix (e.g., "/dlc1/")
     AssetPackReadOptions ReadOptions;
 };
@@ -160,6 +238,7 @@ struct SNAPI_ASSETPIPELINE_API AssetManagerConfig
 {
     AssetCacheConfig CacheConfig;
     uint32_t AsyncLoaderThreads = 0;    // 0 = auto (hardware_concurrency - 1)
+    uint32_t AsyncLoaderIoQueueDepth = 64; // io_uring read-ahead depth for async loads (0 = read through mmap only)
     bool bEnableHotReload = false;      // Watch for pack file changes
     std::chrono::milliseconds HotReloadPollInterval{500};
 
@@ -227,7 +306,8 @@ public:
 
     // ========== Pack Management ==========
 
-    // Mount a pack file with options
+    // Mount a pack file with options. Its assets are merged into the manager's asset index, so
+    // lookups by id or name cost the same however many packs are mounted.
     std::expected<void, std::string> MountPack(const std::string& Path, const PackMountOptions& Options = {});
 
     // Unmount a pack file
@@ -524,6 +604,12 @@ public:
     // List all discovered assets with origin/dirty/save metadata.
     std::vector<AssetCatalogEntry> ListAssetCatalog() const;
 
+    // Visit every mounted-pack asset that lookups resolve to, as ListAssetCatalog would list it,
+    // without copying names or dependency lists. Entries shadowed by a higher priority pack or a
+    // runtime-memory asset are skipped. Views are only valid during the call.
+    using PackAssetVisitor = std::function<void(const AssetInfoView& Info, const std::string& PackPath)>;
+    void ForEachPackAsset(const PackAssetVisitor& Visit) const;
+
     // Find a discovered asset by name with metadata.
     // This is a discovery/query API and does not trigger source JIT import/cook.
     std::expected<AssetCatalogEntry, std::string> FindAssetCatalog(const std::string& Name) const;
@@ -625,6 +711,20 @@ public:
     std::expected<UniqueVoidPtr, std::string> LoadAnyByName(const std::string& Name, std::type_index RuntimeType, std::any Params = {});
     std::expected<UniqueVoidPtr, std::string> LoadAnyById(AssetId Id, std::type_index RuntimeType, std::any Params = {});
 
+    // Pack file ranges a load of the asset would read that are not yet resident in memory.
+    // Ranges is empty for runtime-memory, source-backed or already resident assets. File is a
+    // duplicate of the mounted pack's descriptor to read the ranges through, and bytes read for
+    // them are used by the load when staged under ReaderSerial (see ScopedPackStagedReads).
+    struct PackReadPlan
+    {
+        std::string PackPath;
+        std::vector<AssetPackReader::FileRange> Ranges;
+        std::shared_ptr<const int> File;
+        uint64_t ReaderSerial = 0;
+    };
+    PackReadPlan GetPackReadPlan(const std::string& Name) const;
+    PackReadPlan GetPackReadPlan(AssetId Id) const;
+
     // Non-copyable
     AssetManager(const AssetManager&) = delete;
     AssetManager& operator=(const AssetManager&) = delete;
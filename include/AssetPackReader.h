@@ -3,13 +3,18 @@
 #include <cstdint>
 #include <expected>
 #include <memory>
+#include <optional>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "Export.h"
 #include "Uuid.h"
 #include "TypedPayload.h"
 #include "IAssetCooker.h"
+#include "AssetDataView.h"
+#include "MemoryMappedFile.h"
 
 namespace SnAPI::AssetPipeline
 {
@@ -26,6 +31,64 @@ struct SNAPI_ASSETPIPELINE_API AssetInfo
     std::vector<AssetDependencyRef> AssetDependencies;
 };
 
+// Non-owning counterpart of AssetInfo, read straight from the asset's index entry. The strings
+// point into the pack mapping, so building one never allocates; a view stays valid while the
+// reader that returned it is open.
+struct SNAPI_ASSETPIPELINE_API AssetInfoView
+{
+    uint32_t Index = 0; // position in the pack index (for GetAssetInfo/GetAssetDependency)
+    AssetId Id;
+    TypeId AssetKind;
+    TypeId CookedPayloadType;
+    uint32_t SchemaVersion = 0;
+    std::string_view Name;
+    std::string_view VariantKey;
+    uint32_t BulkChunkCount = 0;
+    uint32_t DependencyCount = 0;
+};
+
+// Non-owning counterpart of AssetDependencyRef
+struct SNAPI_ASSETPIPELINE_API AssetDependencyView
+{
+    AssetId Id;
+    std::string_view LogicalName;
+    EAssetDependencyKind Kind = EAssetDependencyKind::Required;
+};
+
+// Pack bytes read ahead of a load (e.g. by AsyncLoader's io_uring stage): Bytes holds Size bytes
+// of the pack file starting at Offset
+struct SNAPI_ASSETPIPELINE_API PackStagedRange
+{
+    uint64_t Offset = 0;
+    uint64_t Size = 0;
+    std::shared_ptr<const uint8_t[]> Bytes;
+};
+
+// Staged ranges of one pack, tied to the reader open they were read for (see
+// AssetPackReader::GetOpenSerial) so they are never used for a different file
+struct SNAPI_ASSETPIPELINE_API PackStagedReads
+{
+    uint64_t ReaderSerial = 0;
+    std::vector<PackStagedRange> Ranges;
+};
+
+// While alive, chunk reads made on the calling thread by the reader open that Staged belongs to
+// are served from the staged bytes whenever one staged range covers the whole chunk; other chunks
+// still come from the mapping. Zero-copy views of staged chunks share the staged buffer. Scopes
+// nest, and Staged must outlive the scope.
+class SNAPI_ASSETPIPELINE_API ScopedPackStagedReads
+{
+public:
+    explicit ScopedPackStagedReads(const PackStagedReads& Staged);
+    ~ScopedPackStagedReads();
+
+    ScopedPackStagedReads(const ScopedPackStagedReads&) = delete;
+    ScopedPackStagedReads& operator=(const ScopedPackStagedReads&) = delete;
+
+private:
+    const PackStagedReads* m_Previous = nullptr;
+};
+
 struct SNAPI_ASSETPIPELINE_API AssetPackReadOptions
 {
     bool bVerifyStringTableHash{false};
@@ -36,6 +99,48 @@ struct SNAPI_ASSETPIPELINE_API AssetPackReadOptions
     bool bValidateChunkSizes {false};
     bool bValidateChunkSanity {false};
     bool bValidateChunkIdentity {false};
+
+    // Read bulk chunks of at least DirectIoMinSize stored bytes through an unbuffered file handle
+    // (O_DIRECT / F_NOCACHE / FILE_FLAG_NO_BUFFERING) instead of the mapping, so streamed data is
+    // not kept in the page cache on top of the caller's copy. Applies to LoadBulkChunk on packs
+    // written with a chunk alignment of at least 4096; other reads keep using the mapping, as
+    // does everything when the filesystem refuses unbuffered I/O.
+    bool bDirectIo {false};
+    uint64_t DirectIoMinSize {1ull << 20};
+
+    // Maximum threads decoding the frames of one framed bulk chunk (see
+    // AssetPackWriter::SetBulkFraming) in LoadBulkChunk, the view APIs and LoadBulkChunkRange.
+    // The calling thread decodes alongside helpers from a process-wide pool. 0 = one per hardware
+    // thread, 1 = decode on the calling thread only.
+    uint32_t FrameDecodeThreads {0};
+
+    // Decoded bytes of recently used solid blocks (see AssetPackWriter::SetSolidBlocks) kept so
+    // the other payloads in a block are served without decoding it again. 0 disables the cache.
+    uint64_t SolidBlockCacheSize {8ull << 20};
+
+    // Decoded bytes of recently used compressed index blocks (see AssetPackWriter::SetCompressIndex)
+    // kept in memory. Blocks outside the cache are decoded again when their records are read.
+    uint64_t IndexBlockCacheSize {8ull << 20};
+
+    // Readahead policy for the chunk data of the mapping: Sequential for packs streamed front to
+    // back, Random for packs whose assets are loaded in scattered order. The string table and
+    // index keep the default policy.
+    EMapAccessPattern AccessPattern {EMapAccessPattern::Normal};
+
+    // Back the mapping with transparent huge pages where supported, cutting TLB misses on
+    // multi-GB packs
+    bool bHugePages {false};
+
+    // Drop a bulk chunk's pages from the mapping once LoadBulkChunk has decoded or copied it into
+    // caller memory, so consumed streaming data does not stay mapped. Ignored for resident packs.
+    bool bReleaseDecodedBulk {false};
+
+    // Fault the whole pack into memory when it is opened, so every later load is served from RAM
+    // without blocking on disk I/O (for small, hot packs such as UI or config). bDirectIo is
+    // ignored. With bLockResident the pages are also pinned (mlock/VirtualLock) so they cannot be
+    // evicted; that is best effort, limited by e.g. RLIMIT_MEMLOCK (see IsMemoryLocked).
+    bool bResident {false};
+    bool bLockResident {false};
 };
 
 class SNAPI_ASSETPIPELINE_API AssetPackReader
@@ -44,7 +149,8 @@ public:
     AssetPackReader();
     ~AssetPackReader();
 
-    // Open a .snpak file for reading
+    // Open a .snpak file for reading. The file is memory-mapped once; the header, string table and
+    // index are used in place and names are only copied out when an AssetInfo is requested.
     std::expected<void, std::string> Open(const std::string& Path);
     std::expected<void, std::string> Open(const std::string& Path, const AssetPackReadOptions& Options);
 
@@ -54,6 +160,35 @@ public:
     // Check if a pack is open
     bool IsOpen() const;
 
+    // Alignment of chunk data in the pack (1 if it was written unaligned). Zero-copy views of
+    // uncompressed chunks start on this boundary.
+    uint32_t GetChunkAlignment() const;
+
+    // True when large bulk reads bypass the page cache (see AssetPackReadOptions::bDirectIo)
+    bool IsUsingDirectIo() const;
+
+    // True when the pack's pages are pinned in memory (see AssetPackReadOptions::bLockResident)
+    bool IsMemoryLocked() const;
+
+    // Identifies the current open of this reader (0 when closed); differs for every Open of any reader
+    uint64_t GetOpenSerial() const;
+
+    // Duplicate of the descriptor the pack is mapped from, so reads issued through it hit exactly
+    // the file this reader sees even after the path was replaced. Closed when the last copy is
+    // released; nullptr when the reader is not open or on platforms without file descriptors.
+    std::shared_ptr<const int> DuplicateFileDescriptor() const;
+
+    // True when the pack's index arrays are stored compressed (see
+    // AssetPackWriter::SetCompressIndex), as recorded by the index header; also for empty indexes
+    bool IsIndexCompressed() const;
+
+    // Bytes of decoded compressed index blocks currently held (at most
+    // AssetPackReadOptions::IndexBlockCacheSize); 0 for uncompressed indexes, which are used in place
+    uint64_t GetIndexMemoryUsage() const;
+
+    // Number of trained Zstd dictionaries stored in the pack (see AssetPackWriter::SetDictionaryTraining)
+    uint32_t GetDictionaryCount() const;
+
     // Get the number of assets in the pack
     uint32_t GetAssetCount() const;
 
@@ -64,7 +199,26 @@ public:
     std::expected<AssetInfo, std::string> FindAsset(AssetId Id) const;
 
     // Find assets by name (may return multiple if variants exist)
-    std::vector<AssetInfo> FindAssetsByName(const std::string& Name) const;
+    std::vector<AssetInfo> FindAssetsByName(std::string_view Name) const;
+
+    // View variants of GetAssetInfo/FindAsset/FindAssetsByName that do not allocate. By name,
+    // the first asset in index order is returned. Empty when there is no such asset.
+    std::optional<AssetInfoView> GetAssetInfoView(uint32_t Index) const;
+    std::optional<AssetInfoView> FindAssetView(AssetId Id) const;
+    std::optional<AssetInfoView> FindAssetViewByName(std::string_view Name) const;
+
+    // Dependency DependencyIndex (< AssetInfoView::DependencyCount) of the asset at AssetIndex
+    std::optional<AssetDependencyView> GetAssetDependency(uint32_t AssetIndex, uint32_t DependencyIndex) const;
+
+    // Allocation-free membership tests: the index (for GetAssetInfo) of the asset with Id, or of
+    // the first asset named Name in index order
+    std::optional<uint32_t> FindAssetIndex(AssetId Id) const;
+    std::optional<uint32_t> FindAssetIndexByName(std::string_view Name) const;
+
+    // Id and name of the asset at Index, read in place. The name stays valid while the pack is
+    // open. Out-of-range indices yield a null id and an empty name.
+    AssetId GetAssetId(uint32_t Index) const;
+    std::string_view GetAssetName(uint32_t Index) const;
 
     // Load the cooked payload for an asset
     std::expected<TypedPayload, std::string> LoadCookedPayload(AssetId Id) const;
@@ -72,6 +226,39 @@ public:
     // Load a bulk chunk for an asset
     std::expected<std::vector<uint8_t>, std::string> LoadBulkChunk(AssetId Id, uint32_t BulkIndex) const;
 
+    // Load a bulk chunk straight into caller memory (e.g. a staging buffer) without an intermediate
+    // allocation. Output must hold at least GetBulkChunkInfo().UncompressedSize bytes.
+    // Returns the number of bytes written.
+    std::expected<size_t, std::string> LoadBulkChunk(AssetId Id, uint32_t BulkIndex, std::span<uint8_t> Output) const;
+
+    // Load Length bytes of a bulk chunk's decoded data starting at Offset (clamped to the end of
+    // the chunk), e.g. to stream part of a large audio or geometry blob. Chunks the writer split
+    // into frames (see AssetPackWriter::SetBulkFraming) only decompress the frames overlapping the
+    // range; with bVerifyChunkHash those frames are checked against their own hashes. Other
+    // compressed chunks are decoded whole. Offset past the end of the chunk is an error.
+    std::expected<std::vector<uint8_t>, std::string> LoadBulkChunkRange(AssetId Id, uint32_t BulkIndex, uint64_t Offset,
+                                                                        uint64_t Length) const;
+
+    // Range read into caller memory: fills Output (or as much of it as the chunk has past
+    // Offset) and returns the number of bytes written
+    std::expected<size_t, std::string> LoadBulkChunkRange(AssetId Id, uint32_t BulkIndex, uint64_t Offset, std::span<uint8_t> Output) const;
+
+    // View variants of LoadCookedPayload/LoadBulkChunk. Uncompressed chunks are returned as a
+    // span straight into the pack mapping (no copy); compressed chunks are decoded into a buffer
+    // taken from a per-thread pool and recycled once the view is released. Views keep their
+    // backing memory alive independently of this reader.
+    std::expected<TypedPayloadView, std::string> LoadCookedPayloadView(AssetId Id) const;
+    std::expected<AssetDataView, std::string> LoadBulkChunkView(AssetId Id, uint32_t BulkIndex) const;
+
+    // Load several bulk chunks of one asset in one call (e.g. every mip of a texture). The asset is
+    // looked up once, each contiguous run of chunks gets a single readahead hint, and the chunks are
+    // decoded in one pass on the shared decode pool using up to MaxThreads threads, the caller
+    // included (0 = as many as the pool has).
+    // Returns one view per entry of BulkIndices, in the same order, as LoadBulkChunkView would.
+    std::expected<std::vector<AssetDataView>, std::string> LoadBulkChunks(AssetId Id,
+                                                                        std::span<const uint32_t> BulkIndices,
+                                                                        uint32_t MaxThreads = 1) const;
+
     // Get bulk chunk info
     struct BulkChunkInfo
     {
@@ -81,6 +268,20 @@ public:
     };
     std::expected<BulkChunkInfo, std::string> GetBulkChunkInfo(AssetId Id, uint32_t BulkIndex) const;
 
+    // A byte range of the pack file
+    struct FileRange
+    {
+        uint64_t Offset;
+        uint64_t Size;
+    };
+
+    // File ranges holding the payload and bulk chunks of an asset, sorted, with adjacent chunks
+    // merged. Bulk chunks that loads read with direct I/O (see AssetPackReadOptions::bDirectIo)
+    // are left out since they never go through the mapping. With bSkipResident, ranges whose pages
+    // are already in memory are left out too, so the result is what loading the asset would still
+    // have to fetch from disk through the mapping.
+    std::expected<std::vector<FileRange>, std::string> GetAssetFileRanges(AssetId Id, bool bSkipResident = false) const;
+
     // Find the local bulk-array index for a semantic/subindex pair.
     // Returns the index expected by LoadBulkChunk/GetBulkChunkInfo.
     std::expected<uint32_t, std::string> FindBulkChunkIndex(AssetId Id, EBulkSemantic Semantic, uint32_t SubIndex) const;
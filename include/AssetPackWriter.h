@@ -32,21 +32,119 @@ struct SNAPI_ASSETPIPELINE_API AssetPackEntry
     std::optional<EPackCompressionLevel> CompressionLevelOverride;
 };
 
+// Outcome of AssetPackWriter::Compact
+struct SNAPI_ASSETPIPELINE_API PackCompactionResult
+{
+    bool bCompacted = false;  // false when the dead-byte ratio was below the requested minimum
+    uint64_t SizeBefore = 0;  // file size of the pack before compaction
+    uint64_t SizeAfter = 0;   // file size after compaction (or that compaction would produce)
+    uint32_t ChunkCount = 0;  // live chunks copied
+};
+
+// Outcome of AssetPackWriter::Merge
+struct SNAPI_ASSETPIPELINE_API PackMergeResult
+{
+    uint32_t AssetCount = 0;         // assets in the merged pack
+    uint32_t ReplacedAssetCount = 0; // entries dropped because a later input has the same AssetId
+    uint32_t ChunkCount = 0;         // chunks copied
+    uint64_t FileSize = 0;
+};
+
 class SNAPI_ASSETPIPELINE_API AssetPackWriter
 {
 public:
     AssetPackWriter();
     ~AssetPackWriter();
 
-    // Set compression mode (default: Zstd)
+    // Set compression mode (default: Zstd). EPackCompression::Auto picks a codec per chunk.
     void SetCompression(EPackCompression Mode) const;
 
+    // Cost model and candidates used when the compression mode (or a per-asset/per-bulk override)
+    // is EPackCompression::Auto
+    void SetAutoCompressionSettings(PackAutoCompressionSettings Settings) const;
+
+    // Per-codec totals for the chunks stored by the last Write/AppendUpdate (or by the active
+    // streaming write so far), one entry per codec that was used. Chunks deduplicated against an
+    // existing copy are not counted again.
+    std::vector<PackCodecStats> GetCompressionStats() const;
+
     // Set compression level (default: Default)
     void SetCompressionLevel(EPackCompressionLevel Level) const;
 
     // Enable maximum compression level (slower, smaller output)
     void SetMaxCompression(bool bEnable) const;
 
+    // Number of threads used to compress chunks during Write/AppendUpdate (0 = one per
+    // hardware thread, 1 = compress on the calling thread). Output is identical for any value.
+    void SetCompressionThreads(uint32_t ThreadCount) const;
+
+    // Emit precomputed AssetId/name lookup tables next to the index (default: on) so readers can
+    // mount the pack without building hash maps. Packs stay readable by readers that ignore them.
+    void SetWriteLookupTables(bool bEnable) const;
+
+    // Store the index arrays column-encoded and Zstd-compressed (default: off). Shrinks the bytes
+    // read and hashed at mount for packs with many assets; readers decode the arrays once at
+    // open. AppendUpdate keeps an existing pack's compressed index compressed.
+    void SetCompressIndex(bool bEnable) const;
+
+    // Store byte-identical chunks only once (default: on). Chunks with the same content hash,
+    // size, kind and compression settings are compressed and written a single time and every
+    // index/bulk entry points at that copy; AppendUpdate also reuses chunks already in the pack.
+    void SetDeduplicateChunks(bool bEnable) const;
+
+    // Align the start of every chunk's data to Alignment bytes (default: 1, no padding), e.g. 16
+    // for SIMD-friendly views or 4096 and up so readers can serve bulk data with unbuffered
+    // (O_DIRECT) reads. Values are rounded up to a power of two, at most 1 MiB. The alignment is
+    // recorded in the pack header; AppendUpdate keeps the alignment of the pack it extends.
+    void SetChunkAlignment(uint32_t Alignment) const;
+
+    // Split compressed bulk chunks larger than Threshold bytes into independently compressed
+    // frames of FrameSize bytes (default: 1 MiB frames above 8 MiB), so readers can decode a
+    // byte range without decoding the whole chunk (see AssetPackReader::LoadBulkChunkRange).
+    // FrameSize is clamped to [kMinBulkFrameSize, kMaxBulkFrameSize]. A Threshold of 0 disables
+    // framing, except for chunks over 1 GiB, which are always framed.
+    void SetBulkFraming(uint64_t Threshold, uint32_t FrameSize) const;
+
+    static constexpr uint32_t kMinBulkFrameSize = 64u * 1024;
+    static constexpr uint32_t kMaxBulkFrameSize = 256u * 1024 * 1024;
+
+    // Train a Zstd dictionary per asset kind from its small payloads and compress those payloads
+    // against it (default: off; see PackDictionarySettings). Dictionaries are stored in the pack
+    // and loaded by AssetPackReader on open. AppendUpdate keeps the pack's dictionaries and only
+    // trains kinds that have none yet; streaming writes never train.
+    void SetDictionaryTraining(PackDictionarySettings Settings) const;
+
+    // Store small main payloads in shared solid chunks (default: off; see PackSolidBlockSettings).
+    // BlockSize is clamped to [MaxAssetSize, kMaxSolidBlockSize]. Payloads that go into solid
+    // blocks are never compressed against a dictionary.
+    void SetSolidBlocks(PackSolidBlockSettings Settings) const;
+
+    static constexpr uint32_t kMaxSolidBlockSize = 16u * 1024 * 1024;
+
+    // Place chunks in the order assets are loaded at runtime instead of AddAsset order, so cold
+    // loads read the pack mostly front to back. LoadOrder lists AssetIds in first-load order,
+    // e.g. recorded during a play session; repeated and unknown ids are ignored. Every unlisted
+    // asset goes right after the first placed asset that depends on it; the remaining unlisted
+    // assets keep AddAsset order, each followed by its unlisted dependencies. Only the chunk
+    // layout changes (solid blocks are filled in layout order); the index keeps AddAsset order.
+    // Applies to Write, the chunks AppendUpdate adds, each flush of a streaming write, Compact
+    // and Merge. An empty list (the default) keeps AddAsset order.
+    void SetAccessOrderProfile(std::vector<AssetId> LoadOrder) const;
+
+    // Start a streaming write to OutputPath. Instead of holding every asset until Write(),
+    // the writer compresses and appends chunks to OutputPath + ".tmp" whenever the buffered
+    // assets exceed the streaming budget, keeping only index metadata in memory.
+    // Write(OutputPath) then flushes the remainder and finalizes string table, index and header.
+    // Streamed packs place the string table after the chunks, like append-updated packs.
+    std::expected<void, std::string> BeginStreamingWrite(const std::string& OutputPath) const;
+
+    // Maximum uncompressed payload/bulk bytes buffered before a streaming write flushes them
+    // to disk (default: 256 MiB). A single asset larger than the budget is flushed on its own.
+    void SetStreamingBudget(uint64_t MaxInFlightBytes) const;
+
+    // True between BeginStreamingWrite and the finalizing Write/Clear
+    bool IsStreaming() const;
+
     // Add an asset to be written
     void AddAsset(AssetPackEntry Entry) const;
 
@@ -66,10 +164,31 @@ public:
     // If the file doesn't exist, creates a new pack
     std::expected<void, std::string> AppendUpdate(const std::string& PackPath) const;
 
-    // Clear all pending assets
+    // Rewrite PackPath with only the data its current index references: live chunks are copied
+    // byte for byte (no recompression) in their existing order, or in access order when a
+    // profile is set (see SetAccessOrderProfile), keeping the pack's chunk alignment and
+    // dictionaries, and the string table drops names of replaced assets. Previous indices of an
+    // append-update chain are discarded. The result replaces PackPath atomically.
+    // Nothing is written when the share of reclaimable bytes, (SizeBefore - SizeAfter) /
+    // SizeBefore, is below MinDeadRatio. Pending assets are not used; of the writer settings only
+    // SetWriteLookupTables, SetDeduplicateChunks, SetAccessOrderProfile, SetChunkAlignment (which
+    // can only raise the pack's alignment) and SetCompressIndex (a compressed index stays
+    // compressed) apply.
+    std::expected<PackCompactionResult, std::string> Compact(const std::string& PackPath, double MinDeadRatio = 0.0) const;
+
+    // Combine the packs in InputPaths into a new pack at OutputPath without recompressing: chunks
+    // are copied byte for byte with their hashes and only the string table and index are rebuilt.
+    // When several inputs contain the same AssetId, the last input wins and the asset keeps the
+    // index position of its first occurrence. The dictionaries of all inputs are kept and chunks
+    // are aligned to the largest alignment among the inputs and SetChunkAlignment. Settings apply
+    // as for Compact (the index is compressed if any input's is); with SetDeduplicateChunks,
+    // identical chunks of different inputs are stored once.
+    std::expected<PackMergeResult, std::string> Merge(const std::vector<std::string>& InputPaths, const std::string& OutputPath) const;
+
+    // Clear all pending assets (abandons an active streaming write and deletes its temp file)
     void Clear() const;
 
-    // Get the number of pending assets
+    // Get the number of pending assets (including assets already streamed to disk)
     uint32_t GetPendingAssetCount() const;
 
     // Non-copyable
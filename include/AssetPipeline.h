@@ -28,6 +28,10 @@ struct SNAPI_ASSETPIPELINE_API BuildResult
     uint32_t AssetsFailed = 0;
     std::vector<std::string> Errors;
     std::vector<std::string> Warnings;
+    // Per-codec totals of the chunks stored by the pack write (see AssetPackWriter::GetCompressionStats)
+    std::vector<PackCodecStats> CompressionStats;
+    // Bytes reclaimed by compacting the pack after an append-update (see AutoCompactDeadRatio)
+    uint64_t CompactedBytes = 0;
 };
 
 struct SNAPI_ASSETPIPELINE_API PluginInfo
@@ -22,6 +22,7 @@ namespace SnAPI::AssetPipeline
 
 // Forward declarations
 class AssetManager;
+struct PackStagedReads;
 
 // Load priority levels
 enum class ELoadPriority : uint32_t
@@ -97,6 +98,7 @@ struct LoadRequest
     std::function<void(void*, const std::string&)> Callback;  // void* = raw asset ptr
     std::function<void(void*)> ResultDeleter;                 // Type-erased deleter for cleanup on cancellation
     std::chrono::steady_clock::time_point QueueTime;
+    std::shared_ptr<const PackStagedReads> StagedReads;      // Pack bytes read ahead by the io_uring stage
 
     // Priority queue comparison (higher priority first, then earlier queue time)
     bool operator<(const LoadRequest& Other) const
@@ -113,7 +115,11 @@ struct LoadRequest
 class SNAPI_ASSETPIPELINE_API AsyncLoader
 {
 public:
-    explicit AsyncLoader(AssetManager& Manager, uint32_t NumThreads = 0);
+    // IoQueueDepth > 0 enables the io_uring read stage: the pack chunks of each queued load are
+    // read asynchronously into buffers that travel with the load, and the worker decodes from
+    // them instead of faulting the mapping in. Where io_uring is unavailable the stage is skipped
+    // and workers read through the memory mapping as before.
+    explicit AsyncLoader(AssetManager& Manager, uint32_t NumThreads = 0, uint32_t IoQueueDepth = 0);
     ~AsyncLoader();
 
     // Queue an async load by name
@@ -145,6 +151,9 @@ public:
     uint32_t GetPendingCount() const;
     uint32_t GetCompletedCount() const;
 
+    // True when queued loads are read ahead through io_uring
+    bool IsUsingIoUring() const;
+
     // Process completed callbacks on calling thread (for main thread dispatch)
     // Returns number of callbacks processed
     uint32_t ProcessCompletedCallbacks();
@@ -159,6 +168,11 @@ public:
 private:
     void WorkerThread();
     uint64_t GenerateRequestId();
+    void Enqueue(LoadRequest Req);
+    void DispatchToWorkers(LoadRequest Req);
+
+    struct IoStage;
+    std::unique_ptr<IoStage> m_IoStage;
 
     AssetManager& m_Manager;
 
@@ -230,11 +244,7 @@ AsyncLoadHandle AsyncLoader::LoadAsync(const std::string& Name,
         m_ActiveRequests[Req.Id] = std::move(Waitable);
     }
 
-    {
-        std::lock_guard Lock(m_QueueMutex);
-        m_Queue.push(std::move(Req));
-    }
-    m_QueueCV.notify_one();
+    Enqueue(std::move(Req));
 
     return Handle;
 }
@@ -277,11 +287,7 @@ AsyncLoadHandle AsyncLoader::LoadAsync(AssetId Id,
         m_ActiveRequests[Req.Id] = std::move(Waitable);
     }
 
-    {
-        std::lock_guard Lock(m_QueueMutex);
-        m_Queue.push(std::move(Req));
-    }
-    m_QueueCV.notify_one();
+    Enqueue(std::move(Req));
 
     return Handle;
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <expected>
 #include <memory>
@@ -20,6 +21,14 @@ enum class EMapAccess
     CopyOnWrite,  // Changes are private to this mapping
 };
 
+// Expected access pattern of a mapping, passed to the kernel as its readahead policy
+enum class EMapAccessPattern
+{
+    Normal,      // Default readahead
+    Sequential,  // Read front to back: aggressive readahead, pages behind the reader are dropped early
+    Random,      // Scattered reads: no readahead, so neighbouring data is not pulled into the page cache
+};
+
 // Memory-mapped file for efficient streaming access
 class SNAPI_ASSETPIPELINE_API MemoryMappedFile
 {
@@ -55,6 +64,34 @@ public:
     // Prefetch a region into memory (hint to OS)
     void Prefetch(size_t Offset, size_t Length) const;
 
+    // True when every page of the region is already in memory, i.e. touching it will not block
+    // on disk I/O. Always false where residency cannot be queried.
+    bool IsResident(size_t Offset, size_t Length) const;
+
+    // Set the readahead policy of a region (the whole mapping by default). Applies to every page
+    // the region touches. No-op where unsupported.
+    void SetAccessPattern(EMapAccessPattern Pattern, size_t Offset = 0, size_t Length = SIZE_MAX) const;
+
+    // Ask for the mapping to be backed by transparent huge pages, which cuts TLB misses on large
+    // files. Returns false where the kernel or filesystem does not support it.
+    bool RequestHugePages() const;
+
+    // Drop the whole pages inside a region from this mapping (MADV_DONTNEED), e.g. once a chunk has
+    // been decoded into a copy. The file is untouched and later reads fault the pages back in.
+    // No-op where unsupported.
+    void Release(size_t Offset, size_t Length) const;
+
+    // Fault every page of the mapping in now so later reads do not block on disk I/O and, with
+    // bLock, pin the pages in RAM (mlock/VirtualLock) so they cannot be evicted. Returns an error
+    // when locking is refused (e.g. RLIMIT_MEMLOCK); the pages are faulted in regardless.
+    std::expected<void, std::string> MakeResident(bool bLock);
+
+    // True when MakeResident pinned the mapping
+    bool IsLocked() const { return m_bLocked; }
+
+    // Descriptor the mapping was created from, owned by this object (-1 when closed or on Windows)
+    int GetFileDescriptor() const;
+
     // Get the file path
     const std::string& GetPath() const { return m_Path; }
 
@@ -71,6 +108,7 @@ private:
     uint8_t* m_Data = nullptr;
     size_t m_Size = 0;
     EMapAccess m_Access = EMapAccess::ReadOnly;
+    bool m_bLocked = false;
 
 #ifdef _WIN32
     void* m_FileHandle = nullptr;
@@ -151,6 +189,9 @@ public:
     // Get the pack file size
     size_t GetPackSize() const { return m_MappedFile.GetSize(); }
 
+    // Get the start of the mapped pack (nullptr if not open or empty)
+    const uint8_t* GetData() const { return m_MappedFile.GetData(); }
+
     // Read a chunk at a specific offset (zero-copy if possible)
     // Returns a span pointing directly into the memory-mapped region
     std::expected<std::span<const uint8_t>, std::string> ReadChunk(size_t Offset, size_t Size) const;
@@ -163,6 +204,19 @@ public:
     // Prefetch chunks for upcoming reads (async hint to OS)
     void PrefetchRange(size_t Offset, size_t Size) const;
 
+    // True when the range is already in memory (see MemoryMappedFile::IsResident)
+    bool IsResident(size_t Offset, size_t Size) const { return m_MappedFile.IsResident(Offset, Size); }
+
+    // Mapping hints (see MemoryMappedFile::SetAccessPattern, RequestHugePages and Release)
+    void SetAccessPattern(EMapAccessPattern Pattern, size_t Offset = 0, size_t Size = SIZE_MAX) const { m_MappedFile.SetAccessPattern(Pattern, Offset, Size); }
+    bool RequestHugePages() const { return m_MappedFile.RequestHugePages(); }
+    void ReleaseRange(size_t Offset, size_t Size) const { m_MappedFile.Release(Offset, Size); }
+
+    // Fault the whole pack in and optionally pin it (see MemoryMappedFile::MakeResident)
+    std::expected<void, std::string> MakeResident(bool bLock) { return m_MappedFile.MakeResident(bLock); }
+    bool IsLocked() const { return m_MappedFile.IsLocked(); }
+    int GetFileDescriptor() const { return m_MappedFile.GetFileDescriptor(); }
+
     // Map a specific region for extended access
     std::expected<MemoryMappedRegion, std::string> MapRegion(size_t Offset, size_t Size) const;
 
@@ -1,5 +1,11 @@
 #pragma once
 
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "Export.h"
+
 namespace SnAPI::AssetPipeline
 {
 
@@ -11,6 +17,10 @@ enum class EPackCompression
     LZ4HC,
     Zstd,
     ZstdFast,
+    // Trial-compress every chunk with PackAutoCompressionSettings::Candidates and keep the cheapest
+    // result under its cost model (possibly None). Only meaningful for writing; packs never
+    // store it.
+    Auto,
 };
 
 enum class EPackCompressionLevel
@@ -21,4 +31,64 @@ enum class EPackCompressionLevel
     Max,
 };
 
+// Cost model for EPackCompression::Auto. Each candidate is scored as
+//   StoredBytes + DecodeCostWeight * UncompressedBytes * RelativeDecodeCost(codec)
+// where RelativeDecodeCost is 0 for None, 0.2 for LZ4/LZ4HC, 0.7 for ZstdFast and 1 for Zstd,
+// so a larger weight favours faster decoding over smaller packs. The lowest score wins; a codec
+// that saves less than MinSavingsRatio of the chunk size never beats None.
+struct SNAPI_ASSETPIPELINE_API PackAutoCompressionSettings
+{
+    std::vector<std::pair<EPackCompression, EPackCompressionLevel>> Candidates = {
+        {EPackCompression::LZ4, EPackCompressionLevel::Default},
+        {EPackCompression::Zstd, EPackCompressionLevel::Fast},
+        {EPackCompression::Zstd, EPackCompressionLevel::Default},
+    };
+    double DecodeCostWeight = 0.05;
+    double MinSavingsRatio = 0.05;
+
+    // Chunks larger than this are scored on evenly spaced samples totalling SampleBytes and
+    // compressed once more with the winner; smaller chunks reuse the winning trial output
+    uint64_t SampleBytes = 1024 * 1024;
+};
+
+// Per-asset-kind Zstd dictionaries for small main payloads. Before the chunks are compressed, the
+// writer trains one dictionary per AssetKind on that kind's payloads of at most MaxPayloadSize
+// bytes and stores it in the pack; those payloads are then compressed against it. Only payloads
+// whose resolved codec is Zstd or ZstdFast use dictionaries (not Auto, not bulk chunks).
+struct SNAPI_ASSETPIPELINE_API PackDictionarySettings
+{
+    bool bEnabled = false;
+    uint32_t MaxPayloadSize = 16 * 1024;
+    // Kinds with fewer eligible payloads get no dictionary
+    uint32_t MinSamples = 32;
+    // Upper bound on the size of each trained dictionary
+    uint32_t MaxDictionarySize = 32 * 1024;
+    // Upper bound on the payload bytes one kind feeds to the trainer
+    uint64_t MaxSampleBytes = 8ull * 1024 * 1024;
+};
+
+// Solid blocks for tiny assets. Main payloads of at most MaxAssetSize bytes are stored back to
+// back in shared "solid" chunks of up to BlockSize decoded bytes, compressed as one unit, instead
+// of one chunk each. Payloads are grouped by their resolved codec, in AddAsset order. Readers
+// decode a block once and serve its other payloads from a small cache (see
+// AssetPackReadOptions::SolidBlockCacheSize).
+struct SNAPI_ASSETPIPELINE_API PackSolidBlockSettings
+{
+    // 0 disables solid blocks
+    uint32_t MaxAssetSize = 0;
+    uint32_t BlockSize = 256 * 1024;
+};
+
+// Totals for the chunks a pack write stored with one codec
+struct SNAPI_ASSETPIPELINE_API PackCodecStats
+{
+    EPackCompression Compression = EPackCompression::None;
+    uint32_t ChunkCount = 0;
+    uint32_t AutoChunkCount = 0; // chunks for which EPackCompression::Auto picked this codec
+    uint32_t DictionaryChunkCount = 0; // chunks compressed against a trained dictionary
+    uint32_t SolidPayloadCount = 0; // main payloads stored inside this codec's solid blocks
+    uint64_t UncompressedBytes = 0;
+    uint64_t StoredBytes = 0;
+};
+
 } // namespace SnAPI::AssetPipeline
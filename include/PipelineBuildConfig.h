@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -9,10 +10,36 @@
 #include "PackCompression.h"
 #include "Export.h"
 #include "IAssetImportSettings.h"
+#include "IAssetCooker.h"
+#include "Uuid.h"
 
 namespace SnAPI::AssetPipeline
 {
 
+// Which chunks of a matching asset a compression rule applies to
+enum class EPackCompressionScope : uint8_t
+{
+    AllChunks = 0,  // Cooked payload and bulk chunks
+    Payload = 1,    // Cooked payload only
+    Bulk = 2,       // Bulk chunks only
+};
+
+// One row of the per-asset-kind compression policy. Unset keys match anything. When several
+// rules match a chunk, the most specific wins (AssetKind counts over BulkSemantic/Scope); ties go
+// to the rule listed last. Overrides set by the cooker itself, and bulk chunks cooked with
+// bCompress = false, are left alone.
+struct SNAPI_ASSETPIPELINE_API PackCompressionRule
+{
+    std::optional<TypeId> AssetKind;
+    EPackCompressionScope Scope = EPackCompressionScope::AllChunks;
+    // Restricts the rule to bulk chunks with this semantic (implies EPackCompressionScope::Bulk)
+    std::optional<EBulkSemantic> BulkSemantic;
+
+    EPackCompression Compression = EPackCompression::Zstd;
+    // Unset = the pack-wide CompressionLevel
+    std::optional<EPackCompressionLevel> Level;
+};
+
 struct SNAPI_ASSETPIPELINE_API PipelineBuildConfig
 {
     // Source directories to scan for assets
@@ -37,14 +64,36 @@ struct SNAPI_ASSETPIPELINE_API PipelineBuildConfig
     // Enable append-update mode (fast incremental packaging)
     bool bEnableAppendUpdates = true;
 
+    // After an append-update, compact the pack when at least this share of its bytes is no longer
+    // referenced by the current index (0 = never; see AssetPackWriter::Compact)
+    double AutoCompactDeadRatio = 0.0;
+
     // Cache database path for incremental builds (empty = derived from OutputPackPath)
     std::string CacheDatabasePath;
 
     // Compression settings
     EPackCompression Compression = EPackCompression::Zstd;
     EPackCompressionLevel CompressionLevel = EPackCompressionLevel::Default;
+    // Candidates and cost model used when Compression is EPackCompression::Auto
+    PackAutoCompressionSettings AutoCompression;
+    // Per-asset-kind / per-bulk-semantic overrides of Compression and CompressionLevel
+    std::vector<PackCompressionRule> CompressionPolicy;
+    // Per-asset-kind Zstd dictionaries for small payloads (ignored by streaming writes)
+    PackDictionarySettings DictionaryTraining;
+    // Grouping of small main payloads into shared solid blocks (disabled by default)
+    PackSolidBlockSettings SolidBlocks;
+    // AssetIds in recorded runtime load order; chunks are laid out in that order instead of
+    // source order (see AssetPackWriter::SetAccessOrderProfile). Empty keeps source order.
+    std::vector<AssetId> AccessOrderProfile;
+    // Store the pack index column-encoded and compressed (see AssetPackWriter::SetCompressIndex)
+    bool bCompressIndex = false;
+
+    // When non-zero, full (non-append) pack writes stream chunks to disk as sources finish
+    // cooking, buffering at most this many uncompressed bytes (0 = hold the whole pack in memory)
+    uint64_t StreamingWriteBudget = 0;
 
-    // Number of parallel jobs (0 = auto)
+    // Number of sources imported/cooked concurrently during batch builds (0 = auto,
+    // one per hardware thread). Pack output is identical regardless of this value.
     uint32_t ParallelJobs = 0;
 
     // Verbose logging
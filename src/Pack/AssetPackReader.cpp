@@ -1,14 +1,27 @@
 #include "AssetPackReader.h"
 #include "MemoryMappedFile.h"
+#include "DecodePool.h"
+#include "DirectFile.h"
 #include "SnPakFormat.h"
 
 #define XXH_INLINE_ALL
 #include <xxhash.h>
 
-#include <filesystem>
-#include <fstream>
+#include <algorithm>
+#include <atomic>
 #include <unordered_map>
 #include <cstring>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <thread>
+
+#ifndef _WIN32
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
 
 namespace SnAPI::AssetPipeline
 {
@@ -17,27 +30,190 @@ namespace SnAPI::AssetPipeline
   namespace Pack
   {
     std::vector<uint8_t> Decompress(const uint8_t* Data, size_t CompressedSize, size_t UncompressedSize, ESnPakCompression Mode);
+    void Decompress(const uint8_t* Data, size_t CompressedSize, std::span<uint8_t> Output, ESnPakCompression Mode,
+                    const ZstdDictionarySet* Dictionaries);
+    void DecompressFrameRange(const uint8_t* Data, size_t StoredSize, uint64_t UncompressedSize, uint64_t Offset,
+                              std::span<uint8_t> Output, ESnPakCompression Mode, bool bVerifyFrames);
+  }
+
+  namespace
+  {
+    // Per-thread pool of decode buffers for the view APIs. Buffers are handed out as shared_ptrs;
+    // once every view referencing one is gone (use_count back to 1) the next decode on this thread
+    // reuses both the allocation and the control block, so steady-state streaming does not allocate.
+    class DecodeBufferPool
+    {
+    public:
+      std::shared_ptr<std::vector<uint8_t>> Acquire(const size_t Size)
+      {
+        if (Size > kMaxPooledBufferSize)
+        {
+          return std::make_shared<std::vector<uint8_t>>(Size);
+        }
+
+        // Prefer the smallest idle buffer that already fits, otherwise grow the largest idle one
+        std::shared_ptr<std::vector<uint8_t>>* Best = nullptr;
+        for (auto& Buffer : Buffers)
+        {
+          if (Buffer.use_count() != 1)
+          {
+            continue;
+          }
+          if (Best == nullptr)
+          {
+            Best = &Buffer;
+            continue;
+          }
+          const size_t BestCapacity = (*Best)->capacity();
+          const size_t Capacity = Buffer->capacity();
+          const bool bBestFits = BestCapacity >= Size;
+          const bool bFits = Capacity >= Size;
+          if ((bFits && (!bBestFits || Capacity < BestCapacity)) || (!bFits && !bBestFits && Capacity > BestCapacity))
+          {
+            Best = &Buffer;
+          }
+        }
+
+        if (Best == nullptr)
+        {
+          auto Buffer = std::make_shared<std::vector<uint8_t>>(Size);
+          if (Buffers.size() < kMaxPooledBuffers)
+          {
+            Buffers.push_back(Buffer);
+          }
+          return Buffer;
+        }
+
+        // Pair with the release decrement of the thread that dropped the last view
+        std::atomic_thread_fence(std::memory_order_acquire);
+        (*Best)->resize(Size);
+        return *Best;
+      }
+
+    private:
+      static constexpr size_t kMaxPooledBuffers = 8;
+      static constexpr size_t kMaxPooledBufferSize = 64ull * 1024ull * 1024ull;
+
+      std::vector<std::shared_ptr<std::vector<uint8_t>>> Buffers;
+    };
+
+    DecodeBufferPool& GetDecodeBufferPool()
+    {
+      static thread_local DecodeBufferPool Pool;
+      return Pool;
+    }
+
+    // Innermost ScopedPackStagedReads of this thread
+    thread_local const PackStagedReads* t_StagedReads = nullptr;
+
+    std::atomic<uint64_t> g_NextOpenSerial{1};
+  } // namespace
+
+  ScopedPackStagedReads::ScopedPackStagedReads(const PackStagedReads& Staged) : m_Previous(t_StagedReads)
+  {
+    t_StagedReads = &Staged;
+  }
+
+  ScopedPackStagedReads::~ScopedPackStagedReads()
+  {
+    t_StagedReads = m_Previous;
   }
 
   struct AssetPackReader::Impl
   {
       std::string FilePath;
-      mutable std::ifstream File; // Used only during Open() for initialization
-      StreamingBulkReader MappedReader;
+      // Shared so views handed out by the *View APIs keep the mapping alive after Close()
+      std::shared_ptr<StreamingBulkReader> MappedReader = std::make_shared<StreamingBulkReader>();
       AssetPackReadOptions Options;
+      // Unbuffered handle for large bulk reads (Options.bDirectIo on block-aligned packs)
+      std::unique_ptr<Pack::DirectFile> Direct;
 
       Pack::SnPakHeaderV1 Header;
-      std::vector<std::string> StringTable;
-      std::vector<Pack::SnPakIndexEntryV1> IndexEntries;
-      std::vector<Pack::SnPakBulkEntryV1> BulkEntries;
-      std::vector<Pack::SnPakDependencyOwnerV1> DependencyOwners;
-      std::vector<Pack::SnPakDependencyEntryV1> DependencyEntries;
 
+      // String table, resolved on demand from the mapped block (offsets are read unaligned)
+      const uint8_t* StringOffsets = nullptr;
+      uint32_t StringCount = 0;
+      std::span<const uint8_t> StringData;
+
+      // One index array: viewed in place inside the mapping, or for packs whose index arrays are
+      // compressed (IndexFlag_CompressedArrays) read through the index block cache, so only the
+      // blocks that are touched get decoded. Records are returned by value, which keeps them valid
+      // after their block is evicted.
+      template <typename T>
+      class IndexArray
+      {
+      public:
+          IndexArray() = default;
+          explicit IndexArray(const std::span<const T> InPlace) : m_InPlace(InPlace), m_Size(InPlace.size()) {}
+          IndexArray(const Impl& Owner, const size_t Array, const size_t Size) : m_Owner(&Owner), m_Array(Array), m_Size(Size) {}
+
+          size_t size() const { return m_Size; }
+          bool empty() const { return m_Size == 0; }
+
+          T operator[](const size_t Index) const
+          {
+            if (m_Owner == nullptr)
+            {
+              return m_InPlace[Index];
+            }
+            T Record;
+            m_Owner->ReadIndexRecord(m_Array, Index, sizeof(T), &Record);
+            return Record;
+          }
+
+      private:
+          std::span<const T> m_InPlace;
+          const Impl* m_Owner = nullptr;
+          size_t m_Array = 0;
+          size_t m_Size = 0;
+      };
+
+      bool bIndexCompressed = false;
+      IndexArray<Pack::SnPakIndexEntryV1> IndexEntries;
+      IndexArray<Pack::SnPakBulkEntryV1> BulkEntries;
+      IndexArray<Pack::SnPakDependencyOwnerV1> DependencyOwners;
+      IndexArray<Pack::SnPakDependencyEntryV1> DependencyEntries;
+
+      // Block table of a compressed index (viewed in the mapping) and its recently decoded blocks,
+      // most recent first, bounded by Options.IndexBlockCacheSize
+      Pack::IndexBlockTable IndexBlocks;
+      struct CachedIndexBlock
+      {
+          uint64_t Key = 0; // array in the top byte, block number below
+          std::vector<uint8_t> Records;
+      };
+      mutable std::mutex IndexCacheMutex;
+      mutable std::list<CachedIndexBlock> IndexCache;
+      mutable std::unordered_map<uint64_t, std::list<CachedIndexBlock>::iterator> IndexCacheLookup;
+      mutable uint64_t IndexCacheBytes = 0;
+
+      // Precomputed lookup tables viewed in the mapping (packs written with a lookup block)
+      std::span<const Pack::SnPakIdLookupEntryV1> LookupIds;
+      std::span<const Pack::SnPakNameBucketV1> NameBuckets;
+      bool bHasLookupBlock = false;
+      bool bDependencyOwnersSorted = true;
+
+      // Prepared decoder dictionaries from the dictionary block (packs written with dictionaries)
+      Pack::ZstdDictionarySet Dictionaries;
+
+      // Recently decoded solid blocks by chunk offset, most recent first, bounded by
+      // Options.SolidBlockCacheSize. Views keep their block alive after it is evicted.
+      struct CachedSolidBlock
+      {
+          uint64_t Offset = 0;
+          std::shared_ptr<const std::vector<uint8_t>> Bytes;
+      };
+      mutable std::mutex SolidCacheMutex;
+      mutable std::list<CachedSolidBlock> SolidCache;
+      mutable uint64_t SolidCacheBytes = 0;
+
+      // Fallback lookups, only built for packs without a lookup block / unsorted dependency owners
       std::unordered_map<AssetId, uint32_t, UuidHash> AssetIdToIndex;
       std::unordered_map<uint64_t, std::vector<uint32_t>> NameHashToIndices;
       std::unordered_map<uint32_t, uint32_t> AssetIndexToDependencyOwnerIndex;
 
       bool bOpen = false;
+      uint64_t OpenSerial = 0;
 
       // Validated file size (minimum of actual file size and header-reported size)
       uint64_t ValidatedFileSize = 0;
@@ -67,27 +243,35 @@ namespace SnAPI::AssetPipeline
         return true;
       }
 
-      // ─────────────────────────────────────────────────────────────────────────
-      // FIX #2: ReadExact - Check every read() succeeded (short read detection)
-      // ─────────────────────────────────────────────────────────────────────────
-      bool ReadExact(void* Dst, size_t Bytes) const
+      // Bounds-checked pointer into the mapping (nullptr if the range is invalid)
+      const uint8_t* MapRange(uint64_t Offset, uint64_t Size) const
+      {
+        if (!CheckRange(Offset, Size))
+        {
+          return nullptr;
+        }
+        return MappedReader->GetData() + Offset;
+      }
+
+      // SnPAK structs are byte-packed, so arrays of them can be viewed in place in the mapping
+      template <typename T>
+      static std::span<const T> ViewArray(const uint8_t* Data, size_t Count)
       {
-        File.read(reinterpret_cast<char*>(Dst), static_cast<std::streamsize>(Bytes));
-        return File.good() && static_cast<size_t>(File.gcount()) == Bytes;
+        static_assert(alignof(T) == 1, "SnPAK records must be byte-packed to be viewed in place");
+        return {reinterpret_cast<const T*>(Data), Count};
       }
 
-      bool SeekAndReadExact(uint64_t Offset, void* Dst, size_t Bytes) const
+      // Resolve a string id; returns an empty view for out-of-range ids
+      std::string_view GetString(uint32_t StringId) const
       {
-        if (!CheckRange(Offset, Bytes))
+        if (StringId >= StringCount)
         {
-          return false;
-        }
-        File.seekg(static_cast<std::streamoff>(Offset), std::ios::beg);
-        if (!File.good())
-        {
-          return false;
+          return {};
         }
-        return ReadExact(Dst, Bytes);
+        uint32_t Offset = 0;
+        std::memcpy(&Offset, StringOffsets + static_cast<size_t>(StringId) * sizeof(uint32_t), sizeof(Offset));
+        // Offsets and the trailing terminator were validated in ReadStringTable
+        return std::string_view(reinterpret_cast<const char*>(StringData.data() + Offset));
       }
 
       // ─────────────────────────────────────────────────────────────────────────
@@ -107,12 +291,15 @@ namespace SnAPI::AssetPipeline
           return std::unexpected("String table size too small for header");
         }
 
-        Pack::SnPakStrBlockHeaderV1 StrHeader;
-        if (!SeekAndReadExact(Header.StringTableOffset, &StrHeader, sizeof(StrHeader)))
+        const uint8_t* Block = MapRange(Header.StringTableOffset, Header.StringTableSize);
+        if (Block == nullptr)
         {
           return std::unexpected("Failed to read string table header");
         }
 
+        Pack::SnPakStrBlockHeaderV1 StrHeader;
+        std::memcpy(&StrHeader, Block, sizeof(StrHeader));
+
         // Validate magic
         if (std::memcmp(StrHeader.Magic, Pack::kStringMagic, 4) != 0)
         {
@@ -145,72 +332,42 @@ namespace SnAPI::AssetPipeline
           return std::unexpected("String table BlockSize too small for offset array");
         }
 
-        // FIX #7: Validate entire block is within file bounds
-        if (!CheckRange(Header.StringTableOffset, StrHeader.BlockSize))
-        {
-          return std::unexpected("String table block exceeds file bounds");
-        }
-
-        // Read offsets array
-        std::vector<uint32_t> Offsets(StrHeader.StringCount);
-        if (StrHeader.StringCount > 0)
-        {
-          if (!ReadExact(Offsets.data(), OffsetsSize))
-          {
-            return std::unexpected("Failed to read string table offsets");
-          }
-        }
-
-        // Calculate and read string data
-        size_t StringDataSize = StrHeader.BlockSize - sizeof(Pack::SnPakStrBlockHeaderV1) - OffsetsSize;
-        std::vector<uint8_t> StringData(StringDataSize);
-        if (StringDataSize > 0)
-        {
-          if (!ReadExact(StringData.data(), StringDataSize))
-          {
-            return std::unexpected("Failed to read string data");
-          }
-        }
+        const uint8_t* Offsets = Block + sizeof(Pack::SnPakStrBlockHeaderV1);
+        size_t StringDataSize = StrHeader.BlockSize - MinExpected;
+        std::span<const uint8_t> Data(Offsets + OffsetsSize, StringDataSize);
 
         if (Options.bVerifyStringTableHash)
         {
           // Verify hash of string data
-          XXH128_hash_t Hash = XXH3_128bits(StringData.data(), StringData.size());
+          XXH128_hash_t Hash = XXH3_128bits(Data.data(), Data.size());
           if (Hash.high64 != StrHeader.HashHi || Hash.low64 != StrHeader.HashLo)
           {
             return std::unexpected("String table hash mismatch - data corrupted");
           }
         }
 
-        // FIX #5: Safe string parsing with offset bounds and null terminator checks
-        StringTable.clear();
-        StringTable.reserve(StrHeader.StringCount);
-
+        // FIX #5: Validate every offset up front so lookups can stay branch-free.
+        // Strings are resolved lazily; a terminator at the end of the data block guarantees
+        // that every in-bounds offset finds its null terminator.
+        if (StrHeader.StringCount > 0 && (StringDataSize == 0 || Data.back() != 0))
+        {
+          return std::unexpected("String table data missing null terminator");
+        }
         for (uint32_t i = 0; i < StrHeader.StringCount; ++i)
         {
-          uint32_t Offset = Offsets[i];
+          uint32_t Offset = 0;
+          std::memcpy(&Offset, Offsets + static_cast<size_t>(i) * sizeof(uint32_t), sizeof(Offset));
 
           // FIX #5: Validate offset is within string data bounds
           if (Offset >= StringDataSize)
           {
             return std::unexpected("String offset " + std::to_string(i) + " out of bounds");
           }
-
-          // FIX #5: Find null terminator within remaining bounds
-          const uint8_t* Start = StringData.data() + Offset;
-          size_t MaxLen = StringDataSize - Offset;
-          const void* NullPos = std::memchr(Start, 0, MaxLen);
-
-          if (NullPos == nullptr)
-          {
-            return std::unexpected("String " + std::to_string(i) + " missing null terminator");
-          }
-
-          // FIX #5: Construct string with explicit length
-          size_t StrLen = static_cast<const uint8_t*>(NullPos) - Start;
-          StringTable.emplace_back(reinterpret_cast<const char*>(Start), StrLen);
         }
 
+        StringOffsets = Offsets;
+        StringCount = StrHeader.StringCount;
+        StringData = Data;
         return {};
       }
 
@@ -231,12 +388,15 @@ namespace SnAPI::AssetPipeline
           return std::unexpected("Index size too small for header");
         }
 
-        Pack::SnPakIndexHeaderV1 IdxHeader;
-        if (!SeekAndReadExact(Header.IndexOffset, &IdxHeader, sizeof(IdxHeader)))
+        const uint8_t* Block = MapRange(Header.IndexOffset, Header.IndexSize);
+        if (Block == nullptr)
         {
           return std::unexpected("Failed to read index header");
         }
 
+        Pack::SnPakIndexHeaderV1 IdxHeader;
+        std::memcpy(&IdxHeader, Block, sizeof(IdxHeader));
+
         // Validate magic
         if (std::memcmp(IdxHeader.Magic, Pack::kIndexMagic, 4) != 0)
         {
@@ -280,91 +440,60 @@ namespace SnAPI::AssetPipeline
         size_t BulkEntriesSize = static_cast<size_t>(IdxHeader.BulkEntryCount) * sizeof(Pack::SnPakBulkEntryV1);
         size_t DependencyOwnersSize = static_cast<size_t>(DependencyOwnerCount) * sizeof(Pack::SnPakDependencyOwnerV1);
         size_t DependencyEntriesSize = static_cast<size_t>(DependencyEntryCount) * sizeof(Pack::SnPakDependencyEntryV1);
-        size_t ExpectedSize = sizeof(Pack::SnPakIndexHeaderV1) + EntriesSize + BulkEntriesSize + DependencyOwnersSize + DependencyEntriesSize;
-
-        if (IdxHeader.BlockSize != ExpectedSize)
-        {
-          return std::unexpected("Index BlockSize does not match expected size for entry counts");
-        }
-
-        // FIX #6: Validate entire block is within file bounds
-        if (!CheckRange(Header.IndexOffset, IdxHeader.BlockSize))
-        {
-          return std::unexpected("Index block exceeds file bounds");
-        }
+        size_t ArraysSize = EntriesSize + BulkEntriesSize + DependencyOwnersSize + DependencyEntriesSize;
+        const std::span<const uint8_t> StoredArrays(Block + sizeof(Pack::SnPakIndexHeaderV1), IdxHeader.BlockSize - sizeof(Pack::SnPakIndexHeaderV1));
 
-        // Read entries
-        IndexEntries.resize(IdxHeader.EntryCount);
-        if (IdxHeader.EntryCount > 0)
+        bIndexCompressed = (Pack::GetIndexFlags(IdxHeader) & Pack::IndexFlag_CompressedArrays) != 0;
+        if (bIndexCompressed)
         {
-          if (!ReadExact(IndexEntries.data(), EntriesSize))
+          // Only the block table is read here; blocks are decoded when their records are used
+          try
           {
-            return std::unexpected("Failed to read index entries");
+            IndexBlocks = Pack::IndexBlockTable(StoredArrays, Pack::GetIndexArrayLayout(IdxHeader));
           }
-        }
-
-        // Read bulk entries
-        BulkEntries.resize(IdxHeader.BulkEntryCount);
-        if (IdxHeader.BulkEntryCount > 0)
-        {
-          if (!ReadExact(BulkEntries.data(), BulkEntriesSize))
-          {
-            return std::unexpected("Failed to read bulk entries");
-          }
-        }
-
-        DependencyOwners.resize(DependencyOwnerCount);
-        if (DependencyOwnerCount > 0)
-        {
-          if (!ReadExact(DependencyOwners.data(), DependencyOwnersSize))
+          catch (const std::exception& Ex)
           {
-            return std::unexpected("Failed to read dependency owner entries");
+            return std::unexpected(std::string("Invalid compressed index: ") + Ex.what());
           }
-        }
+          IndexEntries = {*this, 0, IdxHeader.EntryCount};
+          BulkEntries = {*this, 1, IdxHeader.BulkEntryCount};
+          DependencyOwners = {*this, 2, DependencyOwnerCount};
+          DependencyEntries = {*this, 3, DependencyEntryCount};
 
-        DependencyEntries.resize(DependencyEntryCount);
-        if (DependencyEntryCount > 0)
-        {
-          if (!ReadExact(DependencyEntries.data(), DependencyEntriesSize))
+          if (Options.bVerifyIndexEntriesHash)
           {
-            return std::unexpected("Failed to read dependency entries");
+            auto HashResult = VerifyCompressedIndexHash(IdxHeader);
+            if (!HashResult.has_value())
+            {
+              return HashResult;
+            }
           }
         }
-
-        if (Options.bVerifyIndexEntriesHash)
+        else
         {
-          // FIX #8: Use streaming xxhash API to avoid large copy buffer
-          XXH3_state_t* State = XXH3_createState();
-          if (State == nullptr)
-          {
-            return std::unexpected("Failed to create hash state");
-          }
-
-          XXH3_128bits_reset(State);
-
-          if (!IndexEntries.empty())
-          {
-            XXH3_128bits_update(State, IndexEntries.data(), EntriesSize);
-          }
-          if (!BulkEntries.empty())
-          {
-            XXH3_128bits_update(State, BulkEntries.data(), BulkEntriesSize);
-          }
-          if (!DependencyOwners.empty())
-          {
-            XXH3_128bits_update(State, DependencyOwners.data(), DependencyOwnersSize);
-          }
-          if (!DependencyEntries.empty())
+          if (StoredArrays.size() != ArraysSize)
           {
-            XXH3_128bits_update(State, DependencyEntries.data(), DependencyEntriesSize);
+            return std::unexpected("Index BlockSize does not match expected size for entry counts");
           }
 
-          XXH128_hash_t Hash = XXH3_128bits_digest(State);
-          XXH3_freeState(State);
-
-          if (Hash.high64 != IdxHeader.EntriesHashHi || Hash.low64 != IdxHeader.EntriesHashLo)
+          // View the arrays in place (the block range was validated above)
+          const uint8_t* Cursor = StoredArrays.data();
+          IndexEntries = IndexArray(ViewArray<Pack::SnPakIndexEntryV1>(Cursor, IdxHeader.EntryCount));
+          Cursor += EntriesSize;
+          BulkEntries = IndexArray(ViewArray<Pack::SnPakBulkEntryV1>(Cursor, IdxHeader.BulkEntryCount));
+          Cursor += BulkEntriesSize;
+          DependencyOwners = IndexArray(ViewArray<Pack::SnPakDependencyOwnerV1>(Cursor, DependencyOwnerCount));
+          Cursor += DependencyOwnersSize;
+          DependencyEntries = IndexArray(ViewArray<Pack::SnPakDependencyEntryV1>(Cursor, DependencyEntryCount));
+
+          if (Options.bVerifyIndexEntriesHash)
           {
-            return std::unexpected("Index entries hash mismatch - data corrupted");
+            // Entries, bulk entries and dependency arrays are contiguous after the index header
+            XXH128_hash_t Hash = XXH3_128bits(StoredArrays.data(), ArraysSize);
+            if (Hash.high64 != IdxHeader.EntriesHashHi || Hash.low64 != IdxHeader.EntriesHashLo)
+            {
+              return std::unexpected("Index entries hash mismatch - data corrupted");
+            }
           }
         }
 
@@ -373,195 +502,667 @@ namespace SnAPI::AssetPipeline
           // FIX #4: Verify the header's IndexHash against the entire index block
           // The header stores a hash of the complete index block (header + entries + bulk entries)
           // This provides an additional integrity check at a different level than EntriesHash
-          XXH3_state_t* BlockState = XXH3_createState();
-          if (BlockState == nullptr)
-          {
-            return std::unexpected("Failed to create hash state for index block");
-          }
-
-          XXH3_128bits_reset(BlockState);
-
-          // Hash the index header (includes EntriesHashHi/Lo as written)
-          XXH3_128bits_update(BlockState, &IdxHeader, sizeof(IdxHeader));
-
-          // Hash entries and bulk entries
-          if (!IndexEntries.empty())
-          {
-            XXH3_128bits_update(BlockState, IndexEntries.data(), EntriesSize);
-          }
-          if (!BulkEntries.empty())
-          {
-            XXH3_128bits_update(BlockState, BulkEntries.data(), BulkEntriesSize);
-          }
-          if (!DependencyOwners.empty())
-          {
-            XXH3_128bits_update(BlockState, DependencyOwners.data(), DependencyOwnersSize);
-          }
-          if (!DependencyEntries.empty())
-          {
-            XXH3_128bits_update(BlockState, DependencyEntries.data(), DependencyEntriesSize);
-          }
-
-          XXH128_hash_t BlockHash = XXH3_128bits_digest(BlockState);
-          XXH3_freeState(BlockState);
-
+          XXH128_hash_t BlockHash = XXH3_128bits(Block, IdxHeader.BlockSize);
           if (BlockHash.high64 != Header.IndexHashHi || BlockHash.low64 != Header.IndexHashLo)
           {
             return std::unexpected("Index block hash mismatch with header - data corrupted");
           }
         }
 
-        // Build lookup maps
+        auto LookupResult = ReadLookupBlock(IdxHeader);
+        if (!LookupResult.has_value())
+        {
+          return std::unexpected("Invalid lookup block: " + LookupResult.error());
+        }
+
+        // Packs without a lookup block fall back to hash maps built here
         AssetIdToIndex.clear();
         NameHashToIndices.clear();
         AssetIndexToDependencyOwnerIndex.clear();
-
-        for (uint32_t i = 0; i < IndexEntries.size(); ++i)
+        if (!bHasLookupBlock)
         {
-          AssetId Id;
-          std::memcpy(Id.Bytes, IndexEntries[i].AssetId, 16);
-          AssetIdToIndex[Id] = i;
-          NameHashToIndices[IndexEntries[i].NameHash64].push_back(i);
+          AssetIdToIndex.reserve(IndexEntries.size());
+          for (uint32_t i = 0; i < IndexEntries.size(); ++i)
+          {
+            AssetId Id;
+            std::memcpy(Id.Bytes, IndexEntries[i].AssetId, 16);
+            AssetIdToIndex[Id] = i;
+            NameHashToIndices[IndexEntries[i].NameHash64].push_back(i);
+          }
         }
 
+        // Owners written in asset order are binary-searched; anything else gets a map. Compressed
+        // indexes are written in asset order and are not scanned here, so opening them decodes no
+        // dependency blocks; their records are validated as they are read instead.
+        bDependencyOwnersSorted = true;
+        if (bIndexCompressed)
+        {
+          return {};
+        }
         for (uint32_t OwnerIndex = 0; OwnerIndex < DependencyOwners.size(); ++OwnerIndex)
         {
-          const auto& Owner = DependencyOwners[OwnerIndex];
-          if (Owner.AssetIndex >= IndexEntries.size())
+          const auto Owner = DependencyOwners[OwnerIndex];
+          auto OwnerResult = ValidateDependencyOwner(Owner);
+          if (!OwnerResult.has_value())
           {
-            return std::unexpected("Dependency owner references invalid asset index");
+            return OwnerResult;
           }
-          if (Owner.FirstDependencyIndex > DependencyEntries.size() ||
-              Owner.DependencyCount > DependencyEntries.size() - Owner.FirstDependencyIndex)
+          if (OwnerIndex > 0 && Owner.AssetIndex <= DependencyOwners[OwnerIndex - 1].AssetIndex)
           {
-            return std::unexpected("Dependency owner references invalid dependency range");
+            bDependencyOwnersSorted = false;
           }
-          if (!AssetIndexToDependencyOwnerIndex.emplace(Owner.AssetIndex, OwnerIndex).second)
+        }
+        if (!bDependencyOwnersSorted)
+        {
+          for (uint32_t OwnerIndex = 0; OwnerIndex < DependencyOwners.size(); ++OwnerIndex)
           {
-            return std::unexpected("Duplicate dependency owner for asset index");
+            if (!AssetIndexToDependencyOwnerIndex.emplace(DependencyOwners[OwnerIndex].AssetIndex, OwnerIndex).second)
+            {
+              return std::unexpected("Duplicate dependency owner for asset index");
+            }
           }
         }
 
-        for (const auto& Dependency : DependencyEntries)
+        for (size_t DependencyIndex = 0; DependencyIndex < DependencyEntries.size(); ++DependencyIndex)
         {
-          if (Dependency.LogicalNameStringId != Pack::kInvalidStringId &&
-              Dependency.LogicalNameStringId >= StringTable.size())
-          {
-            return std::unexpected("Dependency logical name string id out of range");
-          }
-          if (Dependency.Kind > static_cast<uint8_t>(EAssetDependencyKind::Auxiliary))
+          auto DependencyResult = ValidateDependency(DependencyEntries[DependencyIndex]);
+          if (!DependencyResult.has_value())
           {
-            return std::unexpected("Dependency kind value is invalid");
+            return DependencyResult;
           }
         }
 
         return {};
       }
 
-      // ─────────────────────────────────────────────────────────────────────────
-      // FIX #3 & #4 & #6: LoadChunk with size validation and chunk identity checks
-      // FIX #4 (mutex): Each call opens its own file stream for true parallelism
-      // FIX #6: Added ExpectedBulkAssetId for bulk chunk AssetId validation
-      // ─────────────────────────────────────────────────────────────────────────
-      std::expected<std::vector<uint8_t>, std::string> LoadChunk(uint64_t Offset, uint64_t ExpectedTotalSize, uint64_t ExpectedUncompressedSize,
-                                                                 const Pack::SnPakIndexEntryV1* ExpectedEntry = nullptr,
-                                                                 const Pack::SnPakBulkEntryV1* ExpectedBulkEntry = nullptr,
-                                                                 const uint8_t* ExpectedBulkAssetId = nullptr) const
+      std::expected<void, std::string> ValidateDependencyOwner(const Pack::SnPakDependencyOwnerV1& Owner) const
       {
-        if (!MappedReader.IsOpen())
+        if (Owner.AssetIndex >= IndexEntries.size())
         {
-          return std::unexpected("Pack file is not memory-mapped");
+          return std::unexpected("Dependency owner references invalid asset index");
+        }
+        if (Owner.FirstDependencyIndex > DependencyEntries.size() ||
+            Owner.DependencyCount > DependencyEntries.size() - Owner.FirstDependencyIndex)
+        {
+          return std::unexpected("Dependency owner references invalid dependency range");
         }
+        return {};
+      }
 
-        // FIX #3: Validate chunk location against file bounds using INDEX size
-        if (Options.bValidateChunkBounds)
+      std::expected<void, std::string> ValidateDependency(const Pack::SnPakDependencyEntryV1& Dependency) const
+      {
+        if (Dependency.LogicalNameStringId != Pack::kInvalidStringId &&
+            Dependency.LogicalNameStringId >= StringCount)
         {
-          if (!CheckRange(Offset, ExpectedTotalSize))
+          return std::unexpected("Dependency logical name string id out of range");
+        }
+        if (Dependency.Kind > static_cast<uint8_t>(EAssetDependencyKind::Auxiliary))
+        {
+          return std::unexpected("Dependency kind value is invalid");
+        }
+        return {};
+      }
+
+      // EntriesHash of a compressed index covers the decoded arrays; they are streamed through the
+      // hash one block at a time instead of being held in memory together
+      std::expected<void, std::string> VerifyCompressedIndexHash(const Pack::SnPakIndexHeaderV1& IdxHeader) const
+      {
+        const std::unique_ptr<XXH3_state_t, decltype(&XXH3_freeState)> State(XXH3_createState(), &XXH3_freeState);
+        if (!State || XXH3_128bits_reset(State.get()) != XXH_OK)
+        {
+          return std::unexpected("Failed to create index hash state");
+        }
+        std::vector<uint8_t> Records;
+        for (size_t Array = 0; Array < Pack::GetIndexArrayLayout(IdxHeader).size(); ++Array)
+        {
+          for (size_t Block = 0; Block < IndexBlocks.GetBlockCount(Array); ++Block)
           {
-            return std::unexpected("Chunk offset/size exceeds file bounds");
+            Records.resize(IndexBlocks.GetBlockSize(Array, Block));
+            try
+            {
+              IndexBlocks.DecodeBlock(Array, Block, Records);
+            }
+            catch (const std::exception& Ex)
+            {
+              return std::unexpected(std::string("Failed to decode compressed index: ") + Ex.what());
+            }
+            XXH3_128bits_update(State.get(), Records.data(), Records.size());
           }
         }
+        const XXH128_hash_t Hash = XXH3_128bits_digest(State.get());
+        if (Hash.high64 != IdxHeader.EntriesHashHi || Hash.low64 != IdxHeader.EntriesHashLo)
+        {
+          return std::unexpected("Index entries hash mismatch - data corrupted");
+        }
+        return {};
+      }
+
+      // Copy record Index of compressed index array Array into Out, decoding (and caching) its
+      // block on a miss. A block that fails to decode reads as zeroed records: no lookup matches
+      // them and chunk reads through them fail validation.
+      void ReadIndexRecord(const size_t Array, const size_t Index, const size_t RecordSize, void* Out) const
+      {
+        const size_t RecordsPerBlock = IndexBlocks.GetRecordsPerBlock(Array);
+        const size_t Block = Index / RecordsPerBlock;
+        const size_t Offset = (Index % RecordsPerBlock) * RecordSize;
+        const uint64_t Key = (static_cast<uint64_t>(Array) << 56) | Block;
+
+        // Caller holds IndexCacheMutex; a hit moves the block to the front
+        auto CopyCached = [&]() {
+          const auto It = IndexCacheLookup.find(Key);
+          if (It == IndexCacheLookup.end())
+          {
+            return false;
+          }
+          IndexCache.splice(IndexCache.begin(), IndexCache, It->second);
+          std::memcpy(Out, It->second->Records.data() + Offset, RecordSize);
+          return true;
+        };
 
-        // Ensure minimum size for chunk header
-        if (Options.bValidateChunkSizes)
         {
-          if (ExpectedTotalSize < sizeof(Pack::SnPakChunkHeaderV1))
+          std::lock_guard Lock(IndexCacheMutex);
+          if (CopyCached())
           {
-            return std::unexpected("Chunk total size too small for header");
+            return;
           }
         }
 
-        Pack::SnPakChunkHeaderV1 ChunkHeader;
-        auto HeaderSpanResult = MappedReader.ReadChunk(Offset, sizeof(ChunkHeader));
-        if (!HeaderSpanResult.has_value())
+        std::vector<uint8_t> Records(IndexBlocks.GetBlockSize(Array, Block));
+        try
         {
-          return std::unexpected("Failed to read chunk header: " + HeaderSpanResult.error());
+          IndexBlocks.DecodeBlock(Array, Block, Records);
         }
-        std::memcpy(&ChunkHeader, HeaderSpanResult->data(), sizeof(ChunkHeader));
+        catch (const std::exception&)
+        {
+          std::memset(Out, 0, RecordSize);
+          return;
+        }
+        std::memcpy(Out, Records.data() + Offset, RecordSize);
 
-        // Validate magic
-        if (std::memcmp(ChunkHeader.Magic, Pack::kChunkMagic, 4) != 0)
+        const uint64_t Budget = Options.IndexBlockCacheSize;
+        if (Records.size() > Budget)
         {
-          return std::unexpected("Invalid chunk magic");
+          return;
+        }
+        std::lock_guard Lock(IndexCacheMutex);
+        // Another thread may have cached the same block meanwhile; keep its copy
+        if (IndexCacheLookup.contains(Key))
+        {
+          return;
+        }
+        IndexCacheBytes += Records.size();
+        IndexCache.push_front({Key, std::move(Records)});
+        IndexCacheLookup.emplace(Key, IndexCache.begin());
+        while (IndexCacheBytes > Budget)
+        {
+          IndexCacheBytes -= IndexCache.back().Records.size();
+          IndexCacheLookup.erase(IndexCache.back().Key);
+          IndexCache.pop_back();
         }
+      }
 
-        // Validate version
-        if (ChunkHeader.Version != 1)
+      // Validate and view the optional lookup block referenced from the index header
+      std::expected<void, std::string> ReadLookupBlock(const Pack::SnPakIndexHeaderV1& IdxHeader)
+      {
+        bHasLookupBlock = false;
+        LookupIds = {};
+        NameBuckets = {};
+        if ((Pack::GetIndexFlags(IdxHeader) & Pack::IndexFlag_HasLookupBlock) == 0)
         {
-          return std::unexpected("Unsupported chunk version: " + std::to_string(ChunkHeader.Version));
+          return {};
         }
 
-        // FIX #3: Verify chunk header sizes match index expectations
-        if (Options.bValidateChunkSizes)
+        const uint64_t LookupOffset = Pack::GetLookupBlockOffset(IdxHeader);
+        const uint64_t LookupSize = Pack::GetLookupBlockSize(IdxHeader);
+        if (LookupSize < sizeof(Pack::SnPakLookupHeaderV1))
         {
-          if (ChunkHeader.SizeUncompressed != ExpectedUncompressedSize)
-          {
-            return std::unexpected("Chunk uncompressed size mismatch with index");
-          }
+          return std::unexpected("Lookup block size too small for header");
+        }
+        const uint8_t* Block = MapRange(LookupOffset, LookupSize);
+        if (Block == nullptr)
+        {
+          return std::unexpected("Lookup block offset/size exceeds file bounds");
         }
 
-        uint64_t ExpectedCompressedDataSize = ExpectedTotalSize - sizeof(Pack::SnPakChunkHeaderV1);
-        if (Options.bValidateChunkSizes)
+        Pack::SnPakLookupHeaderV1 LookupHeader;
+        std::memcpy(&LookupHeader, Block, sizeof(LookupHeader));
+        if (std::memcmp(LookupHeader.Magic, Pack::kLookupMagic, 4) != 0)
         {
-          if (ChunkHeader.SizeCompressed != ExpectedCompressedDataSize)
-          {
-            return std::unexpected("Chunk compressed size mismatch with index");
-          }
+          return std::unexpected("Invalid lookup block magic");
+        }
+        if (LookupHeader.Version != 1)
+        {
+          return std::unexpected("Unsupported lookup block version: " + std::to_string(LookupHeader.Version));
+        }
+        if (LookupHeader.IdCount > IdxHeader.EntryCount)
+        {
+          return std::unexpected("Lookup id count exceeds index entry count");
+        }
+        const uint32_t BucketCount = LookupHeader.NameBucketCount;
+        if (IdxHeader.EntryCount == 0 ? BucketCount != 0 : (BucketCount <= IdxHeader.EntryCount || (BucketCount & (BucketCount - 1)) != 0))
+        {
+          return std::unexpected("Lookup name bucket count is invalid");
         }
 
-        // Sanity check sizes
-        if (Options.bValidateChunkSanity)
+        const size_t IdsSize = static_cast<size_t>(LookupHeader.IdCount) * sizeof(Pack::SnPakIdLookupEntryV1);
+        const size_t BucketsSize = static_cast<size_t>(BucketCount) * sizeof(Pack::SnPakNameBucketV1);
+        if (LookupHeader.BlockSize != LookupSize || LookupSize != sizeof(Pack::SnPakLookupHeaderV1) + IdsSize + BucketsSize)
         {
-          if (ChunkHeader.SizeCompressed > kMaxBlockSize)
-          {
-            return std::unexpected("Chunk compressed size exceeds sanity limit");
-          }
-          if (ChunkHeader.SizeUncompressed > kMaxBlockSize)
-          {
-            return std::unexpected("Chunk uncompressed size exceeds sanity limit");
-          }
+          return std::unexpected("Lookup block size does not match its counts");
         }
 
-        // FIX #4: Validate chunk identity for main payloads
-        if (ExpectedEntry != nullptr && Options.bValidateChunkIdentity)
+        if (Options.bVerifyIndexEntriesHash || Options.bVerifyIndexBlockHash)
         {
-          // Must be MainPayload kind
-          if (ChunkHeader.ChunkKind != static_cast<uint8_t>(Pack::ESnPakChunkKind::MainPayload))
+          XXH128_hash_t Hash = XXH3_128bits(Block + sizeof(Pack::SnPakLookupHeaderV1), IdsSize + BucketsSize);
+          if (Hash.high64 != LookupHeader.HashHi || Hash.low64 != LookupHeader.HashLo)
           {
-            return std::unexpected("Chunk kind mismatch - expected MainPayload");
+            return std::unexpected("Lookup block hash mismatch - data corrupted");
           }
+        }
 
-          // AssetId must match
-          if (!Pack::CompareUuid(ChunkHeader.AssetId, ExpectedEntry->AssetId))
-          {
-            return std::unexpected("Chunk AssetId mismatch with index entry");
-          }
+        LookupIds = ViewArray<Pack::SnPakIdLookupEntryV1>(Block + sizeof(Pack::SnPakLookupHeaderV1), LookupHeader.IdCount);
+        NameBuckets = ViewArray<Pack::SnPakNameBucketV1>(Block + sizeof(Pack::SnPakLookupHeaderV1) + IdsSize, BucketCount);
+        bHasLookupBlock = true;
+        return {};
+      }
 
-          // PayloadType must match
-          if (!Pack::CompareUuid(ChunkHeader.PayloadType, ExpectedEntry->CookedPayloadType))
-          {
-            return std::unexpected("Chunk PayloadType mismatch with index entry");
-          }
+      // Validate the optional dictionary block referenced from the header and prepare its dictionaries
+      std::expected<void, std::string> ReadDictionaryBlock()
+      {
+        Dictionaries.Clear();
+        if ((Header.Flags & Pack::SnPakFlag_HasDictionaries) == 0)
+        {
+          return {};
+        }
+
+        const uint64_t BlockOffset = Pack::GetDictionaryBlockOffset(Header);
+        const uint64_t BlockSize = Pack::GetDictionaryBlockSize(Header);
+        const uint8_t* Block = MapRange(BlockOffset, BlockSize);
+        if (Block == nullptr)
+        {
+          return std::unexpected("Dictionary block offset/size exceeds file bounds");
+        }
+
+        std::vector<Pack::DictionaryBlockEntry> Entries;
+        try
+        {
+          Entries = Pack::ParseDictionaryBlock(std::span<const uint8_t>(Block, static_cast<size_t>(BlockSize)));
+        }
+        catch (const std::exception& Ex)
+        {
+          return std::unexpected(Ex.what());
+        }
+        for (size_t Index = 0; Index < Entries.size(); ++Index)
+        {
+          if (!Dictionaries.Add(Entries[Index].Data))
+          {
+            return std::unexpected("Dictionary " + std::to_string(Index) + " is invalid or duplicated");
+          }
+        }
+        return {};
+      }
+
+      std::optional<uint32_t> FindAssetIndex(const AssetId& Id) const
+      {
+        if (!bHasLookupBlock)
+        {
+          auto It = AssetIdToIndex.find(Id);
+          if (It == AssetIdToIndex.end())
+          {
+            return std::nullopt;
+          }
+          return It->second;
+        }
+
+        // Eytzinger search: node k (1-based) has children 2k and 2k+1
+        size_t Node = 1;
+        while (Node <= LookupIds.size())
+        {
+          const auto& Candidate = LookupIds[Node - 1];
+          const int Cmp = std::memcmp(Candidate.AssetId, Id.Bytes, 16);
+          if (Cmp == 0)
+          {
+            // Cross-check against the index so a corrupted table cannot alias another asset
+            if (Candidate.AssetIndex < IndexEntries.size() && Pack::CompareUuid(IndexEntries[Candidate.AssetIndex].AssetId, Id.Bytes))
+            {
+              return Candidate.AssetIndex;
+            }
+            return std::nullopt;
+          }
+          Node = Node * 2 + (Cmp < 0 ? 1 : 0);
+        }
+        return std::nullopt;
+      }
+
+      // Visit every asset index whose name hash matches, in index order
+      template <typename VisitFn>
+      void ForEachAssetWithNameHash(const uint64_t NameHash, VisitFn&& Visit) const
+      {
+        if (!bHasLookupBlock)
+        {
+          auto It = NameHashToIndices.find(NameHash);
+          if (It != NameHashToIndices.end())
+          {
+            for (const uint32_t Index : It->second)
+            {
+              Visit(Index);
+            }
+          }
+          return;
+        }
+
+        if (NameBuckets.empty())
+        {
+          return;
+        }
+        const size_t Mask = NameBuckets.size() - 1;
+        size_t Slot = static_cast<size_t>(NameHash) & Mask;
+        for (size_t Probe = 0; Probe < NameBuckets.size(); ++Probe, Slot = (Slot + 1) & Mask)
+        {
+          const auto& Bucket = NameBuckets[Slot];
+          if (Bucket.AssetIndex == Pack::kEmptyNameBucket)
+          {
+            return;
+          }
+          if (Bucket.NameHash64 == NameHash && Bucket.AssetIndex < IndexEntries.size())
+          {
+            Visit(Bucket.AssetIndex);
+          }
+        }
+      }
+
+      std::optional<Pack::SnPakDependencyOwnerV1> FindDependencyOwner(const uint32_t AssetIndex) const
+      {
+        if (!bDependencyOwnersSorted)
+        {
+          auto It = AssetIndexToDependencyOwnerIndex.find(AssetIndex);
+          if (It == AssetIndexToDependencyOwnerIndex.end())
+          {
+            return std::nullopt;
+          }
+          return DependencyOwners[It->second];
+        }
+
+        size_t First = 0;
+        size_t Count = DependencyOwners.size();
+        while (Count > 0)
+        {
+          const size_t Step = Count / 2;
+          if (DependencyOwners[First + Step].AssetIndex < AssetIndex)
+          {
+            First += Step + 1;
+            Count -= Step + 1;
+          }
+          else
+          {
+            Count = Step;
+          }
+        }
+        if (First == DependencyOwners.size())
+        {
+          return std::nullopt;
+        }
+        // Compressed indexes validate owners here rather than at open
+        const auto Owner = DependencyOwners[First];
+        if (Owner.AssetIndex != AssetIndex || !ValidateDependencyOwner(Owner).has_value())
+        {
+          return std::nullopt;
+        }
+        return Owner;
+      }
+
+      void Reset()
+      {
+        // Outstanding views may still reference the old mapping; it is unmapped when the last one goes away
+        MappedReader = std::make_shared<StreamingBulkReader>();
+        Direct.reset();
+        bOpen = false;
+        OpenSerial = 0;
+        ValidatedFileSize = 0;
+        StringOffsets = nullptr;
+        StringCount = 0;
+        StringData = {};
+        bIndexCompressed = false;
+        IndexEntries = {};
+        BulkEntries = {};
+        DependencyOwners = {};
+        DependencyEntries = {};
+        IndexBlocks = {};
+        {
+          std::lock_guard Lock(IndexCacheMutex);
+          IndexCache.clear();
+          IndexCacheLookup.clear();
+          IndexCacheBytes = 0;
+        }
+        LookupIds = {};
+        NameBuckets = {};
+        bHasLookupBlock = false;
+        bDependencyOwnersSorted = true;
+        Dictionaries.Clear();
+        {
+          std::lock_guard Lock(SolidCacheMutex);
+          SolidCache.clear();
+          SolidCacheBytes = 0;
+        }
+        AssetIdToIndex.clear();
+        NameHashToIndices.clear();
+        AssetIndexToDependencyOwnerIndex.clear();
+      }
+
+      // Map the file once and parse header, string table and index straight from the mapping
+      std::expected<void, std::string> OpenMapped(const std::string& Path)
+      {
+        MappedReader = std::make_shared<StreamingBulkReader>();
+        auto MapResult = MappedReader->Open(Path);
+        if (!MapResult.has_value())
+        {
+          return std::unexpected("Failed to memory-map pack: " + MapResult.error());
+        }
+
+        // ─────────────────────────────────────────────────────────────────────────
+        // FIX #1: Get actual file size for bounds validation
+        // ─────────────────────────────────────────────────────────────────────────
+        const uint64_t ActualFileSize = MappedReader->GetPackSize();
+
+        // Must be at least large enough for the header
+        if (ActualFileSize < sizeof(Pack::SnPakHeaderV1))
+        {
+          return std::unexpected("File too small to contain header");
+        }
+
+        // Read header
+        std::memcpy(&Header, MappedReader->GetData(), sizeof(Pack::SnPakHeaderV1));
+
+        // Validate magic
+        if (std::memcmp(Header.Magic, Pack::kSnPakMagic, 8) != 0)
+        {
+          return std::unexpected("Invalid pack file magic");
+        }
+
+        // Validate version
+        if (Header.Version != Pack::kSnPakVersion)
+        {
+          return std::unexpected("Unsupported pack version: " + std::to_string(Header.Version));
+        }
+
+        // ─────────────────────────────────────────────────────────────────────────
+        // FIX #9: Validate Header.HeaderSize
+        // ─────────────────────────────────────────────────────────────────────────
+        if (Header.HeaderSize != sizeof(Pack::SnPakHeaderV1))
+        {
+          return std::unexpected("Header size mismatch - expected " + std::to_string(sizeof(Pack::SnPakHeaderV1)) + ", got " +
+                                 std::to_string(Header.HeaderSize));
+        }
+
+        // Validate endian marker
+        if (Header.EndianMarker != Pack::kEndianMarker)
+        {
+          return std::unexpected("Endian mismatch - pack was created on different architecture");
+        }
+
+        // FIX #1: Use minimum of header FileSize and actual file size
+        // This prevents issues with truncated files or oversized headers
+        if (Header.FileSize > ActualFileSize)
+        {
+          return std::unexpected("Header FileSize (" + std::to_string(Header.FileSize) + ") exceeds actual file size (" +
+                                 std::to_string(ActualFileSize) + ")");
+        }
+        ValidatedFileSize = Header.FileSize;
+
+        // Read string table
+        auto StrResult = ReadStringTable();
+        if (!StrResult.has_value())
+        {
+          return std::unexpected("Failed to read string table: " + StrResult.error());
+        }
+
+        auto DictResult = ReadDictionaryBlock();
+        if (!DictResult.has_value())
+        {
+          return std::unexpected("Failed to read dictionaries: " + DictResult.error());
+        }
+
+        // Read index
+        auto IdxResult = ReadIndex();
+        if (!IdxResult.has_value())
+        {
+          return std::unexpected("Failed to read index: " + IdxResult.error());
+        }
+
+        return {};
+      }
+
+      // ─────────────────────────────────────────────────────────────────────────
+      // FIX #3 & #4 & #6: LoadChunk with size validation and chunk identity checks
+      // FIX #4 (mutex): Each call opens its own file stream for true parallelism
+      // FIX #6: Added ExpectedBulkAssetId for bulk chunk AssetId validation
+      // ─────────────────────────────────────────────────────────────────────────
+      struct MappedChunk
+      {
+          Pack::SnPakChunkHeaderV1 Header;
+          std::span<const uint8_t> Data; // Stored bytes: compressed unless Header.Compression is None
+          std::shared_ptr<const void> Owner; // staged buffer holding Data; nullptr when Data is in the mapping
+      };
+
+      // What keeps a chunk's stored bytes alive for zero-copy views
+      std::shared_ptr<const void> GetChunkOwner(const MappedChunk& Chunk) const
+      {
+        return Chunk.Owner ? Chunk.Owner : std::shared_ptr<const void>(MappedReader);
+      }
+
+      // Staged range of this open covering [Offset, Offset + Size) on the calling thread, if any
+      const PackStagedRange* FindStagedRange(const uint64_t Offset, const uint64_t Size) const
+      {
+        const PackStagedReads* Staged = t_StagedReads;
+        if (Staged == nullptr || Staged->ReaderSerial != OpenSerial)
+        {
+          return nullptr;
+        }
+        for (const PackStagedRange& Range : Staged->Ranges)
+        {
+          if (Range.Bytes && Offset >= Range.Offset && Size <= Range.Size && Offset - Range.Offset <= Range.Size - Size)
+          {
+            return &Range;
+          }
+        }
+        return nullptr;
+      }
+
+      // Header checks shared by the mapped and direct read paths
+      std::expected<void, std::string> ValidateChunkHeader(const Pack::SnPakChunkHeaderV1& ChunkHeader, uint64_t ExpectedTotalSize,
+                                                           uint64_t ExpectedUncompressedSize, const Pack::SnPakIndexEntryV1* ExpectedEntry,
+                                                           const Pack::SnPakBulkEntryV1* ExpectedBulkEntry,
+                                                           const uint8_t* ExpectedBulkAssetId) const
+      {
+        // Validate magic
+        if (std::memcmp(ChunkHeader.Magic, Pack::kChunkMagic, 4) != 0)
+        {
+          return std::unexpected("Invalid chunk magic");
+        }
+
+        // Validate version
+        if (ChunkHeader.Version != 1)
+        {
+          return std::unexpected("Unsupported chunk version: " + std::to_string(ChunkHeader.Version));
+        }
+
+        // Solid members only reference a slice of the block chunk
+        const bool bSolidMember = ExpectedEntry != nullptr && (ExpectedEntry->Flags & Pack::IndexEntryFlag_SolidBlock) != 0;
+
+        // FIX #3: Verify chunk header sizes match index expectations
+        if (Options.bValidateChunkSizes && !bSolidMember)
+        {
+          if (ChunkHeader.SizeUncompressed != ExpectedUncompressedSize)
+          {
+            return std::unexpected("Chunk uncompressed size mismatch with index");
+          }
+        }
+
+        if (bSolidMember)
+        {
+          const uint64_t MemberOffset = Pack::GetSolidMemberOffset(*ExpectedEntry);
+          if (MemberOffset > ChunkHeader.SizeUncompressed || Pack::GetPayloadSize(*ExpectedEntry) > ChunkHeader.SizeUncompressed - MemberOffset)
+          {
+            return std::unexpected("Solid block member exceeds its block");
+          }
+        }
+
+        uint64_t ExpectedCompressedDataSize = ExpectedTotalSize - sizeof(Pack::SnPakChunkHeaderV1);
+        if (Options.bValidateChunkSizes)
+        {
+          if (ChunkHeader.SizeCompressed != ExpectedCompressedDataSize)
+          {
+            return std::unexpected("Chunk compressed size mismatch with index");
+          }
+        }
+
+        // Sanity check sizes
+        if (Options.bValidateChunkSanity)
+        {
+          if (ChunkHeader.SizeCompressed > kMaxBlockSize)
+          {
+            return std::unexpected("Chunk compressed size exceeds sanity limit");
+          }
+          if (ChunkHeader.SizeUncompressed > kMaxBlockSize)
+          {
+            return std::unexpected("Chunk uncompressed size exceeds sanity limit");
+          }
+        }
+
+        // Solid blocks hold payloads of many assets; only the block kind and codec are checked
+        if (bSolidMember && Options.bValidateChunkIdentity)
+        {
+          if (ChunkHeader.ChunkKind != static_cast<uint8_t>(Pack::ESnPakChunkKind::SolidBlock))
+          {
+            return std::unexpected("Chunk kind mismatch - expected SolidBlock");
+          }
+          if (ChunkHeader.Compression != ExpectedEntry->Compression)
+          {
+            return std::unexpected("Chunk Compression mismatch with index entry");
+          }
+        }
+
+        // FIX #4: Validate chunk identity for main payloads
+        if (ExpectedEntry != nullptr && !bSolidMember && Options.bValidateChunkIdentity)
+        {
+          // Must be MainPayload kind
+          if (ChunkHeader.ChunkKind != static_cast<uint8_t>(Pack::ESnPakChunkKind::MainPayload))
+          {
+            return std::unexpected("Chunk kind mismatch - expected MainPayload");
+          }
+
+          // AssetId must match, unless the writer deduplicated the payload against another asset
+          const bool bSharedPayload = (ExpectedEntry->Flags & Pack::IndexEntryFlag_SharedPayload) != 0;
+          if (!bSharedPayload && !Pack::CompareUuid(ChunkHeader.AssetId, ExpectedEntry->AssetId))
+          {
+            return std::unexpected("Chunk AssetId mismatch with index entry");
+          }
+
+          // PayloadType must match
+          if (!Pack::CompareUuid(ChunkHeader.PayloadType, ExpectedEntry->CookedPayloadType))
+          {
+            return std::unexpected("Chunk PayloadType mismatch with index entry");
+          }
 
           // SchemaVersion must match
           if (ChunkHeader.SchemaVersion != ExpectedEntry->CookedSchemaVersion)
@@ -591,22 +1192,78 @@ namespace SnAPI::AssetPipeline
             return std::unexpected("Bulk chunk Compression mismatch with bulk entry");
           }
 
-          // FIX #6: AssetId must match the parent asset
-          if (ExpectedBulkAssetId != nullptr && !Pack::CompareUuid(ChunkHeader.AssetId, ExpectedBulkAssetId))
+          // FIX #6: AssetId must match the parent asset (shared chunks may belong to another asset)
+          const bool bSharedChunk = (Pack::GetBulkEntryFlags(*ExpectedBulkEntry) & Pack::BulkEntryFlag_SharedChunk) != 0;
+          if (ExpectedBulkAssetId != nullptr && !bSharedChunk && !Pack::CompareUuid(ChunkHeader.AssetId, ExpectedBulkAssetId))
           {
             return std::unexpected("Bulk chunk AssetId mismatch - chunk belongs to different asset");
           }
         }
 
-        // Decompress (or read directly for uncompressed data)
+        return {};
+      }
+
+      std::expected<MappedChunk, std::string> MapChunk(uint64_t Offset, uint64_t ExpectedTotalSize, uint64_t ExpectedUncompressedSize,
+                                                       const Pack::SnPakIndexEntryV1* ExpectedEntry,
+                                                       const Pack::SnPakBulkEntryV1* ExpectedBulkEntry,
+                                                       const uint8_t* ExpectedBulkAssetId) const
+      {
+        if (!MappedReader->IsOpen())
+        {
+          return std::unexpected("Pack file is not memory-mapped");
+        }
+
+        // FIX #3: Validate chunk location against file bounds using INDEX size
+        if (Options.bValidateChunkBounds)
+        {
+          if (!CheckRange(Offset, ExpectedTotalSize))
+          {
+            return std::unexpected("Chunk offset/size exceeds file bounds");
+          }
+        }
+
+        // Ensure minimum size for chunk header
+        if (Options.bValidateChunkSizes)
+        {
+          if (ExpectedTotalSize < sizeof(Pack::SnPakChunkHeaderV1))
+          {
+            return std::unexpected("Chunk total size too small for header");
+          }
+        }
+
+        // Chunks read ahead for this load (see ScopedPackStagedReads) come from the staged bytes
+        const PackStagedRange* Staged = FindStagedRange(Offset, ExpectedTotalSize);
+        auto ReadStored = [&](const uint64_t At, const size_t Size) -> std::expected<std::span<const uint8_t>, std::string> {
+          if (Staged != nullptr && At >= Staged->Offset && Size <= Staged->Size && At - Staged->Offset <= Staged->Size - Size)
+          {
+            return std::span<const uint8_t>(Staged->Bytes.get() + (At - Staged->Offset), Size);
+          }
+          return MappedReader->ReadChunk(At, Size);
+        };
+
+        Pack::SnPakChunkHeaderV1 ChunkHeader;
+        auto HeaderSpanResult = ReadStored(Offset, sizeof(ChunkHeader));
+        if (!HeaderSpanResult.has_value())
+        {
+          return std::unexpected("Failed to read chunk header: " + HeaderSpanResult.error());
+        }
+        std::memcpy(&ChunkHeader, HeaderSpanResult->data(), sizeof(ChunkHeader));
+
+        auto HeaderResult = ValidateChunkHeader(ChunkHeader, ExpectedTotalSize, ExpectedUncompressedSize, ExpectedEntry, ExpectedBulkEntry,
+                                                ExpectedBulkAssetId);
+        if (!HeaderResult.has_value())
+        {
+          return std::unexpected(HeaderResult.error());
+        }
+
+        // Map the stored bytes (raw data for uncompressed chunks, compressed data otherwise)
+        MappedChunk Chunk{};
+        Chunk.Header = ChunkHeader;
         auto Mode = static_cast<Pack::ESnPakCompression>(ChunkHeader.Compression);
-        std::vector<uint8_t> Output;
         const uint64_t DataOffset = Offset + sizeof(Pack::SnPakChunkHeaderV1);
 
         if (Mode == Pack::ESnPakCompression::None)
         {
-          // FIX #3: For uncompressed data, read directly into output buffer
-          // This avoids allocating a separate CompressedData buffer
           if (Options.bValidateChunkSizes)
           {
             if (ChunkHeader.SizeCompressed != ChunkHeader.SizeUncompressed)
@@ -616,50 +1273,684 @@ namespace SnAPI::AssetPipeline
           }
           if (ChunkHeader.SizeUncompressed > 0)
           {
-            auto DataSpanResult = MappedReader.ReadChunk(DataOffset, static_cast<size_t>(ChunkHeader.SizeUncompressed));
+            auto DataSpanResult = ReadStored(DataOffset, static_cast<size_t>(ChunkHeader.SizeUncompressed));
             if (!DataSpanResult.has_value())
             {
               return std::unexpected("Failed to read chunk data: " + DataSpanResult.error());
             }
-            Output.assign(DataSpanResult->begin(), DataSpanResult->end());
+            Chunk.Data = *DataSpanResult;
+          }
+        }
+        else if (ChunkHeader.SizeCompressed > 0)
+        {
+          auto DataSpanResult = ReadStored(DataOffset, static_cast<size_t>(ChunkHeader.SizeCompressed));
+          if (!DataSpanResult.has_value())
+          {
+            return std::unexpected("Failed to read chunk compressed data: " + DataSpanResult.error());
           }
+          Chunk.Data = *DataSpanResult;
+        }
+        if (Staged != nullptr && !Chunk.Data.empty() && Chunk.Data.data() >= Staged->Bytes.get() &&
+            Chunk.Data.data() < Staged->Bytes.get() + Staged->Size)
+        {
+          Chunk.Owner = Staged->Bytes;
+        }
+
+        return Chunk;
+      }
+
+      std::expected<void, std::string> VerifyChunkHash(const Pack::SnPakChunkHeaderV1& ChunkHeader, std::span<const uint8_t> Bytes) const
+      {
+        if (Options.bVerifyChunkHash)
+        {
+          // Verify hash of decompressed/output data
+          XXH128_hash_t Hash = XXH3_128bits(Bytes.data(), Bytes.size());
+          if (Hash.high64 != ChunkHeader.HashHi || Hash.low64 != ChunkHeader.HashLo)
+          {
+            return std::unexpected("Chunk hash mismatch - data corrupted");
+          }
+        }
+        return {};
+      }
+
+      // Decoded size of a mapped chunk (compressed chunks with no stored bytes decode to nothing)
+      static size_t GetDecodedSize(const MappedChunk& Chunk)
+      {
+        if (static_cast<Pack::ESnPakCompression>(Chunk.Header.Compression) == Pack::ESnPakCompression::None || Chunk.Data.empty())
+        {
+          return Chunk.Data.size();
+        }
+        return static_cast<size_t>(Chunk.Header.SizeUncompressed);
+      }
+
+      // Decode bytes [Offset, Offset + Output.size()) of a framed chunk. When the range spans
+      // several frames they are decoded concurrently on the shared decode pool, each frame straight
+      // into its slice of Output, with the calling thread taking part.
+      std::expected<void, std::string> DecodeFrames(const MappedChunk& Chunk, const uint64_t Offset, std::span<uint8_t> Output,
+                                                    const bool bVerifyFrames) const
+      {
+        const auto Mode = static_cast<Pack::ESnPakCompression>(Chunk.Header.Compression);
+        auto DecodeRange = [&](const uint64_t RangeOffset, std::span<uint8_t> RangeOutput) -> std::expected<void, std::string> {
+          try
+          {
+            Pack::DecompressFrameRange(Chunk.Data.data(), Chunk.Data.size(), Chunk.Header.SizeUncompressed, RangeOffset, RangeOutput, Mode,
+                                       bVerifyFrames);
+          }
+          catch (const std::exception& E)
+          {
+            return std::unexpected(std::string("Decompression failed: ") + E.what());
+          }
+          return {};
+        };
+
+        Pack::SnPakFrameTableHeaderV1 TableHeader{};
+        if (Chunk.Data.size() >= sizeof(TableHeader))
+        {
+          std::memcpy(&TableHeader, Chunk.Data.data(), sizeof(TableHeader));
+        }
+        const uint64_t FrameSize = TableHeader.FrameSize;
+        const uint32_t Parallelism = Options.FrameDecodeThreads == 0 ? std::max(1u, std::thread::hardware_concurrency())
+                                                                      : Options.FrameDecodeThreads;
+        if (FrameSize == 0 || Output.empty() || Parallelism <= 1 || Offset > Chunk.Header.SizeUncompressed ||
+            Output.size() > Chunk.Header.SizeUncompressed - Offset)
+        {
+          // Single-threaded (or invalid, which DecompressFrameRange reports)
+          return DecodeRange(Offset, Output);
+        }
+
+        const uint64_t RangeEnd = Offset + Output.size();
+        const uint64_t FirstFrame = Offset / FrameSize;
+        const uint64_t FrameCount = (RangeEnd - 1) / FrameSize - FirstFrame + 1;
+        if (FrameCount <= 1)
+        {
+          return DecodeRange(Offset, Output);
+        }
+
+        std::mutex ErrorMutex;
+        std::string Error;
+        Pack::DecodePool::Get().ParallelFor(static_cast<size_t>(FrameCount), Parallelism, [&](const size_t Index) {
+          const uint64_t FrameStart = (FirstFrame + Index) * FrameSize;
+          const uint64_t Begin = std::max(Offset, FrameStart);
+          const uint64_t End = std::min(RangeEnd, FrameStart + FrameSize);
+          auto Result = DecodeRange(Begin, Output.subspan(static_cast<size_t>(Begin - Offset), static_cast<size_t>(End - Begin)));
+          if (!Result.has_value())
+          {
+            std::lock_guard Lock(ErrorMutex);
+            if (Error.empty())
+            {
+              Error = Result.error();
+            }
+          }
+        });
+        if (!Error.empty())
+        {
+          return std::unexpected(Error);
+        }
+        return {};
+      }
+
+      // Decode into Output, which must be exactly GetDecodedSize(Chunk) bytes
+      std::expected<void, std::string> DecodeChunkInto(const MappedChunk& Chunk, std::span<uint8_t> Output) const
+      {
+        if (Output.empty())
+        {
+          return {};
+        }
+
+        if (Pack::GetChunkFlags(Chunk.Header) & Pack::ChunkFlag_Framed)
+        {
+          // The whole-chunk hash is verified by the caller, so frame hashes are not checked here
+          return DecodeFrames(Chunk, 0, Output, false);
+        }
+
+        try
+        {
+          Pack::Decompress(Chunk.Data.data(), Chunk.Data.size(), Output, static_cast<Pack::ESnPakCompression>(Chunk.Header.Compression),
+                           &Dictionaries);
+        }
+        catch (const std::exception& E)
+        {
+          return std::unexpected(std::string("Decompression failed: ") + E.what());
+        }
+        return {};
+      }
+
+      std::expected<std::vector<uint8_t>, std::string> DecodeChunk(const MappedChunk& Chunk) const
+      {
+        if (static_cast<Pack::ESnPakCompression>(Chunk.Header.Compression) == Pack::ESnPakCompression::None)
+        {
+          return std::vector<uint8_t>(Chunk.Data.begin(), Chunk.Data.end());
+        }
+
+        std::vector<uint8_t> Output(GetDecodedSize(Chunk));
+        auto DecodeResult = DecodeChunkInto(Chunk, Output);
+        if (!DecodeResult.has_value())
+        {
+          return std::unexpected(DecodeResult.error());
+        }
+        return Output;
+      }
+
+      std::expected<std::vector<uint8_t>, std::string> LoadChunk(uint64_t Offset, uint64_t ExpectedTotalSize, uint64_t ExpectedUncompressedSize,
+                                                                 const Pack::SnPakIndexEntryV1* ExpectedEntry = nullptr,
+                                                                 const Pack::SnPakBulkEntryV1* ExpectedBulkEntry = nullptr,
+                                                                 const uint8_t* ExpectedBulkAssetId = nullptr) const
+      {
+        auto ChunkResult = MapChunk(Offset, ExpectedTotalSize, ExpectedUncompressedSize, ExpectedEntry, ExpectedBulkEntry, ExpectedBulkAssetId);
+        if (!ChunkResult.has_value())
+        {
+          return std::unexpected(ChunkResult.error());
+        }
+
+        auto Output = DecodeChunk(*ChunkResult);
+        if (!Output.has_value())
+        {
+          return std::unexpected(Output.error());
+        }
+
+        auto HashResult = VerifyChunkHash(ChunkResult->Header, *Output);
+        if (!HashResult.has_value())
+        {
+          return std::unexpected(HashResult.error());
+        }
+
+        return Output;
+      }
+
+      // Decode a validated chunk into caller memory and verify its hash; returns the number of bytes written
+      std::expected<size_t, std::string> DecodeChunkToOutput(const MappedChunk& Chunk, std::span<uint8_t> Output) const
+      {
+        const size_t DecodedSize = GetDecodedSize(Chunk);
+        if (Output.size() < DecodedSize)
+        {
+          return std::unexpected("Output buffer too small for chunk: need " + std::to_string(DecodedSize) + " bytes, got " +
+                                 std::to_string(Output.size()));
+        }
+
+        const auto Target = Output.first(DecodedSize);
+        auto DecodeResult = DecodeChunkInto(Chunk, Target);
+        if (!DecodeResult.has_value())
+        {
+          return std::unexpected(DecodeResult.error());
+        }
+
+        auto HashResult = VerifyChunkHash(Chunk.Header, Target);
+        if (!HashResult.has_value())
+        {
+          return std::unexpected(HashResult.error());
+        }
+
+        return DecodedSize;
+      }
+
+      // Like LoadChunk, but decodes into caller memory; returns the number of bytes written
+      std::expected<size_t, std::string> LoadChunkInto(std::span<uint8_t> Output, uint64_t Offset, uint64_t ExpectedTotalSize,
+                                                       uint64_t ExpectedUncompressedSize,
+                                                       const Pack::SnPakIndexEntryV1* ExpectedEntry = nullptr,
+                                                       const Pack::SnPakBulkEntryV1* ExpectedBulkEntry = nullptr,
+                                                       const uint8_t* ExpectedBulkAssetId = nullptr) const
+      {
+        auto ChunkResult = MapChunk(Offset, ExpectedTotalSize, ExpectedUncompressedSize, ExpectedEntry, ExpectedBulkEntry, ExpectedBulkAssetId);
+        if (!ChunkResult.has_value())
+        {
+          return std::unexpected(ChunkResult.error());
+        }
+        return DecodeChunkToOutput(*ChunkResult, Output);
+      }
+
+      // Decode bytes [RangeOffset, RangeOffset + Output.size()) of a bulk chunk. Framed chunks only
+      // decode the frames overlapping the range and verify those frames' hashes; uncompressed
+      // chunks copy the range out of the mapping (the chunk hash is only checked when the range
+      // covers the whole chunk); single-block chunks are decoded whole and then copied from.
+      std::expected<void, std::string> LoadBulkRangeInto(std::span<uint8_t> Output, const uint64_t RangeOffset,
+                                                         const Pack::SnPakBulkEntryV1& BulkEntry, const uint8_t* AssetIdBytes) const
+      {
+        auto ChunkResult = MapChunk(BulkEntry.ChunkOffset, BulkEntry.SizeCompressed, BulkEntry.SizeUncompressed, nullptr, &BulkEntry,
+                                    AssetIdBytes);
+        if (!ChunkResult.has_value())
+        {
+          return std::unexpected(ChunkResult.error());
+        }
+
+        const MappedChunk& Chunk = *ChunkResult;
+        const uint64_t DecodedSize = GetDecodedSize(Chunk);
+        if (RangeOffset > DecodedSize || Output.size() > DecodedSize - RangeOffset)
+        {
+          return std::unexpected("Bulk chunk range exceeds chunk size");
+        }
+
+        const auto Mode = static_cast<Pack::ESnPakCompression>(Chunk.Header.Compression);
+        if (Mode == Pack::ESnPakCompression::None)
+        {
+          if (!Output.empty())
+          {
+            std::memcpy(Output.data(), Chunk.Data.data() + RangeOffset, Output.size());
+          }
+          return Output.size() == DecodedSize ? VerifyChunkHash(Chunk.Header, Output) : std::expected<void, std::string>{};
+        }
+
+        if (Pack::GetChunkFlags(Chunk.Header) & Pack::ChunkFlag_Framed)
+        {
+          return DecodeFrames(Chunk, RangeOffset, Output, Options.bVerifyChunkHash);
+        }
+
+        auto Buffer = GetDecodeBufferPool().Acquire(static_cast<size_t>(DecodedSize));
+        auto DecodeResult = DecodeChunkInto(Chunk, *Buffer);
+        if (!DecodeResult.has_value())
+        {
+          return DecodeResult;
+        }
+        auto HashResult = VerifyChunkHash(Chunk.Header, *Buffer);
+        if (!HashResult.has_value())
+        {
+          return HashResult;
+        }
+        if (!Output.empty())
+        {
+          std::memcpy(Output.data(), Buffer->data() + RangeOffset, Output.size());
+        }
+        return {};
+      }
+
+      // Unmap a bulk chunk whose bytes now live in caller memory (Options.bReleaseDecodedBulk)
+      void ReleaseConsumedBulk(const Pack::SnPakBulkEntryV1& BulkEntry) const
+      {
+        if (Options.bReleaseDecodedBulk && !Options.bResident)
+        {
+          MappedReader->ReleaseRange(static_cast<size_t>(BulkEntry.ChunkOffset), static_cast<size_t>(BulkEntry.SizeCompressed));
+        }
+      }
+
+      // Large bulk chunks whose data starts on a block boundary skip the mapping when direct
+      // reads are enabled, so they are not cached twice (page cache + caller buffer)
+      bool ShouldReadDirect(const Pack::SnPakBulkEntryV1& BulkEntry) const
+      {
+        return Direct != nullptr && BulkEntry.SizeCompressed >= sizeof(Pack::SnPakChunkHeaderV1) &&
+               BulkEntry.SizeCompressed - sizeof(Pack::SnPakChunkHeaderV1) >= Options.DirectIoMinSize &&
+               (BulkEntry.ChunkOffset + sizeof(Pack::SnPakChunkHeaderV1)) % Pack::DirectFile::kBlockSize == 0;
+      }
+
+      // LoadChunkInto through the unbuffered handle. One read fetches the block ending with the
+      // chunk header plus the block-rounded data into a per-thread aligned scratch buffer, which
+      // is then decoded into Output.
+      std::expected<size_t, std::string> LoadChunkDirectInto(std::span<uint8_t> Output, const Pack::SnPakBulkEntryV1& BulkEntry,
+                                                             const uint8_t* ExpectedBulkAssetId) const
+      {
+        constexpr uint64_t kBlock = Pack::DirectFile::kBlockSize;
+        constexpr size_t kMaxCachedScratch = 64ull * 1024ull * 1024ull;
+
+        // The read size comes from the index, so bounds are always checked here
+        if (!CheckRange(BulkEntry.ChunkOffset, BulkEntry.SizeCompressed))
+        {
+          return std::unexpected("Chunk offset/size exceeds file bounds");
+        }
+        const uint64_t StoredSize = BulkEntry.SizeCompressed - sizeof(Pack::SnPakChunkHeaderV1);
+        if (StoredSize > kMaxBlockSize)
+        {
+          return std::unexpected("Chunk compressed size exceeds sanity limit");
+        }
+
+        const uint64_t DataOffset = BulkEntry.ChunkOffset + sizeof(Pack::SnPakChunkHeaderV1);
+        const size_t WindowSize = static_cast<size_t>(kBlock + Pack::AlignUpToBlock(StoredSize));
+
+        struct ScratchBuffer
+        {
+            Pack::AlignedBlockBuffer Data;
+            size_t Size = 0;
+        };
+        static thread_local ScratchBuffer CachedScratch;
+        Pack::AlignedBlockBuffer OneOffScratch;
+        uint8_t* Scratch = nullptr;
+        if (WindowSize <= kMaxCachedScratch)
+        {
+          if (CachedScratch.Size < WindowSize)
+          {
+            CachedScratch.Data = Pack::AllocateAlignedBlocks(WindowSize);
+            CachedScratch.Size = WindowSize;
+          }
+          Scratch = CachedScratch.Data.get();
+        }
+        else
+        {
+          OneOffScratch = Pack::AllocateAlignedBlocks(WindowSize);
+          Scratch = OneOffScratch.get();
+        }
+
+        auto ReadResult = Direct->Read(DataOffset - kBlock, std::span<uint8_t>(Scratch, WindowSize));
+        if (!ReadResult.has_value())
+        {
+          return std::unexpected(ReadResult.error());
+        }
+        if (*ReadResult < kBlock + StoredSize)
+        {
+          return std::unexpected("Short direct read of chunk at offset " + std::to_string(BulkEntry.ChunkOffset));
+        }
+
+        MappedChunk Chunk{};
+        std::memcpy(&Chunk.Header, Scratch + kBlock - sizeof(Pack::SnPakChunkHeaderV1), sizeof(Pack::SnPakChunkHeaderV1));
+        auto HeaderResult =
+            ValidateChunkHeader(Chunk.Header, BulkEntry.SizeCompressed, BulkEntry.SizeUncompressed, nullptr, &BulkEntry, ExpectedBulkAssetId);
+        if (!HeaderResult.has_value())
+        {
+          return std::unexpected(HeaderResult.error());
+        }
+
+        // Only the index-sized bytes were read, so the header must agree with it regardless of options
+        const bool bUncompressed = static_cast<Pack::ESnPakCompression>(Chunk.Header.Compression) == Pack::ESnPakCompression::None;
+        if ((bUncompressed ? Chunk.Header.SizeUncompressed : Chunk.Header.SizeCompressed) != StoredSize)
+        {
+          return std::unexpected("Chunk size mismatch with index");
+        }
+
+        Chunk.Data = std::span<const uint8_t>(Scratch + kBlock, static_cast<size_t>(StoredSize));
+        return DecodeChunkToOutput(Chunk, Output);
+      }
+
+      // Like LoadChunk, but uncompressed chunks come back as a span into the mapping that shares
+      // ownership of it, so the view outlives Close() and never copies the bytes.
+      std::expected<AssetDataView, std::string> LoadChunkView(uint64_t Offset, uint64_t ExpectedTotalSize, uint64_t ExpectedUncompressedSize,
+                                                              const Pack::SnPakIndexEntryV1* ExpectedEntry = nullptr,
+                                                              const Pack::SnPakBulkEntryV1* ExpectedBulkEntry = nullptr,
+                                                              const uint8_t* ExpectedBulkAssetId = nullptr) const
+      {
+        auto ChunkResult = MapChunk(Offset, ExpectedTotalSize, ExpectedUncompressedSize, ExpectedEntry, ExpectedBulkEntry, ExpectedBulkAssetId);
+        if (!ChunkResult.has_value())
+        {
+          return std::unexpected(ChunkResult.error());
+        }
+
+        AssetDataView View;
+        if (static_cast<Pack::ESnPakCompression>(ChunkResult->Header.Compression) == Pack::ESnPakCompression::None)
+        {
+          View = AssetDataView(ChunkResult->Data, GetChunkOwner(*ChunkResult), true);
+        }
+        else
+        {
+          auto Buffer = GetDecodeBufferPool().Acquire(GetDecodedSize(*ChunkResult));
+          auto DecodeResult = DecodeChunkInto(*ChunkResult, *Buffer);
+          if (!DecodeResult.has_value())
+          {
+            return std::unexpected(DecodeResult.error());
+          }
+          const std::span<const uint8_t> Bytes(Buffer->data(), Buffer->size());
+          View = AssetDataView(Bytes, std::move(Buffer));
+        }
+
+        auto HashResult = VerifyChunkHash(ChunkResult->Header, View.GetSpan());
+        if (!HashResult.has_value())
+        {
+          return std::unexpected(HashResult.error());
+        }
+
+        return View;
+      }
+
+      // Decoded bytes of the solid block chunk at Offset, from the cache or decoded (and cached) now
+      std::expected<std::shared_ptr<const std::vector<uint8_t>>, std::string> GetSolidBlock(const uint64_t Offset, const MappedChunk& Chunk) const
+      {
+        // Caller holds SolidCacheMutex; a hit moves the block to the front
+        auto FindCached = [this, Offset]() -> std::shared_ptr<const std::vector<uint8_t>> {
+          for (auto It = SolidCache.begin(); It != SolidCache.end(); ++It)
+          {
+            if (It->Offset == Offset)
+            {
+              SolidCache.splice(SolidCache.begin(), SolidCache, It);
+              return It->Bytes;
+            }
+          }
+          return nullptr;
+        };
+
+        {
+          std::lock_guard Lock(SolidCacheMutex);
+          if (auto Cached = FindCached())
+          {
+            return Cached;
+          }
+        }
+
+        auto Decoded = DecodeChunk(Chunk);
+        if (!Decoded.has_value())
+        {
+          return std::unexpected(Decoded.error());
+        }
+        auto HashResult = VerifyChunkHash(Chunk.Header, *Decoded);
+        if (!HashResult.has_value())
+        {
+          return std::unexpected(HashResult.error());
+        }
+        auto Bytes = std::make_shared<const std::vector<uint8_t>>(std::move(*Decoded));
+
+        const uint64_t Budget = Options.SolidBlockCacheSize;
+        if (Bytes->size() <= Budget)
+        {
+          std::lock_guard Lock(SolidCacheMutex);
+          // Another thread may have decoded the same block meanwhile; keep its copy so the block is
+          // cached (and counted against the budget) once
+          if (auto Cached = FindCached())
+          {
+            return Cached;
+          }
+          SolidCache.push_front({Offset, Bytes});
+          SolidCacheBytes += Bytes->size();
+          while (SolidCacheBytes > Budget)
+          {
+            SolidCacheBytes -= SolidCache.back().Bytes->size();
+            SolidCache.pop_back();
+          }
+        }
+        return Bytes;
+      }
+
+      // View of a payload stored in a solid block. Uncompressed blocks are sliced straight out of
+      // the mapping; compressed ones out of the decoded block, which the view keeps alive.
+      std::expected<AssetDataView, std::string> LoadSolidMemberView(const Pack::SnPakIndexEntryV1& Entry) const
+      {
+        auto ChunkResult = MapChunk(Entry.PayloadChunkOffset, Entry.PayloadChunkSizeCompressed, 0, &Entry, nullptr, nullptr);
+        if (!ChunkResult.has_value())
+        {
+          return std::unexpected(ChunkResult.error());
+        }
+
+        const uint64_t MemberOffset = Pack::GetSolidMemberOffset(Entry);
+        const uint64_t MemberSize = Pack::GetPayloadSize(Entry);
+        if (MemberOffset > ChunkResult->Header.SizeUncompressed || MemberSize > ChunkResult->Header.SizeUncompressed - MemberOffset)
+        {
+          return std::unexpected("Solid block member exceeds its block");
+        }
+
+        AssetDataView View;
+        if (static_cast<Pack::ESnPakCompression>(ChunkResult->Header.Compression) == Pack::ESnPakCompression::None)
+        {
+          if (ChunkResult->Data.size() != ChunkResult->Header.SizeUncompressed)
+          {
+            return std::unexpected("Uncompressed solid block has mismatched sizes");
+          }
+          View = AssetDataView(ChunkResult->Data.subspan(static_cast<size_t>(MemberOffset), static_cast<size_t>(MemberSize)),
+                               GetChunkOwner(*ChunkResult), true);
+        }
+        else
+        {
+          auto Block = GetSolidBlock(Entry.PayloadChunkOffset, *ChunkResult);
+          if (!Block.has_value())
+          {
+            return std::unexpected(Block.error());
+          }
+          const std::span<const uint8_t> Bytes((*Block)->data() + MemberOffset, static_cast<size_t>(MemberSize));
+          View = AssetDataView(Bytes, std::move(*Block));
+        }
+
+        if (Options.bVerifyChunkHash)
+        {
+          XXH128_hash_t Hash = XXH3_128bits(View.GetData(), View.GetSize());
+          if (Hash.high64 != Entry.PayloadHashHi || Hash.low64 != Entry.PayloadHashLo)
+          {
+            return std::unexpected("Solid block member hash mismatch - data corrupted");
+          }
+        }
+        return View;
+      }
+
+      // Sort Ranges and merge adjacent or overlapping (shared) ones. Ranges that would overflow
+      // or run past the end of the pack are dropped; loading them reports the error.
+      std::vector<AssetPackReader::FileRange> CoalesceRanges(std::vector<AssetPackReader::FileRange> Ranges) const
+      {
+        const uint64_t PackSize = MappedReader->GetPackSize();
+        std::erase_if(Ranges, [PackSize](const AssetPackReader::FileRange& Range) {
+          return Range.Offset > PackSize || Range.Size > PackSize - Range.Offset;
+        });
+        std::sort(Ranges.begin(), Ranges.end(), [](const auto& A, const auto& B) { return A.Offset < B.Offset; });
+
+        std::vector<AssetPackReader::FileRange> Runs;
+        for (const auto& Range : Ranges)
+        {
+          if (!Runs.empty() && Range.Offset <= Runs.back().Offset + Runs.back().Size)
+          {
+            const uint64_t End = std::max(Runs.back().Offset + Runs.back().Size, Range.Offset + Range.Size);
+            Runs.back().Size = End - Runs.back().Offset;
+            continue;
+          }
+          Runs.push_back(Range);
+        }
+        return Runs;
+      }
+
+      // Issue one readahead hint per contiguous run of the given chunks
+      void PrefetchChunkRuns(const std::vector<Pack::SnPakBulkEntryV1>& Requested) const
+      {
+        std::vector<AssetPackReader::FileRange> Ranges;
+        Ranges.reserve(Requested.size());
+        for (const auto& BulkEntry : Requested)
+        {
+          Ranges.push_back({BulkEntry.ChunkOffset, BulkEntry.SizeCompressed});
+        }
+        for (const auto& Run : CoalesceRanges(std::move(Ranges)))
+        {
+          MappedReader->PrefetchRange(static_cast<size_t>(Run.Offset), static_cast<size_t>(Run.Size));
+        }
+      }
+
+      // Load several bulk chunks of Entry as views, in the order of BulkIndices. All chunks are
+      // prefetched and validated first, then decoded (and hash-checked) in one pass on up to
+      // MaxThreads threads. Indices that resolve to the same stored chunk share one view.
+      std::expected<std::vector<AssetDataView>, std::string> LoadBulkChunkViews(const Pack::SnPakIndexEntryV1& Entry,
+                                                                               std::span<const uint32_t> BulkIndices,
+                                                                               uint32_t MaxThreads) const
+      {
+        std::vector<Pack::SnPakBulkEntryV1> Requested;
+        Requested.reserve(BulkIndices.size());
+        for (const uint32_t BulkIndex : BulkIndices)
+        {
+          if (!(Entry.Flags & Pack::IndexEntryFlag_HasBulk) || BulkIndex >= Entry.BulkCount)
+          {
+            return std::unexpected("Bulk chunk index out of range: " + std::to_string(BulkIndex));
+          }
+          const uint64_t GlobalBulkIndex = static_cast<uint64_t>(Entry.BulkFirstIndex) + BulkIndex;
+          if (GlobalBulkIndex >= BulkEntries.size())
+          {
+            return std::unexpected("Invalid bulk entry index");
+          }
+          Requested.push_back(BulkEntries[GlobalBulkIndex]);
+        }
+
+        PrefetchChunkRuns(Requested);
+
+        struct DecodeTask
+        {
+            MappedChunk Chunk;
+            std::shared_ptr<std::vector<uint8_t>> Buffer; // null for uncompressed chunks
+            size_t ViewIndex = 0;
+        };
+
+        std::vector<AssetDataView> Views(Requested.size());
+        std::vector<size_t> SourceView(Requested.size());
+        std::unordered_map<uint64_t, size_t> FirstViewByOffset;
+        std::vector<DecodeTask> Tasks;
+        Tasks.reserve(Requested.size());
+        for (size_t ViewIndex = 0; ViewIndex < Requested.size(); ++ViewIndex)
+        {
+          const auto& BulkEntry = Requested[ViewIndex];
+          SourceView[ViewIndex] = ViewIndex;
+          if (const auto It = FirstViewByOffset.find(BulkEntry.ChunkOffset); It != FirstViewByOffset.end())
+          {
+            const auto& First = Requested[It->second];
+            if (First.SizeCompressed == BulkEntry.SizeCompressed && First.SizeUncompressed == BulkEntry.SizeUncompressed &&
+                First.Compression == BulkEntry.Compression)
+            {
+              SourceView[ViewIndex] = It->second;
+              continue;
+            }
+          }
+          FirstViewByOffset.try_emplace(BulkEntry.ChunkOffset, ViewIndex);
+
+          auto ChunkResult = MapChunk(BulkEntry.ChunkOffset, BulkEntry.SizeCompressed, BulkEntry.SizeUncompressed, nullptr, &BulkEntry,
+                                      Entry.AssetId);
+          if (!ChunkResult.has_value())
+          {
+            return std::unexpected(ChunkResult.error());
+          }
+
+          DecodeTask Task{*ChunkResult, nullptr, ViewIndex};
+          if (static_cast<Pack::ESnPakCompression>(Task.Chunk.Header.Compression) != Pack::ESnPakCompression::None)
+          {
+            // Buffers come from the calling thread's pool so workers never touch it
+            Task.Buffer = GetDecodeBufferPool().Acquire(GetDecodedSize(Task.Chunk));
+          }
+          Tasks.push_back(std::move(Task));
+        }
+
+        auto RunTask = [this](const DecodeTask& Task) -> std::expected<void, std::string> {
+          if (!Task.Buffer)
+          {
+            return VerifyChunkHash(Task.Chunk.Header, Task.Chunk.Data);
+          }
+          auto DecodeResult = DecodeChunkInto(Task.Chunk, *Task.Buffer);
+          if (!DecodeResult.has_value())
+          {
+            return DecodeResult;
+          }
+          return VerifyChunkHash(Task.Chunk.Header, *Task.Buffer);
+        };
+
+        if (MaxThreads == 0)
+        {
+          MaxThreads = std::max(1u, std::thread::hardware_concurrency());
         }
-        else
+
+        // Decoded on the shared decode pool; the calling thread takes tasks alongside its helpers
+        std::vector<std::expected<void, std::string>> Results(Tasks.size());
+        Pack::DecodePool::Get().ParallelFor(Tasks.size(), MaxThreads, [&](const size_t TaskIndex) {
+          Results[TaskIndex] = RunTask(Tasks[TaskIndex]);
+        });
+
+        for (size_t TaskIndex = 0; TaskIndex < Tasks.size(); ++TaskIndex)
         {
-          if (ChunkHeader.SizeCompressed > 0)
+          if (!Results[TaskIndex].has_value())
           {
-            auto DataSpanResult = MappedReader.ReadChunk(DataOffset, static_cast<size_t>(ChunkHeader.SizeCompressed));
-            if (!DataSpanResult.has_value())
-            {
-              return std::unexpected("Failed to read chunk compressed data: " + DataSpanResult.error());
-            }
+            return std::unexpected(Results[TaskIndex].error());
+          }
 
-            try
-            {
-              Output = Pack::Decompress(DataSpanResult->data(), DataSpanResult->size(), ChunkHeader.SizeUncompressed, Mode);
-            }
-            catch (const std::exception& E)
-            {
-              return std::unexpected(std::string("Decompression failed: ") + E.what());
-            }
+          auto& Task = Tasks[TaskIndex];
+          if (Task.Buffer)
+          {
+            const std::span<const uint8_t> Bytes(Task.Buffer->data(), Task.Buffer->size());
+            Views[Task.ViewIndex] = AssetDataView(Bytes, std::move(Task.Buffer));
           }
           else
           {
-            Output.clear();
+            Views[Task.ViewIndex] = AssetDataView(Task.Chunk.Data, GetChunkOwner(Task.Chunk), true);
           }
         }
 
-        if (Options.bVerifyChunkHash)
+        for (size_t ViewIndex = 0; ViewIndex < Views.size(); ++ViewIndex)
         {
-          // Verify hash of decompressed/output data
-          XXH128_hash_t Hash = XXH3_128bits(Output.data(), Output.size());
-          if (Hash.high64 != ChunkHeader.HashHi || Hash.low64 != ChunkHeader.HashLo)
+          if (SourceView[ViewIndex] != ViewIndex)
           {
-            return std::unexpected("Chunk hash mismatch - data corrupted");
+            Views[ViewIndex] = Views[SourceView[ViewIndex]];
           }
         }
 
-        return Output;
+        return Views;
       }
   };
 
@@ -678,117 +1969,122 @@ namespace SnAPI::AssetPipeline
 
   std::expected<void, std::string> AssetPackReader::Open(const std::string& Path, const AssetPackReadOptions& Options)
   {
+    Close();
     m_Impl->Options = Options;
     m_Impl->FilePath = Path;
-    m_Impl->File.open(Path, std::ios::binary);
 
-    if (!m_Impl->File.is_open())
+    auto Result = m_Impl->OpenMapped(Path);
+    if (!Result.has_value())
     {
-      return std::unexpected("Failed to open file: " + Path);
+      Close();
+      return Result;
     }
 
-    // ─────────────────────────────────────────────────────────────────────────
-    // FIX #1: Get actual file size for bounds validation
-    // ─────────────────────────────────────────────────────────────────────────
-    std::error_code EC;
-    auto ActualFileSize = std::filesystem::file_size(Path, EC);
-    if (EC)
+    const auto& Mapped = *m_Impl->MappedReader;
+    if (Options.bHugePages)
     {
-      return std::unexpected("Failed to get file size: " + EC.message());
+      (void)Mapped.RequestHugePages();
     }
-
-    // Must be at least large enough for the header
-    if (ActualFileSize < sizeof(Pack::SnPakHeaderV1))
+    if (Options.AccessPattern != EMapAccessPattern::Normal)
     {
-      return std::unexpected("File too small to contain header");
+      Mapped.SetAccessPattern(Options.AccessPattern);
+      // Lookups keep touching the string table, index and lookup block in no particular order, and
+      // the dictionary block is metadata rather than streamed bulk data
+      const auto& Header = m_Impl->Header;
+      Mapped.SetAccessPattern(EMapAccessPattern::Normal, static_cast<size_t>(Header.StringTableOffset), static_cast<size_t>(Header.StringTableSize));
+      Mapped.SetAccessPattern(EMapAccessPattern::Normal, static_cast<size_t>(Header.IndexOffset), static_cast<size_t>(Header.IndexSize));
+      if (m_Impl->bHasLookupBlock)
+      {
+        Pack::SnPakIndexHeaderV1 IdxHeader;
+        std::memcpy(&IdxHeader, m_Impl->MapRange(Header.IndexOffset, sizeof(IdxHeader)), sizeof(IdxHeader));
+        Mapped.SetAccessPattern(EMapAccessPattern::Normal, static_cast<size_t>(Pack::GetLookupBlockOffset(IdxHeader)),
+                                static_cast<size_t>(Pack::GetLookupBlockSize(IdxHeader)));
+      }
+      if (Pack::GetDictionaryBlockSize(Header) > 0)
+      {
+        Mapped.SetAccessPattern(EMapAccessPattern::Normal, static_cast<size_t>(Pack::GetDictionaryBlockOffset(Header)),
+                                static_cast<size_t>(Pack::GetDictionaryBlockSize(Header)));
+      }
     }
 
-    // Temporarily set validated size to read header
-    m_Impl->ValidatedFileSize = ActualFileSize;
-
-    // Read header
-    if (!m_Impl->ReadExact(&m_Impl->Header, sizeof(Pack::SnPakHeaderV1)))
+    if (Options.bResident)
     {
-      return std::unexpected("Failed to read pack header");
+      // A refused lock still leaves the pages faulted in; IsMemoryLocked reports which happened
+      (void)m_Impl->MappedReader->MakeResident(Options.bLockResident);
     }
 
-    // Validate magic
-    if (std::memcmp(m_Impl->Header.Magic, Pack::kSnPakMagic, 8) != 0)
+    // Unbuffered reads need block-aligned chunk data; otherwise (or if the filesystem refuses
+    // them) every read goes through the mapping
+    if (Options.bDirectIo && !Options.bResident && Pack::GetChunkAlignment(m_Impl->Header) >= Pack::DirectFile::kBlockSize)
     {
-      return std::unexpected("Invalid pack file magic");
+      if (auto DirectResult = Pack::DirectFile::Open(Path); DirectResult.has_value())
+      {
+        m_Impl->Direct = std::move(*DirectResult);
+      }
     }
 
-    // Validate version
-    if (m_Impl->Header.Version != Pack::kSnPakVersion)
-    {
-      return std::unexpected("Unsupported pack version: " + std::to_string(m_Impl->Header.Version));
-    }
+    m_Impl->bOpen = true;
+    m_Impl->OpenSerial = g_NextOpenSerial.fetch_add(1, std::memory_order_relaxed);
+    return {};
+  }
 
-    // ─────────────────────────────────────────────────────────────────────────
-    // FIX #9: Validate Header.HeaderSize
-    // ─────────────────────────────────────────────────────────────────────────
-    if (m_Impl->Header.HeaderSize != sizeof(Pack::SnPakHeaderV1))
-    {
-      return std::unexpected("Header size mismatch - expected " + std::to_string(sizeof(Pack::SnPakHeaderV1)) + ", got " +
-                             std::to_string(m_Impl->Header.HeaderSize));
-    }
+  void AssetPackReader::Close()
+  {
+    m_Impl->Reset();
+  }
 
-    // Validate endian marker
-    if (m_Impl->Header.EndianMarker != Pack::kEndianMarker)
-    {
-      return std::unexpected("Endian mismatch - pack was created on different architecture");
-    }
+  uint32_t AssetPackReader::GetChunkAlignment() const
+  {
+    return m_Impl->bOpen ? Pack::GetChunkAlignment(m_Impl->Header) : 1;
+  }
 
-    // FIX #1: Use minimum of header FileSize and actual file size
-    // This prevents issues with truncated files or oversized headers
-    if (m_Impl->Header.FileSize > ActualFileSize)
-    {
-      return std::unexpected("Header FileSize (" + std::to_string(m_Impl->Header.FileSize) + ") exceeds actual file size (" +
-                             std::to_string(ActualFileSize) + ")");
-    }
-    m_Impl->ValidatedFileSize = m_Impl->Header.FileSize;
+  bool AssetPackReader::IsUsingDirectIo() const
+  {
+    return m_Impl->Direct != nullptr;
+  }
 
-    // Read string table
-    auto StrResult = m_Impl->ReadStringTable();
-    if (!StrResult.has_value())
-    {
-      return std::unexpected("Failed to read string table: " + StrResult.error());
-    }
+  bool AssetPackReader::IsMemoryLocked() const
+  {
+    return m_Impl->MappedReader->IsLocked();
+  }
 
-    // Read index
-    auto IdxResult = m_Impl->ReadIndex();
-    if (!IdxResult.has_value())
-    {
-      return std::unexpected("Failed to read index: " + IdxResult.error());
-    }
+  uint64_t AssetPackReader::GetOpenSerial() const
+  {
+    return m_Impl->OpenSerial;
+  }
 
-    auto MapResult = m_Impl->MappedReader.Open(Path);
-    if (!MapResult.has_value())
+  std::shared_ptr<const int> AssetPackReader::DuplicateFileDescriptor() const
+  {
+#ifdef _WIN32
+    return nullptr;
+#else
+    const int Fd = m_Impl->bOpen ? m_Impl->MappedReader->GetFileDescriptor() : -1;
+    const int Duplicate = Fd >= 0 ? fcntl(Fd, F_DUPFD_CLOEXEC, 0) : -1;
+    if (Duplicate < 0)
     {
-      return std::unexpected("Failed to memory-map pack: " + MapResult.error());
+      return nullptr;
     }
+    return std::shared_ptr<const int>(new int(Duplicate), [](const int* Descriptor) {
+      close(*Descriptor);
+      delete Descriptor;
+    });
+#endif
+  }
 
-    m_Impl->bOpen = true;
-    return {};
+  bool AssetPackReader::IsIndexCompressed() const
+  {
+    return m_Impl->bIndexCompressed;
   }
 
-  void AssetPackReader::Close()
+  uint64_t AssetPackReader::GetIndexMemoryUsage() const
   {
-    if (m_Impl->File.is_open())
-    {
-      m_Impl->File.close();
-    }
-    m_Impl->MappedReader.Close();
-    m_Impl->bOpen = false;
-    m_Impl->ValidatedFileSize = 0;
-    m_Impl->StringTable.clear();
-    m_Impl->IndexEntries.clear();
-    m_Impl->BulkEntries.clear();
-    m_Impl->DependencyOwners.clear();
-    m_Impl->DependencyEntries.clear();
-    m_Impl->AssetIdToIndex.clear();
-    m_Impl->NameHashToIndices.clear();
-    m_Impl->AssetIndexToDependencyOwnerIndex.clear();
+    std::lock_guard Lock(m_Impl->IndexCacheMutex);
+    return m_Impl->IndexCacheBytes;
+  }
+
+  uint32_t AssetPackReader::GetDictionaryCount() const
+  {
+    return static_cast<uint32_t>(m_Impl->Dictionaries.GetCount());
   }
 
   bool AssetPackReader::IsOpen() const
@@ -803,94 +2099,197 @@ namespace SnAPI::AssetPipeline
 
   std::expected<AssetInfo, std::string> AssetPackReader::GetAssetInfo(uint32_t Index) const
   {
-    if (Index >= m_Impl->IndexEntries.size())
+    const auto View = GetAssetInfoView(Index);
+    if (!View.has_value())
     {
       return std::unexpected("Index out of range");
     }
 
-    const auto& Entry = m_Impl->IndexEntries[Index];
-
+    // Names are materialized from the mapped string table only here
     AssetInfo Info;
-    std::memcpy(Info.Id.Bytes, Entry.AssetId, 16);
-    std::memcpy(Info.AssetKind.Bytes, Entry.AssetKind, 16);
-    std::memcpy(Info.CookedPayloadType.Bytes, Entry.CookedPayloadType, 16);
-    Info.SchemaVersion = Entry.CookedSchemaVersion;
-
-    if (Entry.NameStringId < m_Impl->StringTable.size())
+    Info.Id = View->Id;
+    Info.AssetKind = View->AssetKind;
+    Info.CookedPayloadType = View->CookedPayloadType;
+    Info.SchemaVersion = View->SchemaVersion;
+    Info.Name = View->Name;
+    Info.VariantKey = View->VariantKey;
+    Info.BulkChunkCount = View->BulkChunkCount;
+
+    Info.AssetDependencies.reserve(View->DependencyCount);
+    for (uint32_t DependencyIndex = 0; DependencyIndex < View->DependencyCount; ++DependencyIndex)
     {
-      Info.Name = m_Impl->StringTable[Entry.NameStringId];
+      const auto Dependency = GetAssetDependency(Index, DependencyIndex);
+      if (Dependency.has_value())
+      {
+        Info.AssetDependencies.push_back(AssetDependencyRef{Dependency->Id, std::string(Dependency->LogicalName), Dependency->Kind});
+      }
     }
 
-    if (Entry.VariantStringId != 0xFFFFFFFF && Entry.VariantStringId < m_Impl->StringTable.size())
+    return Info;
+  }
+
+  std::expected<AssetInfo, std::string> AssetPackReader::FindAsset(AssetId Id) const
+  {
+    const auto AssetIndex = m_Impl->FindAssetIndex(Id);
+    if (!AssetIndex.has_value())
     {
-      Info.VariantKey = m_Impl->StringTable[Entry.VariantStringId];
+      return std::unexpected("Asset not found: " + Id.ToString());
     }
 
-    Info.BulkChunkCount = Entry.BulkCount;
+    return GetAssetInfo(*AssetIndex);
+  }
 
-    const auto DependencyOwnerIt = m_Impl->AssetIndexToDependencyOwnerIndex.find(Index);
-    if (DependencyOwnerIt != m_Impl->AssetIndexToDependencyOwnerIndex.end())
-    {
-      const auto& Owner = m_Impl->DependencyOwners[DependencyOwnerIt->second];
-      Info.AssetDependencies.reserve(Owner.DependencyCount);
-      for (uint32_t DependencyIndex = 0; DependencyIndex < Owner.DependencyCount; ++DependencyIndex)
+  std::vector<AssetInfo> AssetPackReader::FindAssetsByName(const std::string_view Name) const
+  {
+    std::vector<AssetInfo> Results;
+
+    uint64_t NameHash = XXH3_64bits(Name.data(), Name.size());
+    m_Impl->ForEachAssetWithNameHash(NameHash, [&](const uint32_t Index) {
+      // Compare against the mapped name before materializing anything
+      if (m_Impl->GetString(m_Impl->IndexEntries[Index].NameStringId) != Name)
       {
-        const auto& StoredDependency = m_Impl->DependencyEntries[Owner.FirstDependencyIndex + DependencyIndex];
-        AssetDependencyRef Dependency{};
-        std::memcpy(Dependency.Id.Bytes, StoredDependency.AssetId, sizeof(Dependency.Id.Bytes));
-        if (StoredDependency.LogicalNameStringId != Pack::kInvalidStringId)
-        {
-          Dependency.LogicalName = m_Impl->StringTable[StoredDependency.LogicalNameStringId];
-        }
-        Dependency.Kind = static_cast<EAssetDependencyKind>(StoredDependency.Kind);
-        Info.AssetDependencies.push_back(std::move(Dependency));
+        return;
       }
+      auto Info = GetAssetInfo(Index);
+      if (Info.has_value())
+      {
+        Results.push_back(std::move(*Info));
+      }
+    });
+
+    return Results;
+  }
+
+  std::optional<AssetInfoView> AssetPackReader::GetAssetInfoView(const uint32_t Index) const
+  {
+    if (Index >= m_Impl->IndexEntries.size())
+    {
+      return std::nullopt;
     }
 
-    return Info;
+    const auto& Entry = m_Impl->IndexEntries[Index];
+
+    AssetInfoView View;
+    View.Index = Index;
+    std::memcpy(View.Id.Bytes, Entry.AssetId, 16);
+    std::memcpy(View.AssetKind.Bytes, Entry.AssetKind, 16);
+    std::memcpy(View.CookedPayloadType.Bytes, Entry.CookedPayloadType, 16);
+    View.SchemaVersion = Entry.CookedSchemaVersion;
+    View.Name = m_Impl->GetString(Entry.NameStringId);
+    if (Entry.VariantStringId != Pack::kInvalidStringId)
+    {
+      View.VariantKey = m_Impl->GetString(Entry.VariantStringId);
+    }
+    View.BulkChunkCount = Entry.BulkCount;
+    if (const auto Owner = m_Impl->FindDependencyOwner(Index))
+    {
+      View.DependencyCount = Owner->DependencyCount;
+    }
+    return View;
   }
 
-  std::expected<AssetInfo, std::string> AssetPackReader::FindAsset(AssetId Id) const
+  std::optional<AssetInfoView> AssetPackReader::FindAssetView(const AssetId Id) const
   {
-    auto It = m_Impl->AssetIdToIndex.find(Id);
-    if (It == m_Impl->AssetIdToIndex.end())
+    const auto AssetIndex = m_Impl->FindAssetIndex(Id);
+    if (!AssetIndex.has_value())
     {
-      return std::unexpected("Asset not found: " + Id.ToString());
+      return std::nullopt;
     }
+    return GetAssetInfoView(*AssetIndex);
+  }
 
-    return GetAssetInfo(It->second);
+  std::optional<AssetInfoView> AssetPackReader::FindAssetViewByName(const std::string_view Name) const
+  {
+    const auto AssetIndex = FindAssetIndexByName(Name);
+    if (!AssetIndex.has_value())
+    {
+      return std::nullopt;
+    }
+    return GetAssetInfoView(*AssetIndex);
   }
 
-  std::vector<AssetInfo> AssetPackReader::FindAssetsByName(const std::string& Name) const
+  std::optional<AssetDependencyView> AssetPackReader::GetAssetDependency(const uint32_t AssetIndex, const uint32_t DependencyIndex) const
   {
-    std::vector<AssetInfo> Results;
+    const auto Owner = m_Impl->FindDependencyOwner(AssetIndex);
+    if (!Owner || DependencyIndex >= Owner->DependencyCount)
+    {
+      return std::nullopt;
+    }
 
-    uint64_t NameHash = XXH3_64bits(Name.data(), Name.size());
-    auto It = m_Impl->NameHashToIndices.find(NameHash);
-    if (It != m_Impl->NameHashToIndices.end())
+    const auto StoredDependency = m_Impl->DependencyEntries[Owner->FirstDependencyIndex + DependencyIndex];
+    if (!m_Impl->ValidateDependency(StoredDependency).has_value())
+    {
+      return std::nullopt;
+    }
+    AssetDependencyView Dependency;
+    std::memcpy(Dependency.Id.Bytes, StoredDependency.AssetId, sizeof(Dependency.Id.Bytes));
+    if (StoredDependency.LogicalNameStringId != Pack::kInvalidStringId)
     {
-      for (uint32_t Index : It->second)
+      Dependency.LogicalName = m_Impl->GetString(StoredDependency.LogicalNameStringId);
+    }
+    Dependency.Kind = static_cast<EAssetDependencyKind>(StoredDependency.Kind);
+    return Dependency;
+  }
+
+  std::optional<uint32_t> AssetPackReader::FindAssetIndex(const AssetId Id) const
+  {
+    return m_Impl->FindAssetIndex(Id);
+  }
+
+  std::optional<uint32_t> AssetPackReader::FindAssetIndexByName(const std::string_view Name) const
+  {
+    std::optional<uint32_t> Result;
+    m_Impl->ForEachAssetWithNameHash(XXH3_64bits(Name.data(), Name.size()), [&](const uint32_t Index) {
+      if (!Result && m_Impl->GetString(m_Impl->IndexEntries[Index].NameStringId) == Name)
       {
-        auto Info = GetAssetInfo(Index);
-        if (Info.has_value() && Info->Name == Name)
-        {
-          Results.push_back(*Info);
-        }
+        Result = Index;
       }
+    });
+    return Result;
+  }
+
+  AssetId AssetPackReader::GetAssetId(const uint32_t Index) const
+  {
+    AssetId Id{};
+    if (Index < m_Impl->IndexEntries.size())
+    {
+      std::memcpy(Id.Bytes, m_Impl->IndexEntries[Index].AssetId, sizeof(Id.Bytes));
     }
+    return Id;
+  }
 
-    return Results;
+  std::string_view AssetPackReader::GetAssetName(const uint32_t Index) const
+  {
+    if (Index >= m_Impl->IndexEntries.size())
+    {
+      return {};
+    }
+    return m_Impl->GetString(m_Impl->IndexEntries[Index].NameStringId);
   }
 
   std::expected<TypedPayload, std::string> AssetPackReader::LoadCookedPayload(AssetId Id) const
   {
-    auto It = m_Impl->AssetIdToIndex.find(Id);
-    if (It == m_Impl->AssetIdToIndex.end())
+    const auto AssetIndex = m_Impl->FindAssetIndex(Id);
+    if (!AssetIndex.has_value())
     {
       return std::unexpected("Asset not found: " + Id.ToString());
     }
 
-    const auto& Entry = m_Impl->IndexEntries[It->second];
+    const auto& Entry = m_Impl->IndexEntries[*AssetIndex];
+
+    if (Entry.Flags & Pack::IndexEntryFlag_SolidBlock)
+    {
+      auto ViewResult = m_Impl->LoadSolidMemberView(Entry);
+      if (!ViewResult.has_value())
+      {
+        return std::unexpected(ViewResult.error());
+      }
+      TypedPayload Payload;
+      std::memcpy(Payload.PayloadType.Bytes, Entry.CookedPayloadType, 16);
+      Payload.SchemaVersion = Entry.CookedSchemaVersion;
+      Payload.Bytes = ViewResult->ToVector();
+      return Payload;
+    }
 
     // FIX #3 & #4: Pass entry for size and identity validation
     auto ChunkResult = m_Impl->LoadChunk(Entry.PayloadChunkOffset, Entry.PayloadChunkSizeCompressed, Entry.PayloadChunkSizeUncompressed,
@@ -912,13 +2311,13 @@ namespace SnAPI::AssetPipeline
 
   std::expected<std::vector<uint8_t>, std::string> AssetPackReader::LoadBulkChunk(AssetId Id, uint32_t BulkIndex) const
   {
-    auto It = m_Impl->AssetIdToIndex.find(Id);
-    if (It == m_Impl->AssetIdToIndex.end())
+    const auto AssetIndex = m_Impl->FindAssetIndex(Id);
+    if (!AssetIndex.has_value())
     {
       return std::unexpected("Asset not found: " + Id.ToString());
     }
 
-    const auto& Entry = m_Impl->IndexEntries[It->second];
+    const auto& Entry = m_Impl->IndexEntries[*AssetIndex];
 
     if (!(Entry.Flags & Pack::IndexEntryFlag_HasBulk) || BulkIndex >= Entry.BulkCount)
     {
@@ -933,23 +2332,229 @@ namespace SnAPI::AssetPipeline
 
     const auto& BulkEntry = m_Impl->BulkEntries[GlobalBulkIndex];
 
+    if (m_Impl->ShouldReadDirect(BulkEntry))
+    {
+      std::vector<uint8_t> Output(static_cast<size_t>(BulkEntry.SizeUncompressed));
+      auto ReadResult = m_Impl->LoadChunkDirectInto(Output, BulkEntry, Entry.AssetId);
+      if (!ReadResult.has_value())
+      {
+        return std::unexpected(ReadResult.error());
+      }
+      Output.resize(*ReadResult);
+      return Output;
+    }
+
     // Pass bulk entry for size and identity validation.
     // SubIndex is metadata and does not have to equal the bulk array position.
-    return m_Impl->LoadChunk(BulkEntry.ChunkOffset, BulkEntry.SizeCompressed, BulkEntry.SizeUncompressed,
-                             nullptr,           // Not validating against main entry
-                             &BulkEntry,        // For bulk identity validation
-                             Entry.AssetId);    // For AssetId validation
+    auto Output = m_Impl->LoadChunk(BulkEntry.ChunkOffset, BulkEntry.SizeCompressed, BulkEntry.SizeUncompressed,
+                                    nullptr,           // Not validating against main entry
+                                    &BulkEntry,        // For bulk identity validation
+                                    Entry.AssetId);    // For AssetId validation
+    m_Impl->ReleaseConsumedBulk(BulkEntry);
+    return Output;
+  }
+
+  std::expected<size_t, std::string> AssetPackReader::LoadBulkChunk(AssetId Id, uint32_t BulkIndex, std::span<uint8_t> Output) const
+  {
+    const auto AssetIndex = m_Impl->FindAssetIndex(Id);
+    if (!AssetIndex.has_value())
+    {
+      return std::unexpected("Asset not found: " + Id.ToString());
+    }
+
+    const auto& Entry = m_Impl->IndexEntries[*AssetIndex];
+
+    if (!(Entry.Flags & Pack::IndexEntryFlag_HasBulk) || BulkIndex >= Entry.BulkCount)
+    {
+      return std::unexpected("Bulk chunk index out of range");
+    }
+
+    uint32_t GlobalBulkIndex = Entry.BulkFirstIndex + BulkIndex;
+    if (GlobalBulkIndex >= m_Impl->BulkEntries.size())
+    {
+      return std::unexpected("Invalid bulk entry index");
+    }
+
+    const auto& BulkEntry = m_Impl->BulkEntries[GlobalBulkIndex];
+    if (m_Impl->ShouldReadDirect(BulkEntry))
+    {
+      return m_Impl->LoadChunkDirectInto(Output, BulkEntry, Entry.AssetId);
+    }
+    auto Written = m_Impl->LoadChunkInto(Output, BulkEntry.ChunkOffset, BulkEntry.SizeCompressed, BulkEntry.SizeUncompressed, nullptr,
+                                         &BulkEntry, Entry.AssetId);
+    m_Impl->ReleaseConsumedBulk(BulkEntry);
+    return Written;
+  }
+
+  std::expected<std::vector<uint8_t>, std::string> AssetPackReader::LoadBulkChunkRange(AssetId Id, uint32_t BulkIndex, uint64_t Offset,
+                                                                                       uint64_t Length) const
+  {
+    auto InfoResult = GetBulkChunkInfo(Id, BulkIndex);
+    if (!InfoResult.has_value())
+    {
+      return std::unexpected(InfoResult.error());
+    }
+    if (Offset > InfoResult->UncompressedSize)
+    {
+      return std::unexpected("Bulk chunk range offset is past the end of the chunk");
+    }
+
+    std::vector<uint8_t> Output(static_cast<size_t>(std::min(Length, InfoResult->UncompressedSize - Offset)));
+    auto ReadResult = LoadBulkChunkRange(Id, BulkIndex, Offset, Output);
+    if (!ReadResult.has_value())
+    {
+      return std::unexpected(ReadResult.error());
+    }
+    return Output;
+  }
+
+  std::expected<size_t, std::string> AssetPackReader::LoadBulkChunkRange(AssetId Id, uint32_t BulkIndex, uint64_t Offset,
+                                                                         std::span<uint8_t> Output) const
+  {
+    const auto AssetIndex = m_Impl->FindAssetIndex(Id);
+    if (!AssetIndex.has_value())
+    {
+      return std::unexpected("Asset not found: " + Id.ToString());
+    }
+
+    const auto& Entry = m_Impl->IndexEntries[*AssetIndex];
+
+    if (!(Entry.Flags & Pack::IndexEntryFlag_HasBulk) || BulkIndex >= Entry.BulkCount)
+    {
+      return std::unexpected("Bulk chunk index out of range");
+    }
+
+    uint32_t GlobalBulkIndex = Entry.BulkFirstIndex + BulkIndex;
+    if (GlobalBulkIndex >= m_Impl->BulkEntries.size())
+    {
+      return std::unexpected("Invalid bulk entry index");
+    }
+
+    const auto& BulkEntry = m_Impl->BulkEntries[GlobalBulkIndex];
+    if (Offset > BulkEntry.SizeUncompressed)
+    {
+      return std::unexpected("Bulk chunk range offset is past the end of the chunk");
+    }
+
+    const auto Target = Output.first(static_cast<size_t>(std::min<uint64_t>(Output.size(), BulkEntry.SizeUncompressed - Offset)));
+    auto ReadResult = m_Impl->LoadBulkRangeInto(Target, Offset, BulkEntry, Entry.AssetId);
+    if (!ReadResult.has_value())
+    {
+      return std::unexpected(ReadResult.error());
+    }
+    return Target.size();
+  }
+
+  std::expected<TypedPayloadView, std::string> AssetPackReader::LoadCookedPayloadView(AssetId Id) const
+  {
+    const auto AssetIndex = m_Impl->FindAssetIndex(Id);
+    if (!AssetIndex.has_value())
+    {
+      return std::unexpected("Asset not found: " + Id.ToString());
+    }
+
+    const auto& Entry = m_Impl->IndexEntries[*AssetIndex];
+
+    auto ViewResult = (Entry.Flags & Pack::IndexEntryFlag_SolidBlock)
+                          ? m_Impl->LoadSolidMemberView(Entry)
+                          : m_Impl->LoadChunkView(Entry.PayloadChunkOffset, Entry.PayloadChunkSizeCompressed,
+                                                  Entry.PayloadChunkSizeUncompressed, &Entry, nullptr);
+    if (!ViewResult.has_value())
+    {
+      return std::unexpected(ViewResult.error());
+    }
+
+    TypedPayloadView Payload;
+    std::memcpy(Payload.PayloadType.Bytes, Entry.CookedPayloadType, 16);
+    Payload.SchemaVersion = Entry.CookedSchemaVersion;
+    Payload.Bytes = std::move(*ViewResult);
+
+    return Payload;
+  }
+
+  std::expected<AssetDataView, std::string> AssetPackReader::LoadBulkChunkView(AssetId Id, uint32_t BulkIndex) const
+  {
+    const auto AssetIndex = m_Impl->FindAssetIndex(Id);
+    if (!AssetIndex.has_value())
+    {
+      return std::unexpected("Asset not found: " + Id.ToString());
+    }
+
+    const auto& Entry = m_Impl->IndexEntries[*AssetIndex];
+
+    if (!(Entry.Flags & Pack::IndexEntryFlag_HasBulk) || BulkIndex >= Entry.BulkCount)
+    {
+      return std::unexpected("Bulk chunk index out of range");
+    }
+
+    uint32_t GlobalBulkIndex = Entry.BulkFirstIndex + BulkIndex;
+    if (GlobalBulkIndex >= m_Impl->BulkEntries.size())
+    {
+      return std::unexpected("Invalid bulk entry index");
+    }
+
+    const auto& BulkEntry = m_Impl->BulkEntries[GlobalBulkIndex];
+    return m_Impl->LoadChunkView(BulkEntry.ChunkOffset, BulkEntry.SizeCompressed, BulkEntry.SizeUncompressed, nullptr, &BulkEntry,
+                                 Entry.AssetId);
+  }
+
+  std::expected<std::vector<AssetDataView>, std::string> AssetPackReader::LoadBulkChunks(AssetId Id,
+                                                                                         std::span<const uint32_t> BulkIndices,
+                                                                                         const uint32_t MaxThreads) const
+  {
+    const auto AssetIndex = m_Impl->FindAssetIndex(Id);
+    if (!AssetIndex.has_value())
+    {
+      return std::unexpected("Asset not found: " + Id.ToString());
+    }
+
+    return m_Impl->LoadBulkChunkViews(m_Impl->IndexEntries[*AssetIndex], BulkIndices, MaxThreads);
+  }
+
+  std::expected<std::vector<AssetPackReader::FileRange>, std::string> AssetPackReader::GetAssetFileRanges(AssetId Id,
+                                                                                                         const bool bSkipResident) const
+  {
+    const auto AssetIndex = m_Impl->FindAssetIndex(Id);
+    if (!AssetIndex.has_value())
+    {
+      return std::unexpected("Asset not found: " + Id.ToString());
+    }
+
+    const auto& Entry = m_Impl->IndexEntries[*AssetIndex];
+    std::vector<FileRange> Ranges;
+    Ranges.push_back({Entry.PayloadChunkOffset, Entry.PayloadChunkSizeCompressed});
+    if (Entry.Flags & Pack::IndexEntryFlag_HasBulk)
+    {
+      const uint64_t BulkEnd = std::min<uint64_t>(static_cast<uint64_t>(Entry.BulkFirstIndex) + Entry.BulkCount, m_Impl->BulkEntries.size());
+      for (uint64_t GlobalBulkIndex = Entry.BulkFirstIndex; GlobalBulkIndex < BulkEnd; ++GlobalBulkIndex)
+      {
+        const auto& BulkEntry = m_Impl->BulkEntries[GlobalBulkIndex];
+        if (!m_Impl->ShouldReadDirect(BulkEntry))
+        {
+          Ranges.push_back({BulkEntry.ChunkOffset, BulkEntry.SizeCompressed});
+        }
+      }
+    }
+
+    auto Runs = m_Impl->CoalesceRanges(std::move(Ranges));
+    if (bSkipResident)
+    {
+      std::erase_if(Runs, [this](const FileRange& Run) {
+        return m_Impl->MappedReader->IsResident(static_cast<size_t>(Run.Offset), static_cast<size_t>(Run.Size));
+      });
+    }
+    return Runs;
   }
 
   std::expected<AssetPackReader::BulkChunkInfo, std::string> AssetPackReader::GetBulkChunkInfo(AssetId Id, uint32_t BulkIndex) const
   {
-    auto It = m_Impl->AssetIdToIndex.find(Id);
-    if (It == m_Impl->AssetIdToIndex.end())
+    const auto AssetIndex = m_Impl->FindAssetIndex(Id);
+    if (!AssetIndex.has_value())
     {
       return std::unexpected("Asset not found: " + Id.ToString());
     }
 
-    const auto& Entry = m_Impl->IndexEntries[It->second];
+    const auto& Entry = m_Impl->IndexEntries[*AssetIndex];
 
     if (!(Entry.Flags & Pack::IndexEntryFlag_HasBulk) || BulkIndex >= Entry.BulkCount)
     {
@@ -976,13 +2581,13 @@ namespace SnAPI::AssetPipeline
 
   std::expected<uint32_t, std::string> AssetPackReader::FindBulkChunkIndex(AssetId Id, EBulkSemantic Semantic, uint32_t SubIndex) const
   {
-    auto It = m_Impl->AssetIdToIndex.find(Id);
-    if (It == m_Impl->AssetIdToIndex.end())
+    const auto AssetIndex = m_Impl->FindAssetIndex(Id);
+    if (!AssetIndex.has_value())
     {
       return std::unexpected("Asset not found: " + Id.ToString());
     }
 
-    const auto& Entry = m_Impl->IndexEntries[It->second];
+    const auto& Entry = m_Impl->IndexEntries[*AssetIndex];
     if (!(Entry.Flags & Pack::IndexEntryFlag_HasBulk))
     {
       return std::unexpected("Asset has no bulk chunks");
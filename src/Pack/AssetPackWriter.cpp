@@ -4,10 +4,21 @@
 #define XXH_INLINE_ALL
 #include <xxhash.h>
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <fstream>
 #include <filesystem>
 #include <limits>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <cstring>
 
 namespace SnAPI::AssetPipeline
@@ -25,66 +36,1948 @@ namespace SnAPI::AssetPipeline
       std::vector<AssetPackEntry> Assets;
       Pack::ESnPakCompression Compression = Pack::ESnPakCompression::ZstdFast;
       Pack::ESnPakCompressionLevel CompressionLevel = Pack::ESnPakCompressionLevel::Fast;
+      uint32_t CompressionThreads = 0; // 0 = one per hardware thread
+      bool bWriteLookupTables = true;
+      bool bCompressIndex = false;
+      bool bDeduplicateChunks = true;
+      uint32_t ChunkAlignment = 1;
+      bool bAutoCompression = false;
+      PackAutoCompressionSettings AutoCompression;
+      uint64_t FrameThreshold = 8ull * 1024 * 1024;
+      uint32_t FrameSize = 1024 * 1024;
+      PackDictionarySettings DictionaryTraining;
+      PackSolidBlockSettings SolidBlocks;
+      std::vector<AssetId> AccessOrderProfile;
+
+      // Dictionaries of the pack being written, in dictionary block order: carried over from the
+      // existing pack by AppendUpdate, then trained for the current write
+      struct KindDictionary
+      {
+          TypeId AssetKind;
+          std::shared_ptr<const Pack::ZstdEncoderDictionary> Dictionary;
+      };
+      std::vector<KindDictionary> Dictionaries;
+
+      // Compressed bulk chunks above this size are always framed; single-block LZ4 is limited
+      // to 2 GiB and one block of that size cannot be read partially anyway
+      static constexpr uint64_t kMaxSingleBlockSize = 1024ull * 1024 * 1024;
+
+      struct SolidBlock;
+
+      // Where a small main payload lives inside a solid block
+      struct SolidMember
+      {
+          SolidBlock* Block = nullptr;
+          uint32_t Offset = 0;
+          uint32_t Size = 0;
+          XXH128_hash_t Hash{};
+      };
+
+      // A chunk ready to be written: completed header followed by its (possibly compressed) data.
+      // SharedOffset is set when an identical chunk was already written there; Data is then empty.
+      struct EncodedChunk
+      {
+          Pack::SnPakChunkHeaderV1 Header{};
+          std::vector<uint8_t> Data;
+          std::optional<uint64_t> SharedOffset;
+          bool bAutoCompressed = false; // the codec was chosen by EPackCompression::Auto
+          std::optional<SolidMember> Solid; // the payload is a slice of this solid block chunk
+      };
+
+      // Everything a chunk header depends on apart from the owning AssetId and compressed size.
+      // Chunks with equal keys decode to the same bytes and pass the same identity checks, so
+      // they can share one copy in the pack.
+      struct ChunkContentKey
+      {
+          uint64_t HashHi = 0;
+          uint64_t HashLo = 0;
+          uint64_t SizeUncompressed = 0;
+          uint8_t PayloadType[16] = {};
+          uint32_t SchemaVersion = 0;
+          uint16_t Level = 0;
+          uint8_t ChunkKind = 0;
+          uint8_t Compression = 0;
+
+          bool operator==(const ChunkContentKey&) const = default;
+      };
+
+      struct ChunkContentKeyHasher
+      {
+          size_t operator()(const ChunkContentKey& Key) const
+          {
+            // The content hash already mixes well; the other fields rarely differ for equal hashes
+            return static_cast<size_t>(Key.HashLo ^ (Key.HashHi * 0x9E3779B97F4A7C15ull) ^ Key.ChunkKind ^ (static_cast<uint64_t>(Key.Compression) << 8));
+          }
+      };
+
+      struct WrittenChunk
+      {
+          uint64_t Offset = 0;
+          Pack::SnPakChunkHeaderV1 Header{};
+      };
+
+      // Chunks already present in the output, by content
+      using ChunkDedupTable = std::unordered_map<ChunkContentKey, WrittenChunk, ChunkContentKeyHasher>;
+
+      // Per-codec totals of the current write, indexed by Pack::ESnPakCompression
+      std::array<PackCodecStats, 5> CodecStats{};
+
+      // Identifies one chunk of a pending asset. ChunkIndex 0 is the main payload,
+      // ChunkIndex N > 0 is bulk chunk N - 1. When deduplicating, the content hash is computed
+      // up front and bShared marks chunks whose content is already (or will first be) written
+      // by an earlier job, so they are never compressed.
+      struct ChunkJob
+      {
+          size_t AssetIndex = 0;
+          size_t ChunkIndex = 0;
+          std::optional<XXH128_hash_t> Hash;
+          ChunkContentKey Key;
+          bool bShared = false;
+          const SolidMember* Solid = nullptr; // main payload stored in a solid block
+      };
+
+      // The bytes of a chunk and the resolved settings used to encode them
+      struct ChunkSource
+      {
+          const AssetPackEntry* Asset = nullptr;
+          const std::vector<uint8_t>* Bytes = nullptr;
+          Pack::ESnPakChunkKind Kind = Pack::ESnPakChunkKind::MainPayload;
+          uint32_t SchemaVersion = 0;
+          Pack::ESnPakCompression Compression = Pack::ESnPakCompression::None;
+          Pack::ESnPakCompressionLevel Level = Pack::ESnPakCompressionLevel::Default;
+          uint32_t FrameSize = 0; // compress in independent frames of this size (0 = one block)
+          bool bAutoCompression = false; // Compression/Level are picked by ChooseAutoCompression
+          const Pack::ZstdEncoderDictionary* Dictionary = nullptr; // compress against this dictionary
+      };
+
+      // Small main payloads gathered into one SolidBlock chunk. The job of the leader (the first
+      // member in job order) encodes and writes the block; every other member shares it.
+      struct SolidBlock
+      {
+          std::vector<uint8_t> Bytes;
+          ChunkSource Source;
+          XXH128_hash_t Hash{};
+          ChunkContentKey Key;
+          size_t LeaderIndex = 0;
+          uint32_t MemberCount = 0;
+      };
+
+      // Index metadata kept for an asset whose chunks were already streamed to disk
+      struct StreamedAsset
+      {
+          std::string Name;
+          std::string VariantKey;
+          std::vector<AssetDependencyRef> AssetDependencies;
+      };
+
+      // State of an in-progress BeginStreamingWrite
+      struct StreamingState
+      {
+          std::string OutputPath;
+          std::string TempPath;
+          std::ofstream File;
+          uint64_t CurrentOffset = 0;
+          uint64_t BufferedBytes = 0;
+          std::vector<StreamedAsset> Assets;
+          std::vector<Pack::SnPakIndexEntryV1> IndexEntries;
+          std::vector<Pack::SnPakBulkEntryV1> BulkEntries;
+          ChunkDedupTable WrittenChunks;
+          uint32_t ChunkAlignment = 1; // fixed when the stream begins
+          std::string Error; // first flush failure, reported by Write()
+      };
+
+      uint64_t StreamingBudget = 256ull * 1024 * 1024;
+      std::unique_ptr<StreamingState> Streaming;
+
+      ~Impl()
+      {
+        AbandonStreaming();
+      }
+
+      void AbandonStreaming()
+      {
+        if (!Streaming)
+        {
+          return;
+        }
+        Streaming->File.close();
+        std::error_code Ec;
+        std::filesystem::remove(Streaming->TempPath, Ec);
+        Streaming.reset();
+      }
+
+      static uint64_t GetAssetDataSize(const AssetPackEntry& Asset)
+      {
+        uint64_t Size = Asset.Cooked.Bytes.size();
+        for (const auto& Bulk : Asset.Bulk)
+        {
+          Size += Bulk.Bytes.size();
+        }
+        return Size;
+      }
 
       static Pack::ESnPakCompression ToInternalCompression(const EPackCompression Mode)
       {
         switch (Mode)
         {
-          case EPackCompression::None:
-            return Pack::ESnPakCompression::None;
-          case EPackCompression::LZ4:
-            return Pack::ESnPakCompression::LZ4;
-          case EPackCompression::LZ4HC:
-            return Pack::ESnPakCompression::LZ4HC;
-          case EPackCompression::Zstd:
-            return Pack::ESnPakCompression::Zstd;
-          case EPackCompression::ZstdFast:
-            return Pack::ESnPakCompression::ZstdFast;
-          default:
-            return Pack::ESnPakCompression::Zstd;
+          case EPackCompression::None:
+            return Pack::ESnPakCompression::None;
+          case EPackCompression::LZ4:
+            return Pack::ESnPakCompression::LZ4;
+          case EPackCompression::LZ4HC:
+            return Pack::ESnPakCompression::LZ4HC;
+          case EPackCompression::Zstd:
+            return Pack::ESnPakCompression::Zstd;
+          case EPackCompression::ZstdFast:
+            return Pack::ESnPakCompression::ZstdFast;
+          default:
+            return Pack::ESnPakCompression::Zstd;
+        }
+      }
+
+      static EPackCompression ToPublicCompression(const Pack::ESnPakCompression Mode)
+      {
+        switch (Mode)
+        {
+          case Pack::ESnPakCompression::LZ4:
+            return EPackCompression::LZ4;
+          case Pack::ESnPakCompression::LZ4HC:
+            return EPackCompression::LZ4HC;
+          case Pack::ESnPakCompression::Zstd:
+            return EPackCompression::Zstd;
+          case Pack::ESnPakCompression::ZstdFast:
+            return EPackCompression::ZstdFast;
+          case Pack::ESnPakCompression::None:
+          default:
+            return EPackCompression::None;
+        }
+      }
+
+      static Pack::ESnPakCompressionLevel ToInternalCompressionLevel(const EPackCompressionLevel Level)
+      {
+        switch (Level)
+        {
+          case EPackCompressionLevel::Fast:
+            return Pack::ESnPakCompressionLevel::Fast;
+          case EPackCompressionLevel::High:
+            return Pack::ESnPakCompressionLevel::High;
+          case EPackCompressionLevel::Max:
+            return Pack::ESnPakCompressionLevel::Max;
+          case EPackCompressionLevel::Default:
+          default:
+            return Pack::ESnPakCompressionLevel::Default;
+        }
+      }
+
+      static Pack::ESnPakCompression ResolveCompression(const std::optional<EPackCompression>& Override,
+                                                        const Pack::ESnPakCompression Fallback)
+      {
+        return Override ? ToInternalCompression(*Override) : Fallback;
+      }
+
+      static Pack::ESnPakCompressionLevel ResolveCompressionLevel(const std::optional<EPackCompressionLevel>& Override,
+                                                                  const Pack::ESnPakCompressionLevel Fallback,
+                                                                  const Pack::ESnPakCompression Compression)
+      {
+        if (Override)
+        {
+          return ToInternalCompressionLevel(*Override);
+        }
+        if (Compression == Pack::ESnPakCompression::None)
+        {
+          return Pack::ESnPakCompressionLevel::Default;
+        }
+        return Fallback;
+      }
+
+      std::vector<uint8_t> CompressData(const uint8_t* Data, size_t Size) const
+      {
+        return Pack::Compress(Data, Size, Compression, CompressionLevel);
+      }
+
+      // Chunk header for Source with every field but SizeCompressed filled in
+      static Pack::SnPakChunkHeaderV1 MakeChunkHeader(const ChunkSource& Source, const XXH128_hash_t& Hash)
+      {
+        Pack::SnPakChunkHeaderV1 Header{};
+        std::memcpy(Header.Magic, Pack::kChunkMagic, 4);
+        Header.Version = 1;
+        Pack::CopyUuid(Header.AssetId, Source.Asset->Id.Bytes);
+        // Solid blocks mix payload types; their AssetId only names the leading member
+        if (Source.Kind != Pack::ESnPakChunkKind::SolidBlock)
+        {
+          Pack::CopyUuid(Header.PayloadType, Source.Asset->Cooked.PayloadType.Bytes);
+        }
+        Header.SchemaVersion = Source.SchemaVersion;
+        Header.Compression = static_cast<uint8_t>(Source.Compression);
+        Header.ChunkKind = static_cast<uint8_t>(Source.Kind);
+        Header.Reserved0 = static_cast<uint16_t>(Source.Level);
+        if (Source.FrameSize != 0 && Source.Compression != Pack::ESnPakCompression::None)
+        {
+          Pack::SetChunkFlags(Header, Pack::ChunkFlag_Framed);
+        }
+        else if (Source.Dictionary != nullptr)
+        {
+          Pack::SetChunkFlags(Header, Pack::ChunkFlag_Dictionary);
+        }
+        Header.SizeUncompressed = Source.Bytes->size();
+        Header.HashHi = Hash.high64;
+        Header.HashLo = Hash.low64;
+        return Header;
+      }
+
+      static ChunkContentKey MakeChunkKey(const Pack::SnPakChunkHeaderV1& Header)
+      {
+        ChunkContentKey Key;
+        Key.HashHi = Header.HashHi;
+        Key.HashLo = Header.HashLo;
+        Key.SizeUncompressed = Header.SizeUncompressed;
+        Key.SchemaVersion = Header.SchemaVersion;
+        Key.Level = Header.Reserved0;
+        Key.ChunkKind = Header.ChunkKind;
+        Key.Compression = Header.Compression;
+        // Readers only check the payload type of main payload chunks, so bulk chunks of
+        // different payload types may share
+        if (Header.ChunkKind == static_cast<uint8_t>(Pack::ESnPakChunkKind::MainPayload))
+        {
+          Pack::CopyUuid(Key.PayloadType, Header.PayloadType);
+        }
+        return Key;
+      }
+
+      // Auto-compressed chunks are keyed without their codec: any stored copy of the content will
+      // do, and the codec is only known once the chunk has been encoded
+      static ChunkContentKey MakeAutoChunkKey(ChunkContentKey Key)
+      {
+        Key.Compression = 0xFF;
+        Key.Level = 0;
+        return Key;
+      }
+
+      static ChunkContentKey MakeSourceKey(const ChunkSource& Source, const XXH128_hash_t& Hash)
+      {
+        const ChunkContentKey Key = MakeChunkKey(MakeChunkHeader(Source, Hash));
+        return Source.bAutoCompression ? MakeAutoChunkKey(Key) : Key;
+      }
+
+      static XXH128_hash_t HashChunk(const ChunkSource& Source)
+      {
+        return XXH3_128bits(Source.Bytes->data(), Source.Bytes->size());
+      }
+
+      // Decode time per uncompressed byte relative to Zstd, used by the Auto cost model
+      static double GetRelativeDecodeCost(const Pack::ESnPakCompression Mode)
+      {
+        switch (Mode)
+        {
+          case Pack::ESnPakCompression::LZ4:
+          case Pack::ESnPakCompression::LZ4HC:
+            return 0.2;
+          case Pack::ESnPakCompression::ZstdFast:
+            return 0.7;
+          case Pack::ESnPakCompression::Zstd:
+            return 1.0;
+          case Pack::ESnPakCompression::None:
+          default:
+            return 0.0;
+        }
+      }
+
+      struct AutoCompressionChoice
+      {
+          Pack::ESnPakCompression Compression = Pack::ESnPakCompression::None;
+          Pack::ESnPakCompressionLevel Level = Pack::ESnPakCompressionLevel::Default;
+          std::optional<std::vector<uint8_t>> Data; // winning trial output, when it is the final encoding
+      };
+
+      // Trial-compress Source with every Auto candidate and pick the cheapest under the cost model.
+      // Small chunks are trialled whole; larger ones on a few evenly spaced samples.
+      AutoCompressionChoice ChooseAutoCompression(const ChunkSource& Source) const
+      {
+        AutoCompressionChoice Best;
+        const std::span<const uint8_t> Bytes(*Source.Bytes);
+        const uint64_t Size = Bytes.size();
+        if (Size == 0)
+        {
+          return Best;
+        }
+
+        std::vector<std::span<const uint8_t>> Samples;
+        const bool bWhole = Size <= AutoCompression.SampleBytes;
+        if (bWhole)
+        {
+          Samples.push_back(Bytes);
+        }
+        else
+        {
+          constexpr uint64_t kSampleCount = 4;
+          const uint64_t Window = std::max<uint64_t>(1, AutoCompression.SampleBytes / kSampleCount);
+          for (uint64_t SampleIndex = 0; SampleIndex < kSampleCount; ++SampleIndex)
+          {
+            const uint64_t Start = (Size - Window) * SampleIndex / (kSampleCount - 1);
+            Samples.push_back(Bytes.subspan(static_cast<size_t>(Start), static_cast<size_t>(Window)));
+          }
+        }
+        uint64_t SampledBytes = 0;
+        for (const auto& Sample : Samples)
+        {
+          SampledBytes += Sample.size();
+        }
+
+        // None stores every byte and costs nothing to decode
+        double BestCost = static_cast<double>(Size);
+        for (const auto& [Mode, Level] : AutoCompression.Candidates)
+        {
+          if (Mode == EPackCompression::None || Mode == EPackCompression::Auto)
+          {
+            continue;
+          }
+          const Pack::ESnPakCompression Candidate = ToInternalCompression(Mode);
+          const Pack::ESnPakCompressionLevel CandidateLevel = ToInternalCompressionLevel(Level);
+
+          uint64_t StoredBytes = 0;
+          std::vector<uint8_t> Output;
+          for (const auto& Sample : Samples)
+          {
+            Output = Pack::Compress(Sample.data(), Sample.size(), Candidate, CandidateLevel);
+            StoredBytes += Output.size();
+          }
+
+          const double EstimatedStored = static_cast<double>(StoredBytes) * static_cast<double>(Size) / static_cast<double>(SampledBytes);
+          if (EstimatedStored > static_cast<double>(Size) * (1.0 - AutoCompression.MinSavingsRatio))
+          {
+            continue;
+          }
+          const double Cost = EstimatedStored + AutoCompression.DecodeCostWeight * static_cast<double>(Size) * GetRelativeDecodeCost(Candidate);
+          if (Cost < BestCost)
+          {
+            BestCost = Cost;
+            Best.Compression = Candidate;
+            Best.Level = CandidateLevel;
+            Best.Data.reset();
+            if (bWhole && Source.FrameSize == 0)
+            {
+              Best.Data = std::move(Output);
+            }
+          }
+        }
+        return Best;
+      }
+
+      EncodedChunk EncodeChunk(ChunkSource Source, const XXH128_hash_t& Hash) const
+      {
+        EncodedChunk Chunk;
+        std::optional<std::vector<uint8_t>> TrialData;
+        if (Source.bAutoCompression)
+        {
+          auto Choice = ChooseAutoCompression(Source);
+          Source.Compression = Choice.Compression;
+          Source.Level = Choice.Level;
+          TrialData = std::move(Choice.Data);
+          Chunk.bAutoCompressed = true;
+        }
+
+        if (TrialData)
+        {
+          Chunk.Data = std::move(*TrialData);
+        }
+        else if (Source.Dictionary != nullptr)
+        {
+          Chunk.Data = Source.Dictionary->Compress(Source.Bytes->data(), Source.Bytes->size(), Source.Compression, Source.Level);
+        }
+        else if (Source.FrameSize != 0 && Source.Compression != Pack::ESnPakCompression::None)
+        {
+          Chunk.Data = Pack::CompressFrames(Source.Bytes->data(), Source.Bytes->size(), Source.FrameSize, Source.Compression, Source.Level);
+        }
+        else
+        {
+          Chunk.Data = Pack::Compress(Source.Bytes->data(), Source.Bytes->size(), Source.Compression, Source.Level);
+        }
+        Chunk.Header = MakeChunkHeader(Source, Hash);
+        Chunk.Header.SizeCompressed = Chunk.Data.size();
+        return Chunk;
+      }
+
+      ChunkSource DescribePayloadChunk(const AssetPackEntry& Asset) const
+      {
+        const bool bAuto = Asset.CompressionOverride ? *Asset.CompressionOverride == EPackCompression::Auto : bAutoCompression;
+        const auto AssetCompression = bAuto ? Pack::ESnPakCompression::None : ResolveCompression(Asset.CompressionOverride, Compression);
+        const auto AssetLevel = ResolveCompressionLevel(Asset.CompressionLevelOverride, CompressionLevel, AssetCompression);
+        ChunkSource Source{&Asset, &Asset.Cooked.Bytes, Pack::ESnPakChunkKind::MainPayload, Asset.Cooked.SchemaVersion, AssetCompression, AssetLevel, 0, bAuto};
+        if (IsDictionaryCandidate(Source))
+        {
+          Source.Dictionary = FindDictionary(Asset.AssetKind);
+        }
+        return Source;
+      }
+
+      // Small Zstd payloads can be compressed against their kind's dictionary
+      bool IsDictionaryCandidate(const ChunkSource& Source) const
+      {
+        const uint64_t Size = Source.Bytes->size();
+        return DictionaryTraining.bEnabled && !Source.bAutoCompression && Source.Kind == Pack::ESnPakChunkKind::MainPayload &&
+               (Source.Compression == Pack::ESnPakCompression::Zstd || Source.Compression == Pack::ESnPakCompression::ZstdFast) && Size > 0 &&
+               Size <= DictionaryTraining.MaxPayloadSize && !IsSolidCandidate(Source);
+      }
+
+      bool IsSolidCandidate(const ChunkSource& Source) const
+      {
+        return SolidBlocks.MaxAssetSize != 0 && Source.Kind == Pack::ESnPakChunkKind::MainPayload && Source.Bytes->size() <= SolidBlocks.MaxAssetSize;
+      }
+
+      // Assign the solid candidates among Assets to blocks, one open block per codec setting, in
+      // asset order. Payloads that already have a standalone copy in WrittenChunks keep sharing it,
+      // duplicates within the batch share one member (when deduplicating), and blocks that end up
+      // with a single member are dropped again. Members is indexed like Assets.
+      void BuildSolidBlocks(const std::vector<const AssetPackEntry*>& Assets,
+                            const ChunkDedupTable& WrittenChunks,
+                            std::deque<SolidBlock>& Blocks,
+                            std::vector<std::optional<SolidMember>>& Members) const
+      {
+        Members.assign(Assets.size(), std::nullopt);
+        if (SolidBlocks.MaxAssetSize == 0)
+        {
+          return;
+        }
+
+        const uint64_t BlockSize = std::clamp<uint64_t>(SolidBlocks.BlockSize, std::min(SolidBlocks.MaxAssetSize, AssetPackWriter::kMaxSolidBlockSize),
+                                                        AssetPackWriter::kMaxSolidBlockSize);
+        std::unordered_map<uint32_t, SolidBlock*> OpenBlocks; // by codec, level and Auto
+        std::unordered_map<ChunkContentKey, SolidMember, ChunkContentKeyHasher> Placed;
+        for (size_t AssetIndex = 0; AssetIndex < Assets.size(); ++AssetIndex)
+        {
+          const ChunkSource Source = DescribePayloadChunk(*Assets[AssetIndex]);
+          if (!IsSolidCandidate(Source) || Source.Bytes->size() > AssetPackWriter::kMaxSolidBlockSize)
+          {
+            continue;
+          }
+
+          const XXH128_hash_t Hash = HashChunk(Source);
+          ChunkContentKey MemberKey;
+          if (bDeduplicateChunks)
+          {
+            if (WrittenChunks.contains(MakeSourceKey(Source, Hash)))
+            {
+              continue;
+            }
+            MemberKey.HashHi = Hash.high64;
+            MemberKey.HashLo = Hash.low64;
+            MemberKey.SizeUncompressed = Source.Bytes->size();
+            if (const auto It = Placed.find(MemberKey); It != Placed.end())
+            {
+              Members[AssetIndex] = It->second;
+              ++It->second.Block->MemberCount;
+              continue;
+            }
+          }
+
+          const uint32_t Setting = static_cast<uint32_t>(Source.Compression) | (static_cast<uint32_t>(Source.Level) << 8) |
+                                   (Source.bAutoCompression ? 1u << 16 : 0u);
+          SolidBlock*& Block = OpenBlocks[Setting];
+          if (Block == nullptr || Block->Bytes.size() + Source.Bytes->size() > BlockSize)
+          {
+            Block = &Blocks.emplace_back();
+            Block->LeaderIndex = AssetIndex;
+            Block->Source = Source;
+            Block->Source.Kind = Pack::ESnPakChunkKind::SolidBlock;
+            Block->Source.SchemaVersion = 0;
+            Block->Source.Bytes = &Block->Bytes;
+          }
+
+          const SolidMember Member{Block, static_cast<uint32_t>(Block->Bytes.size()), static_cast<uint32_t>(Source.Bytes->size()), Hash};
+          Block->Bytes.insert(Block->Bytes.end(), Source.Bytes->begin(), Source.Bytes->end());
+          ++Block->MemberCount;
+          Members[AssetIndex] = Member;
+          if (bDeduplicateChunks)
+          {
+            Placed.emplace(MemberKey, Member);
+          }
+        }
+
+        for (auto& Member : Members)
+        {
+          if (Member && Member->Block->MemberCount < 2)
+          {
+            Member.reset();
+          }
+        }
+        for (SolidBlock& Block : Blocks)
+        {
+          Block.Hash = XXH3_128bits(Block.Bytes.data(), Block.Bytes.size());
+          Block.Key = MakeSourceKey(Block.Source, Block.Hash);
+        }
+      }
+
+      const Pack::ZstdEncoderDictionary* FindDictionary(const TypeId& AssetKind) const
+      {
+        for (const KindDictionary& Entry : Dictionaries)
+        {
+          if (Entry.AssetKind == AssetKind)
+          {
+            return Entry.Dictionary.get();
+          }
+        }
+        return nullptr;
+      }
+
+      // Train a dictionary for every asset kind among Assets that has none yet and enough small
+      // Zstd payloads, appending it to Dictionaries. A dictionary is only kept when it saves more
+      // on the sampled payloads than it costs to store.
+      void TrainDictionaries(const std::vector<const AssetPackEntry*>& Assets)
+      {
+        if (!DictionaryTraining.bEnabled)
+        {
+          return;
+        }
+
+        struct KindSamples
+        {
+            TypeId AssetKind;
+            std::vector<ChunkSource> Sources;
+            uint64_t Bytes = 0;
+        };
+        std::vector<KindSamples> Kinds;
+        for (const AssetPackEntry* Asset : Assets)
+        {
+          const ChunkSource Source = DescribePayloadChunk(*Asset);
+          if (!IsDictionaryCandidate(Source) || Source.Dictionary != nullptr)
+          {
+            continue;
+          }
+          auto It = std::find_if(Kinds.begin(), Kinds.end(), [Asset](const KindSamples& Kind) { return Kind.AssetKind == Asset->AssetKind; });
+          if (It == Kinds.end())
+          {
+            It = Kinds.insert(Kinds.end(), KindSamples{Asset->AssetKind});
+          }
+          if (It->Bytes + Source.Bytes->size() <= DictionaryTraining.MaxSampleBytes)
+          {
+            It->Bytes += Source.Bytes->size();
+            It->Sources.push_back(Source);
+          }
+        }
+
+        for (KindSamples& Kind : Kinds)
+        {
+          if (Kind.Sources.size() < std::max(1u, DictionaryTraining.MinSamples))
+          {
+            continue;
+          }
+
+          std::vector<std::span<const uint8_t>> Samples;
+          Samples.reserve(Kind.Sources.size());
+          for (const ChunkSource& Source : Kind.Sources)
+          {
+            Samples.emplace_back(*Source.Bytes);
+          }
+          std::vector<uint8_t> Trained = Pack::TrainZstdDictionary(Samples, DictionaryTraining.MaxDictionarySize);
+          const uint32_t Id = Pack::GetZstdDictionaryId(Trained);
+          const bool bIdTaken = std::any_of(Dictionaries.begin(), Dictionaries.end(),
+                                            [Id](const KindDictionary& Entry) { return Entry.Dictionary->GetId() == Id; });
+          if (Id == 0 || bIdTaken)
+          {
+            continue;
+          }
+
+          auto Dictionary = std::make_shared<const Pack::ZstdEncoderDictionary>(std::move(Trained));
+          int64_t Savings = -static_cast<int64_t>(Dictionary->GetBytes().size());
+          for (const ChunkSource& Source : Kind.Sources)
+          {
+            Savings += static_cast<int64_t>(Pack::Compress(Source.Bytes->data(), Source.Bytes->size(), Source.Compression, Source.Level).size());
+            Savings -= static_cast<int64_t>(Dictionary->Compress(Source.Bytes->data(), Source.Bytes->size(), Source.Compression, Source.Level).size());
+          }
+          if (Savings > 0)
+          {
+            Dictionaries.push_back({Kind.AssetKind, std::move(Dictionary)});
+          }
+        }
+      }
+
+      static std::vector<uint8_t> BuildDictionaryBlock(const std::vector<KindDictionary>& Dictionaries)
+      {
+        const size_t EntriesSize = Dictionaries.size() * sizeof(Pack::SnPakDictionaryEntryV1);
+        std::vector<uint8_t> Result(sizeof(Pack::SnPakDictionaryHeaderV1) + EntriesSize);
+        for (size_t Index = 0; Index < Dictionaries.size(); ++Index)
+        {
+          const std::span<const uint8_t> Bytes = Dictionaries[Index].Dictionary->GetBytes();
+          Pack::SnPakDictionaryEntryV1 Entry{};
+          Entry.DictionaryId = Dictionaries[Index].Dictionary->GetId();
+          Pack::CopyUuid(Entry.AssetKind, Dictionaries[Index].AssetKind.Bytes);
+          Entry.DataOffset = Result.size();
+          Entry.DataSize = Bytes.size();
+          std::memcpy(Result.data() + sizeof(Pack::SnPakDictionaryHeaderV1) + Index * sizeof(Entry), &Entry, sizeof(Entry));
+          Result.insert(Result.end(), Bytes.begin(), Bytes.end());
+        }
+
+        Pack::SnPakDictionaryHeaderV1 Header{};
+        std::memcpy(Header.Magic, Pack::kDictionaryMagic, 4);
+        Header.Version = 1;
+        Header.BlockSize = Result.size();
+        Header.DictionaryCount = static_cast<uint32_t>(Dictionaries.size());
+        const XXH128_hash_t Hash = XXH3_128bits(Result.data() + sizeof(Header), Result.size() - sizeof(Header));
+        Header.HashHi = Hash.high64;
+        Header.HashLo = Hash.low64;
+        std::memcpy(Result.data(), &Header, sizeof(Header));
+        return Result;
+      }
+
+      ChunkSource DescribeBulkChunk(const AssetPackEntry& Asset, const BulkChunk& Bulk) const
+      {
+        // bCompress = false keeps a chunk raw even in Auto mode; an explicit Auto override does not
+        const bool bAuto = Bulk.CompressionOverride ? *Bulk.CompressionOverride == EPackCompression::Auto : Bulk.bCompress && bAutoCompression;
+        const Pack::ESnPakCompression BulkCompression = bAuto                      ? Pack::ESnPakCompression::None
+                                                        : Bulk.CompressionOverride ? ToInternalCompression(*Bulk.CompressionOverride)
+                                                        : (Bulk.bCompress ? Compression : Pack::ESnPakCompression::None);
+        const Pack::ESnPakCompressionLevel BulkLevel = ResolveCompressionLevel(Bulk.CompressionLevelOverride, CompressionLevel, BulkCompression);
+        // Auto chunks only end up framed if a codec is chosen (see MakeChunkHeader)
+        const uint64_t Size = Bulk.Bytes.size();
+        const bool bFramed = (BulkCompression != Pack::ESnPakCompression::None || bAuto) && Size > FrameSize &&
+                             ((FrameThreshold != 0 && Size > FrameThreshold) || Size > kMaxSingleBlockSize);
+        return {&Asset, &Bulk.Bytes, Pack::ESnPakChunkKind::Bulk, 0, BulkCompression, BulkLevel, bFramed ? FrameSize : 0u, bAuto};
+      }
+
+      ChunkSource DescribeJob(const std::vector<const AssetPackEntry*>& Assets, const ChunkJob& Job) const
+      {
+        const AssetPackEntry& Asset = *Assets[Job.AssetIndex];
+        return Job.ChunkIndex == 0 ? DescribePayloadChunk(Asset) : DescribeBulkChunk(Asset, Asset.Bulk[Job.ChunkIndex - 1]);
+      }
+
+      EncodedChunk EncodeJob(const std::vector<const AssetPackEntry*>& Assets, const ChunkJob& Job) const
+      {
+        EncodedChunk Chunk;
+        if (!Job.bShared)
+        {
+          const ChunkSource Source = Job.Solid ? Job.Solid->Block->Source : DescribeJob(Assets, Job);
+          Chunk = EncodeChunk(Source, Job.Hash ? *Job.Hash : HashChunk(Source));
+        }
+        if (Job.Solid)
+        {
+          Chunk.Solid = *Job.Solid;
+        }
+        return Chunk;
+      }
+
+      static bool WriteChunk(std::ostream& File, const EncodedChunk& Chunk)
+      {
+        File.write(reinterpret_cast<const char*>(&Chunk.Header), sizeof(Chunk.Header));
+        File.write(reinterpret_cast<const char*>(Chunk.Data.data()), static_cast<std::streamsize>(Chunk.Data.size()));
+        return File.good();
+      }
+
+      static uint64_t GetChunkFileSize(const EncodedChunk& Chunk)
+      {
+        return sizeof(Chunk.Header) + Chunk.Header.SizeCompressed;
+      }
+
+      // Zero-fill from CurrentOffset up to the next chunk position that puts the chunk data on an
+      // Alignment boundary
+      static bool PadToChunkAlignment(std::ostream& File, uint64_t& CurrentOffset, const uint32_t Alignment)
+      {
+        static constexpr char kZeros[4096] = {};
+        uint64_t Padding = Pack::AlignChunkOffset(CurrentOffset, Alignment) - CurrentOffset;
+        CurrentOffset += Padding;
+        while (Padding > 0)
+        {
+          const uint64_t Count = std::min<uint64_t>(Padding, sizeof(kZeros));
+          File.write(kZeros, static_cast<std::streamsize>(Count));
+          Padding -= Count;
+        }
+        return File.good();
+      }
+
+      // Write Chunk at CurrentOffset (padded so its data is Alignment-aligned) and advance it,
+      // unless the chunk shares an already written copy. Returns the offset index entries should
+      // reference.
+      std::expected<uint64_t, std::string> PlaceChunk(std::ostream& File,
+                                                      const EncodedChunk& Chunk,
+                                                      uint64_t& CurrentOffset,
+                                                      const uint32_t Alignment,
+                                                      ChunkDedupTable& WrittenChunks)
+      {
+        if (Chunk.Solid && Chunk.Header.Compression < CodecStats.size())
+        {
+          ++CodecStats[Chunk.Header.Compression].SolidPayloadCount;
+        }
+        if (Chunk.SharedOffset)
+        {
+          return *Chunk.SharedOffset;
+        }
+        if (!PadToChunkAlignment(File, CurrentOffset, Alignment) || !WriteChunk(File, Chunk))
+        {
+          return std::unexpected("Failed to write chunk");
+        }
+        const uint64_t Offset = CurrentOffset;
+        CurrentOffset += GetChunkFileSize(Chunk);
+        // The other members of a solid block find it here even without deduplication
+        if (bDeduplicateChunks || Chunk.Header.ChunkKind == static_cast<uint8_t>(Pack::ESnPakChunkKind::SolidBlock))
+        {
+          const ChunkContentKey Key = MakeChunkKey(Chunk.Header);
+          WrittenChunks.try_emplace(Key, WrittenChunk{Offset, Chunk.Header});
+          WrittenChunks.try_emplace(MakeAutoChunkKey(Key), WrittenChunk{Offset, Chunk.Header});
+        }
+
+        if (Chunk.Header.Compression < CodecStats.size())
+        {
+          PackCodecStats& Stats = CodecStats[Chunk.Header.Compression];
+          ++Stats.ChunkCount;
+          Stats.AutoChunkCount += Chunk.bAutoCompressed ? 1 : 0;
+          Stats.DictionaryChunkCount += (Pack::GetChunkFlags(Chunk.Header) & Pack::ChunkFlag_Dictionary) ? 1 : 0;
+          Stats.UncompressedBytes += Chunk.Header.SizeUncompressed;
+          Stats.StoredBytes += Chunk.Header.SizeCompressed;
+        }
+        return Offset;
+      }
+
+      static void SetPayloadLocation(Pack::SnPakIndexEntryV1& Entry, const EncodedChunk& Chunk, const uint64_t Offset)
+      {
+        if (Chunk.SharedOffset && !Chunk.Solid)
+        {
+          Entry.Flags |= Pack::IndexEntryFlag_SharedPayload;
+        }
+        Entry.PayloadChunkOffset = Offset;
+        Entry.PayloadChunkSizeCompressed = GetChunkFileSize(Chunk);
+        Entry.PayloadChunkSizeUncompressed = Chunk.Header.SizeUncompressed;
+        Entry.Compression = Chunk.Header.Compression;
+        Entry.Reserved0 = Chunk.Header.Reserved0;
+        Entry.PayloadHashHi = Chunk.Header.HashHi;
+        Entry.PayloadHashLo = Chunk.Header.HashLo;
+        if (Chunk.Solid)
+        {
+          Pack::SetSolidMember(Entry, Chunk.Solid->Offset, Chunk.Solid->Size);
+          Entry.PayloadHashHi = Chunk.Solid->Hash.high64;
+          Entry.PayloadHashLo = Chunk.Solid->Hash.low64;
+        }
+      }
+
+      static Pack::SnPakBulkEntryV1 MakeBulkEntry(const BulkChunk& Bulk, const EncodedChunk& Chunk, const uint64_t Offset)
+      {
+        Pack::SnPakBulkEntryV1 BulkEntry = {};
+        const auto SemanticVal = static_cast<uint32_t>(Bulk.Semantic);
+        std::memcpy(BulkEntry.Semantic, &SemanticVal, 4);
+        BulkEntry.SubIndex = Bulk.SubIndex;
+        BulkEntry.ChunkOffset = Offset;
+        BulkEntry.SizeCompressed = GetChunkFileSize(Chunk);
+        BulkEntry.SizeUncompressed = Chunk.Header.SizeUncompressed;
+        BulkEntry.Compression = Chunk.Header.Compression;
+        BulkEntry.Reserved0[0] = static_cast<uint8_t>(Chunk.Header.Reserved0);
+        BulkEntry.HashHi = Chunk.Header.HashHi;
+        BulkEntry.HashLo = Chunk.Header.HashLo;
+        uint8_t Flags = Pack::BulkEntryFlag_None;
+        if (Chunk.SharedOffset)
+        {
+          Flags |= Pack::BulkEntryFlag_SharedChunk;
+        }
+        if (Pack::GetChunkFlags(Chunk.Header) & Pack::ChunkFlag_Framed)
+        {
+          Flags |= Pack::BulkEntryFlag_Framed;
+        }
+        Pack::SetBulkEntryFlags(BulkEntry, Flags);
+        return BulkEntry;
+      }
+
+      // Register the chunks referenced by an existing index so appended content can share them.
+      // The headers are reconstructed from the index; only the fields PlaceChunk's callers
+      // consume (sizes, compression, level and hash) matter.
+      static void AddExistingChunks(ChunkDedupTable& WrittenChunks,
+                                    const std::vector<Pack::SnPakIndexEntryV1>& IndexEntries,
+                                    const std::vector<Pack::SnPakBulkEntryV1>& BulkEntries)
+      {
+        auto Add = [&WrittenChunks](Pack::SnPakChunkHeaderV1 Header, const uint64_t Offset, const uint64_t FileSize) {
+          if (FileSize < sizeof(Pack::SnPakChunkHeaderV1))
+          {
+            return;
+          }
+          std::memcpy(Header.Magic, Pack::kChunkMagic, 4);
+          Header.Version = 1;
+          Header.SizeCompressed = FileSize - sizeof(Pack::SnPakChunkHeaderV1);
+          const ChunkContentKey Key = MakeChunkKey(Header);
+          WrittenChunks.try_emplace(Key, WrittenChunk{Offset, Header});
+          WrittenChunks.try_emplace(MakeAutoChunkKey(Key), WrittenChunk{Offset, Header});
+        };
+
+        for (const auto& Entry : IndexEntries)
+        {
+          // Solid members are slices of a block chunk, not chunks of their own
+          if (Entry.Flags & Pack::IndexEntryFlag_SolidBlock)
+          {
+            continue;
+          }
+          Pack::SnPakChunkHeaderV1 Header{};
+          Pack::CopyUuid(Header.AssetId, Entry.AssetId);
+          Pack::CopyUuid(Header.PayloadType, Entry.CookedPayloadType);
+          Header.SchemaVersion = Entry.CookedSchemaVersion;
+          Header.Compression = Entry.Compression;
+          Header.ChunkKind = static_cast<uint8_t>(Pack::ESnPakChunkKind::MainPayload);
+          Header.Reserved0 = Entry.Reserved0;
+          Header.SizeUncompressed = Entry.PayloadChunkSizeUncompressed;
+          Header.HashHi = Entry.PayloadHashHi;
+          Header.HashLo = Entry.PayloadHashLo;
+          Add(Header, Entry.PayloadChunkOffset, Entry.PayloadChunkSizeCompressed);
+        }
+
+        for (const auto& BulkEntry : BulkEntries)
+        {
+          Pack::SnPakChunkHeaderV1 Header{};
+          Header.Compression = BulkEntry.Compression;
+          Header.ChunkKind = static_cast<uint8_t>(Pack::ESnPakChunkKind::Bulk);
+          Header.Reserved0 = BulkEntry.Reserved0[0];
+          if (Pack::GetBulkEntryFlags(BulkEntry) & Pack::BulkEntryFlag_Framed)
+          {
+            Pack::SetChunkFlags(Header, Pack::ChunkFlag_Framed);
+          }
+          Header.SizeUncompressed = BulkEntry.SizeUncompressed;
+          Header.HashHi = BulkEntry.HashHi;
+          Header.HashLo = BulkEntry.HashLo;
+          Add(Header, BulkEntry.ChunkOffset, BulkEntry.SizeCompressed);
+        }
+      }
+
+      // Fill the identity/name fields of an index entry; chunk location is set separately
+      static Pack::SnPakIndexEntryV1 MakeIndexEntry(const AssetPackEntry& Asset, const uint32_t NameStringId, const uint32_t VariantStringId)
+      {
+        Pack::SnPakIndexEntryV1 Entry = {};
+
+        Pack::CopyUuid(Entry.AssetId, Asset.Id.Bytes);
+        Pack::CopyUuid(Entry.AssetKind, Asset.AssetKind.Bytes);
+        Pack::CopyUuid(Entry.CookedPayloadType, Asset.Cooked.PayloadType.Bytes);
+        Entry.CookedSchemaVersion = Asset.Cooked.SchemaVersion;
+
+        Entry.NameStringId = NameStringId;
+        Entry.NameHash64 = XXH3_64bits(Asset.Name.data(), Asset.Name.size());
+
+        if (!Asset.VariantKey.empty())
+        {
+          Entry.VariantStringId = VariantStringId;
+          Entry.VariantHash64 = XXH3_64bits(Asset.VariantKey.data(), Asset.VariantKey.size());
+        }
+        else
+        {
+          Entry.VariantStringId = 0xFFFFFFFF;
+          Entry.VariantHash64 = 0;
+        }
+        return Entry;
+      }
+
+      // Chunk placement order of the assets Ids (with their dependencies) under
+      // AccessOrderProfile, as positions into Ids: profiled assets in load order, each followed
+      // depth first by the unprofiled assets it depends on, then the rest in their given order,
+      // likewise followed by their dependencies. Without a profile the order is unchanged.
+      std::vector<size_t> ComputeLayoutOrder(const std::vector<AssetId>& Ids, const std::vector<std::vector<AssetId>>& Dependencies) const
+      {
+        std::vector<size_t> Order;
+        Order.reserve(Ids.size());
+        if (AccessOrderProfile.empty())
+        {
+          Order.resize(Ids.size());
+          std::iota(Order.begin(), Order.end(), size_t{0});
+          return Order;
+        }
+
+        std::unordered_map<AssetId, size_t, UuidHash> IndexById;
+        for (size_t Index = 0; Index < Ids.size(); ++Index)
+        {
+          IndexById.try_emplace(Ids[Index], Index);
+        }
+
+        std::vector<bool> bProfiled(Ids.size(), false);
+        std::vector<size_t> Profiled;
+        for (const AssetId& Id : AccessOrderProfile)
+        {
+          if (const auto It = IndexById.find(Id); It != IndexById.end() && !bProfiled[It->second])
+          {
+            bProfiled[It->second] = true;
+            Profiled.push_back(It->second);
+          }
+        }
+
+        std::vector<bool> bPlaced(Ids.size(), false);
+        std::vector<size_t> Stack;
+        auto Place = [&](const size_t Root) {
+          Stack.push_back(Root);
+          while (!Stack.empty())
+          {
+            const size_t Index = Stack.back();
+            Stack.pop_back();
+            if (bPlaced[Index])
+            {
+              continue;
+            }
+            bPlaced[Index] = true;
+            Order.push_back(Index);
+            for (auto It = Dependencies[Index].rbegin(); It != Dependencies[Index].rend(); ++It)
+            {
+              if (const auto Dependency = IndexById.find(*It);
+                  Dependency != IndexById.end() && !bPlaced[Dependency->second] && !bProfiled[Dependency->second])
+              {
+                Stack.push_back(Dependency->second);
+              }
+            }
+          }
+        };
+
+        for (const size_t Index : Profiled)
+        {
+          Place(Index);
+        }
+        for (size_t Index = 0; Index < Ids.size(); ++Index)
+        {
+          Place(Index);
+        }
+        return Order;
+      }
+
+      std::vector<size_t> ComputeLayoutOrder(const std::vector<const AssetPackEntry*>& Assets) const
+      {
+        std::vector<AssetId> Ids;
+        std::vector<std::vector<AssetId>> Dependencies(Assets.size());
+        Ids.reserve(Assets.size());
+        for (size_t Index = 0; Index < Assets.size(); ++Index)
+        {
+          Ids.push_back(Assets[Index]->Id);
+          if (!AccessOrderProfile.empty())
+          {
+            for (const AssetDependencyRef& Dependency : Assets[Index]->AssetDependencies)
+            {
+              Dependencies[Index].push_back(Dependency.Id);
+            }
+          }
+        }
+        return ComputeLayoutOrder(Ids, Dependencies);
+      }
+
+      uint32_t ResolveCompressionThreads(const size_t JobCount) const
+      {
+        uint32_t Threads = CompressionThreads;
+        if (Threads == 0)
+        {
+          Threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        return static_cast<uint32_t>(std::min<size_t>(Threads, std::max<size_t>(JobCount, 1)));
+      }
+
+      // Compress every chunk of Assets (main payload, then bulk chunks, asset by asset) and hand
+      // each encoded chunk to Consume in exactly that order.
+      //
+      // With deduplication enabled every chunk is hashed first; chunks whose content matches one
+      // in WrittenChunks or an earlier job are not compressed and reach Consume with SharedOffset
+      // set. Consume must record the chunks it writes in WrittenChunks (see PlaceChunk).
+      //
+      // Compression runs on up to CompressionThreads workers, each using its own thread-local
+      // codec context; Consume always runs on the calling thread, so file offsets and index
+      // entries are assigned in the same deterministic order as a serial write. Workers stay
+      // within a bounded window of the consumer so only a few encoded chunks are buffered.
+      // Exceptions thrown by the codecs are rethrown on the calling thread.
+      template <typename ConsumeFn>
+      std::expected<void, std::string> EncodeChunksInOrder(const std::vector<const AssetPackEntry*>& Assets,
+                                                           const ChunkDedupTable& WrittenChunks,
+                                                           ConsumeFn&& Consume) const
+      {
+        std::deque<SolidBlock> Blocks;
+        std::vector<std::optional<SolidMember>> Members;
+        BuildSolidBlocks(Assets, WrittenChunks, Blocks, Members);
+
+        std::vector<ChunkJob> Jobs;
+        std::unordered_set<ChunkContentKey, ChunkContentKeyHasher> BatchKeys;
+        for (size_t AssetIndex = 0; AssetIndex < Assets.size(); ++AssetIndex)
+        {
+          for (size_t ChunkIndex = 0; ChunkIndex <= Assets[AssetIndex]->Bulk.size(); ++ChunkIndex)
+          {
+            ChunkJob Job{AssetIndex, ChunkIndex};
+            if (ChunkIndex == 0 && Members[AssetIndex])
+            {
+              // Only the leader encodes the block; it may still match an identical written block
+              const SolidBlock& Block = *Members[AssetIndex]->Block;
+              Job.Solid = &*Members[AssetIndex];
+              Job.Hash = Block.Hash;
+              Job.Key = Block.Key;
+              Job.bShared = Block.LeaderIndex != AssetIndex ||
+                            (bDeduplicateChunks && (WrittenChunks.contains(Job.Key) || !BatchKeys.insert(Job.Key).second));
+            }
+            else if (bDeduplicateChunks)
+            {
+              const ChunkSource Source = DescribeJob(Assets, Job);
+              Job.Hash = HashChunk(Source);
+              Job.Key = MakeSourceKey(Source, *Job.Hash);
+              Job.bShared = WrittenChunks.contains(Job.Key) || !BatchKeys.insert(Job.Key).second;
+            }
+            Jobs.push_back(Job);
+          }
+        }
+
+        // Point a skipped duplicate at the copy written by an earlier job (or an earlier write)
+        auto ResolveShared = [&](const ChunkJob& Job, EncodedChunk& Chunk) {
+          if (!Job.bShared)
+          {
+            return;
+          }
+          const WrittenChunk& Written = WrittenChunks.at(Job.Key);
+          Chunk.Header = Written.Header;
+          Chunk.SharedOffset = Written.Offset;
+        };
+
+        const uint32_t Threads = ResolveCompressionThreads(Jobs.size());
+        if (Threads <= 1)
+        {
+          for (const ChunkJob& Job : Jobs)
+          {
+            EncodedChunk Chunk = EncodeJob(Assets, Job);
+            ResolveShared(Job, Chunk);
+            auto ConsumeResult = Consume(Job, std::move(Chunk));
+            if (!ConsumeResult)
+            {
+              return ConsumeResult;
+            }
+          }
+          return {};
+        }
+
+        struct Slot
+        {
+            std::optional<EncodedChunk> Chunk;
+            std::exception_ptr Error;
+        };
+
+        const size_t Window = static_cast<size_t>(Threads) * 4;
+        std::vector<Slot> Slots(Jobs.size());
+        std::mutex SlotMutex;
+        std::condition_variable SlotReady;
+        std::condition_variable WindowOpen;
+        size_t NextJob = 0;
+        size_t ConsumeCursor = 0;
+        bool bAbort = false;
+
+        auto Worker = [&]() {
+          while (true)
+          {
+            size_t JobIndex = 0;
+            {
+              std::unique_lock Lock(SlotMutex);
+              WindowOpen.wait(Lock, [&] { return bAbort || NextJob >= Jobs.size() || NextJob < ConsumeCursor + Window; });
+              if (bAbort || NextJob >= Jobs.size())
+              {
+                return;
+              }
+              JobIndex = NextJob++;
+            }
+
+            Slot Result;
+            try
+            {
+              Result.Chunk = EncodeJob(Assets, Jobs[JobIndex]);
+            }
+            catch (...)
+            {
+              Result.Error = std::current_exception();
+            }
+
+            {
+              std::lock_guard Lock(SlotMutex);
+              Slots[JobIndex] = std::move(Result);
+            }
+            SlotReady.notify_all();
+          }
+        };
+
+        struct WorkerGroup
+        {
+            std::vector<std::thread> Threads;
+            std::mutex& Mutex;
+            std::condition_variable& WindowOpen;
+            bool& bAbort;
+
+            ~WorkerGroup()
+            {
+              {
+                std::lock_guard Lock(Mutex);
+                bAbort = true;
+              }
+              WindowOpen.notify_all();
+              for (auto& Thread : Threads)
+              {
+                Thread.join();
+              }
+            }
+        } Group{{}, SlotMutex, WindowOpen, bAbort};
+
+        Group.Threads.reserve(Threads);
+        for (uint32_t ThreadIndex = 0; ThreadIndex < Threads; ++ThreadIndex)
+        {
+          Group.Threads.emplace_back(Worker);
+        }
+
+        for (size_t JobIndex = 0; JobIndex < Jobs.size(); ++JobIndex)
+        {
+          Slot Ready;
+          {
+            std::unique_lock Lock(SlotMutex);
+            SlotReady.wait(Lock, [&] { return Slots[JobIndex].Chunk.has_value() || Slots[JobIndex].Error; });
+            Ready = std::move(Slots[JobIndex]);
+            Slots[JobIndex] = {};
+            ConsumeCursor = JobIndex + 1;
+          }
+          WindowOpen.notify_all();
+
+          if (Ready.Error)
+          {
+            std::rethrow_exception(Ready.Error);
+          }
+          ResolveShared(Jobs[JobIndex], *Ready.Chunk);
+
+          auto ConsumeResult = Consume(Jobs[JobIndex], std::move(*Ready.Chunk));
+          if (!ConsumeResult)
+          {
+            return ConsumeResult;
+          }
+        }
+
+        return {};
+      }
+
+      // Load the dictionary block of an existing pack so an update can keep compressing against
+      // (and appending to) the same dictionaries
+      static std::expected<std::vector<KindDictionary>, std::string> ReadDictionaryBlock(std::fstream& File,
+                                                                                         const Pack::SnPakHeaderV1& Header,
+                                                                                         const uint64_t FileSize)
+      {
+        std::vector<KindDictionary> Result;
+        if (!(Header.Flags & Pack::SnPakFlag_HasDictionaries))
+        {
+          return Result;
+        }
+
+        const uint64_t Offset = Pack::GetDictionaryBlockOffset(Header);
+        const uint64_t Size = Pack::GetDictionaryBlockSize(Header);
+        if (Size < sizeof(Pack::SnPakDictionaryHeaderV1) || Size > FileSize || Offset > FileSize - Size)
+        {
+          return std::unexpected("Dictionary block offset/size exceeds file bounds");
+        }
+
+        std::vector<uint8_t> Data(static_cast<size_t>(Size));
+        File.seekg(static_cast<std::streamoff>(Offset), std::ios::beg);
+        File.read(reinterpret_cast<char*>(Data.data()), static_cast<std::streamsize>(Data.size()));
+        if (!File.good())
+        {
+          return std::unexpected("Failed to read dictionary block");
+        }
+
+        std::vector<Pack::DictionaryBlockEntry> Entries;
+        try
+        {
+          Entries = Pack::ParseDictionaryBlock(Data);
+        }
+        catch (const std::exception& Ex)
+        {
+          return std::unexpected(Ex.what());
+        }
+        for (const auto& [Entry, Bytes] : Entries)
+        {
+          auto Dictionary = std::make_shared<const Pack::ZstdEncoderDictionary>(std::vector<uint8_t>(Bytes.begin(), Bytes.end()));
+          TypeId AssetKind{};
+          std::memcpy(AssetKind.Bytes, Entry.AssetKind, sizeof(AssetKind.Bytes));
+          Result.push_back({AssetKind, std::move(Dictionary)});
+        }
+        return Result;
+      }
+
+      // Active metadata of a pack on disk: header, current string table and current index
+      struct ExistingPack
+      {
+          Pack::SnPakHeaderV1 Header{};
+          uint64_t FileSize = 0;
+          std::vector<std::string> Strings;
+          std::vector<Pack::SnPakIndexEntryV1> IndexEntries;
+          std::vector<Pack::SnPakBulkEntryV1> BulkEntries;
+          std::vector<Pack::SnPakDependencyOwnerV1> DependencyOwners;
+          std::vector<Pack::SnPakDependencyEntryV1> DependencyEntries;
+          bool bCompressedIndex = false;
+      };
+
+      static std::expected<ExistingPack, std::string> ReadExistingPack(std::fstream& File)
+      {
+        ExistingPack Existing;
+        Pack::SnPakHeaderV1& Header = Existing.Header;
+        File.read(reinterpret_cast<char*>(&Header), sizeof(Header));
+        if (!File.good())
+        {
+          return std::unexpected("Failed to read existing pack header");
+        }
+        if (std::memcmp(Header.Magic, Pack::kSnPakMagic, 8) != 0)
+        {
+          return std::unexpected("Invalid pack file magic");
+        }
+        if (Header.Version != Pack::kSnPakVersion)
+        {
+          return std::unexpected("Pack version mismatch - expected " + std::to_string(Pack::kSnPakVersion) +
+                                 ", got " + std::to_string(Header.Version));
+        }
+        if (Header.HeaderSize != sizeof(Pack::SnPakHeaderV1))
+        {
+          return std::unexpected("Header size mismatch - pack may be from incompatible version");
+        }
+        if (Header.EndianMarker != Pack::kEndianMarker)
+        {
+          return std::unexpected("Endian mismatch - pack was created on different architecture");
+        }
+
+        File.seekg(0, std::ios::end);
+        const uint64_t ActualFileSize = static_cast<uint64_t>(File.tellg());
+        Existing.FileSize = ActualFileSize;
+        if (Header.FileSize > ActualFileSize)
+        {
+          return std::unexpected("Header FileSize (" + std::to_string(Header.FileSize) +
+                                 ") exceeds actual file size (" + std::to_string(ActualFileSize) +
+                                 ") - pack may be truncated");
+        }
+
+        const auto CheckRange = [ActualFileSize](const uint64_t Offset, const uint64_t Size) {
+          if (Size > ActualFileSize)
+          {
+            return false;
+          }
+          if (Offset > ActualFileSize - Size)
+          {
+            return false;
+          }
+          return true;
+        };
+
+        if (!CheckRange(Header.StringTableOffset, Header.StringTableSize))
+        {
+          return std::unexpected("String table offset/size exceeds file bounds");
+        }
+
+        File.seekg(static_cast<std::streamoff>(Header.StringTableOffset), std::ios::beg);
+        if (!File.good())
+        {
+          return std::unexpected("Failed to seek to string table");
+        }
+
+        Pack::SnPakStrBlockHeaderV1 StringHeader{};
+        File.read(reinterpret_cast<char*>(&StringHeader), sizeof(StringHeader));
+        if (!File.good())
+        {
+          return std::unexpected("Failed to read string table header");
+        }
+        if (std::memcmp(StringHeader.Magic, Pack::kStringMagic, 4) != 0)
+        {
+          return std::unexpected("Invalid string table magic");
+        }
+        if (StringHeader.Version != 1)
+        {
+          return std::unexpected("Unsupported string table version: " + std::to_string(StringHeader.Version));
+        }
+        if (StringHeader.BlockSize != Header.StringTableSize)
+        {
+          return std::unexpected("String table BlockSize mismatch with header");
+        }
+        if (StringHeader.StringCount > (std::numeric_limits<size_t>::max() / sizeof(uint32_t)))
+        {
+          return std::unexpected("String table count exceeds host addressable range");
+        }
+
+        const size_t ExistingOffsetsSize = static_cast<size_t>(StringHeader.StringCount) * sizeof(uint32_t);
+        if (StringHeader.BlockSize < sizeof(Pack::SnPakStrBlockHeaderV1) + ExistingOffsetsSize)
+        {
+          return std::unexpected("String table block size too small for offsets");
+        }
+
+        std::vector<uint32_t> ExistingStringOffsets(StringHeader.StringCount);
+        if (!ExistingStringOffsets.empty())
+        {
+          File.read(reinterpret_cast<char*>(ExistingStringOffsets.data()), static_cast<std::streamsize>(ExistingOffsetsSize));
+          if (!File.good())
+          {
+            return std::unexpected("Failed to read string table offsets");
+          }
+        }
+
+        const size_t ExistingStringDataSize =
+            static_cast<size_t>(StringHeader.BlockSize - sizeof(Pack::SnPakStrBlockHeaderV1) - ExistingOffsetsSize);
+        std::vector<uint8_t> ExistingStringData(ExistingStringDataSize);
+        if (!ExistingStringData.empty())
+        {
+          File.read(reinterpret_cast<char*>(ExistingStringData.data()), static_cast<std::streamsize>(ExistingStringDataSize));
+          if (!File.good())
+          {
+            return std::unexpected("Failed to read string table data");
+          }
+        }
+
+        std::vector<std::string>& StringTable = Existing.Strings;
+        StringTable.reserve(StringHeader.StringCount);
+
+        for (uint32_t StringIndex = 0; StringIndex < StringHeader.StringCount; ++StringIndex)
+        {
+          const uint32_t Offset = ExistingStringOffsets[StringIndex];
+          if (Offset >= ExistingStringDataSize)
+          {
+            return std::unexpected("String table offset " + std::to_string(StringIndex) + " out of range");
+          }
+
+          const uint8_t* const Start = ExistingStringData.data() + Offset;
+          const size_t MaxLen = ExistingStringDataSize - Offset;
+          const void* const NullPos = std::memchr(Start, 0, MaxLen);
+          if (NullPos == nullptr)
+          {
+            return std::unexpected("String table entry " + std::to_string(StringIndex) + " missing null terminator");
+          }
+
+          const size_t Length = static_cast<const uint8_t*>(NullPos) - Start;
+          std::string StringValue(reinterpret_cast<const char*>(Start), Length);
+          StringTable.push_back(std::move(StringValue));
+        }
+
+        if (!CheckRange(Header.IndexOffset, Header.IndexSize))
+        {
+          return std::unexpected("Index offset/size exceeds file bounds");
+        }
+
+        File.seekg(static_cast<std::streamoff>(Header.IndexOffset), std::ios::beg);
+        if (!File.good())
+        {
+          return std::unexpected("Failed to seek to index block");
+        }
+
+        Pack::SnPakIndexHeaderV1 IndexHeader{};
+        File.read(reinterpret_cast<char*>(&IndexHeader), sizeof(IndexHeader));
+        if (!File.good())
+        {
+          return std::unexpected("Failed to read index header");
+        }
+        if (std::memcmp(IndexHeader.Magic, Pack::kIndexMagic, 4) != 0)
+        {
+          return std::unexpected("Invalid index magic");
+        }
+        if (IndexHeader.Version != 1)
+        {
+          return std::unexpected("Unsupported index version: " + std::to_string(IndexHeader.Version));
+        }
+        if (IndexHeader.BlockSize != Header.IndexSize)
+        {
+          return std::unexpected("Index BlockSize mismatch with header");
+        }
+
+        const uint64_t ExistingIndexEntriesSize = static_cast<uint64_t>(IndexHeader.EntryCount) * sizeof(Pack::SnPakIndexEntryV1);
+        const uint64_t ExistingBulkEntriesSize = static_cast<uint64_t>(IndexHeader.BulkEntryCount) * sizeof(Pack::SnPakBulkEntryV1);
+        const uint64_t ExistingDependencyOwnerCount = Pack::GetDependencyOwnerCount(IndexHeader);
+        const uint64_t ExistingDependencyEntryCount = Pack::GetDependencyEntryCount(IndexHeader);
+        const uint64_t ExistingDependencyOwnersSize =
+            ExistingDependencyOwnerCount * sizeof(Pack::SnPakDependencyOwnerV1);
+        const uint64_t ExistingDependencyEntriesSize =
+            ExistingDependencyEntryCount * sizeof(Pack::SnPakDependencyEntryV1);
+        const uint64_t ArraysSize = ExistingIndexEntriesSize + ExistingBulkEntriesSize + ExistingDependencyOwnersSize + ExistingDependencyEntriesSize;
+        Existing.bCompressedIndex = (Pack::GetIndexFlags(IndexHeader) & Pack::IndexFlag_CompressedArrays) != 0;
+        if (!Existing.bCompressedIndex && static_cast<uint64_t>(sizeof(Pack::SnPakIndexHeaderV1)) + ArraysSize != IndexHeader.BlockSize)
+        {
+          return std::unexpected("Index block size does not match entry counts");
+        }
+
+        std::vector<uint8_t> Arrays(static_cast<size_t>(IndexHeader.BlockSize - sizeof(Pack::SnPakIndexHeaderV1)));
+        if (!Arrays.empty())
+        {
+          File.read(reinterpret_cast<char*>(Arrays.data()), static_cast<std::streamsize>(Arrays.size()));
+          if (!File.good())
+          {
+            return std::unexpected("Failed to read existing index entries");
+          }
+        }
+        if (Existing.bCompressedIndex)
+        {
+          try
+          {
+            Arrays = Pack::DecodeIndexArrays(Arrays, Pack::GetIndexArrayLayout(IndexHeader));
+          }
+          catch (const std::exception& Ex)
+          {
+            return std::unexpected(std::string("Failed to decode compressed index: ") + Ex.what());
+          }
+        }
+
+        size_t Offset = 0;
+        auto CopyArray = [&](auto& Out, const size_t Count) {
+          Out.resize(Count);
+          if (Count > 0)
+          {
+            std::memcpy(Out.data(), Arrays.data() + Offset, Count * sizeof(Out[0]));
+            Offset += Count * sizeof(Out[0]);
+          }
+        };
+        CopyArray(Existing.IndexEntries, IndexHeader.EntryCount);
+        CopyArray(Existing.BulkEntries, IndexHeader.BulkEntryCount);
+        CopyArray(Existing.DependencyOwners, static_cast<size_t>(ExistingDependencyOwnerCount));
+        CopyArray(Existing.DependencyEntries, static_cast<size_t>(ExistingDependencyEntryCount));
+
+        return Existing;
+      }
+
+      // A pack read by Compact or Merge; its live chunks are copied into the new pack as stored
+      struct CopySource
+      {
+          std::string Path;
+          std::fstream File;
+          ExistingPack Pack;
+          std::vector<KindDictionary> Dictionaries;
+      };
+
+      // A chunk of a CopySource referenced by the new pack's index
+      struct CopiedChunk
+      {
+          uint32_t Source = 0;
+          uint64_t Offset = 0; // in the source
+          uint64_t Size = 0;   // header included
+          Pack::SnPakChunkHeaderV1 Header{};
+          size_t Canonical = 0; // chunk whose copy is written (itself unless deduplicated)
+          uint64_t NewOffset = 0;
+      };
+
+      // Everything Compact or Merge writes except the chunk bytes, which are still in the sources
+      struct CopyPlan
+      {
+          Pack::SnPakHeaderV1 Header{};
+          std::vector<uint8_t> StringTableData;
+          std::vector<uint8_t> DictionaryData;
+          std::vector<CopiedChunk> Chunks; // chunks to write, in output order
+          std::vector<uint8_t> LookupData;
+          std::vector<uint8_t> IndexData;
+          uint32_t Alignment = 1;
+          bool bCompressIndex = false;
+      };
+
+      static std::expected<CopySource, std::string> OpenCopySource(const std::string& Path)
+      {
+        CopySource Source;
+        Source.Path = Path;
+        Source.File.open(Path, std::ios::binary | std::ios::in);
+        if (!Source.File.is_open())
+        {
+          return std::unexpected("Failed to open pack: " + Path);
+        }
+
+        auto Existing = ReadExistingPack(Source.File);
+        if (!Existing)
+        {
+          return std::unexpected(Path + ": " + Existing.error());
+        }
+        Source.Pack = std::move(*Existing);
+
+        auto Dictionaries = ReadDictionaryBlock(Source.File, Source.Pack.Header, Source.Pack.FileSize);
+        if (!Dictionaries)
+        {
+          return std::unexpected(Path + ": " + Dictionaries.error());
+        }
+        Source.Dictionaries = std::move(*Dictionaries);
+        return Source;
+      }
+
+      // Lay out a pack holding the Selected index entries ({source, entry index}, in output
+      // order) of Sources. Chunks keep their source order, identical chunks are stored once when
+      // deduplication is on, and the string table only holds strings the new index uses.
+      std::expected<CopyPlan, std::string> PlanCopy(std::vector<CopySource>& Sources,
+                                                    const std::vector<std::pair<uint32_t, uint32_t>>& Selected) const
+      {
+        CopyPlan Plan;
+        Plan.Alignment = ChunkAlignment;
+        for (const CopySource& Source : Sources)
+        {
+          Plan.Alignment = std::max(Plan.Alignment, Pack::GetChunkAlignment(Source.Pack.Header));
+        }
+        Plan.bCompressIndex = bCompressIndex || std::ranges::any_of(Sources, [](const CopySource& Source) {
+          return Source.Pack.bCompressedIndex;
+        });
+
+        // Trained dictionary IDs are derived from their content, so equal IDs are the same dictionary
+        std::vector<KindDictionary> Dictionaries;
+        for (const CopySource& Source : Sources)
+        {
+          for (const KindDictionary& Dictionary : Source.Dictionaries)
+          {
+            const auto Same = std::ranges::find_if(Dictionaries, [&](const KindDictionary& Kept) {
+              return Kept.Dictionary->GetId() == Dictionary.Dictionary->GetId();
+            });
+            if (Same == Dictionaries.end())
+            {
+              Dictionaries.push_back(Dictionary);
+            }
+            else if (!std::ranges::equal(Same->Dictionary->GetBytes(), Dictionary.Dictionary->GetBytes()))
+            {
+              return std::unexpected("Dictionary id " + std::to_string(Dictionary.Dictionary->GetId()) + " of " + Source.Path +
+                                     " conflicts with a different dictionary of another input");
+            }
+          }
+        }
+
+        std::vector<std::string> Strings;
+        std::unordered_map<std::string, uint32_t> StringIds;
+        auto RemapString = [&](const CopySource& Source, uint32_t& StringId) -> std::expected<void, std::string> {
+          if (StringId == Pack::kInvalidStringId)
+          {
+            return {};
+          }
+          if (StringId >= Source.Pack.Strings.size())
+          {
+            return std::unexpected(Source.Path + ": string id " + std::to_string(StringId) + " out of range");
+          }
+          const auto [It, bAdded] = StringIds.try_emplace(Source.Pack.Strings[StringId], static_cast<uint32_t>(Strings.size()));
+          if (bAdded)
+          {
+            Strings.push_back(Source.Pack.Strings[StringId]);
+          }
+          StringId = It->second;
+          return {};
+        };
+
+        std::vector<CopiedChunk> Chunks;
+        std::vector<std::unordered_map<uint64_t, size_t>> ChunksByOffset(Sources.size());
+        auto UseChunk = [&](const uint32_t SourceIndex, const uint64_t Offset, const uint64_t Size) -> std::expected<size_t, std::string> {
+          const CopySource& Source = Sources[SourceIndex];
+          if (Size < sizeof(Pack::SnPakChunkHeaderV1) || Size > Source.Pack.FileSize || Offset > Source.Pack.FileSize - Size)
+          {
+            return std::unexpected(Source.Path + ": chunk at offset " + std::to_string(Offset) + " exceeds file bounds");
+          }
+          const auto [It, bAdded] = ChunksByOffset[SourceIndex].try_emplace(Offset, Chunks.size());
+          if (!bAdded)
+          {
+            if (Chunks[It->second].Size != Size)
+            {
+              return std::unexpected(Source.Path + ": index entries disagree on the size of the chunk at offset " + std::to_string(Offset));
+            }
+            return It->second;
+          }
+          CopiedChunk& Chunk = Chunks.emplace_back();
+          Chunk.Source = SourceIndex;
+          Chunk.Offset = Offset;
+          Chunk.Size = Size;
+          return It->second;
+        };
+
+        // Source dependency owners by source asset index
+        std::vector<std::unordered_map<uint32_t, size_t>> OwnersBySource(Sources.size());
+        for (size_t SourceIndex = 0; SourceIndex < Sources.size(); ++SourceIndex)
+        {
+          const ExistingPack& Existing = Sources[SourceIndex].Pack;
+          for (size_t OwnerIndex = 0; OwnerIndex < Existing.DependencyOwners.size(); ++OwnerIndex)
+          {
+            const auto& Owner = Existing.DependencyOwners[OwnerIndex];
+            if (Owner.FirstDependencyIndex > Existing.DependencyEntries.size() ||
+                Owner.DependencyCount > Existing.DependencyEntries.size() - Owner.FirstDependencyIndex)
+            {
+              return std::unexpected(Sources[SourceIndex].Path + ": dependency owner references invalid dependency range");
+            }
+            OwnersBySource[SourceIndex].try_emplace(Owner.AssetIndex, OwnerIndex);
+          }
+        }
+
+        std::vector<Pack::SnPakIndexEntryV1> IndexEntries;
+        std::vector<Pack::SnPakBulkEntryV1> BulkEntries;
+        std::vector<Pack::SnPakDependencyOwnerV1> DependencyOwners;
+        std::vector<Pack::SnPakDependencyEntryV1> DependencyEntries;
+        std::vector<size_t> PayloadChunks;
+        std::vector<size_t> BulkChunks;
+        IndexEntries.reserve(Selected.size());
+        PayloadChunks.reserve(Selected.size());
+
+        for (const auto& [SourceIndex, EntryIndex] : Selected)
+        {
+          const CopySource& Source = Sources[SourceIndex];
+          const Pack::SnPakIndexEntryV1& SourceEntry = Source.Pack.IndexEntries[EntryIndex];
+          Pack::SnPakIndexEntryV1 Entry = SourceEntry;
+          if (auto NameResult = RemapString(Source, Entry.NameStringId); !NameResult)
+          {
+            return std::unexpected(NameResult.error());
+          }
+          if (auto VariantResult = RemapString(Source, Entry.VariantStringId); !VariantResult)
+          {
+            return std::unexpected(VariantResult.error());
+          }
+
+          auto PayloadChunk = UseChunk(SourceIndex, SourceEntry.PayloadChunkOffset, SourceEntry.PayloadChunkSizeCompressed);
+          if (!PayloadChunk)
+          {
+            return std::unexpected(PayloadChunk.error());
+          }
+          PayloadChunks.push_back(*PayloadChunk);
+
+          Entry.Flags = static_cast<uint8_t>(Entry.Flags & ~Pack::IndexEntryFlag_HasBulk);
+          Entry.BulkFirstIndex = 0;
+          Entry.BulkCount = 0;
+          if ((SourceEntry.Flags & Pack::IndexEntryFlag_HasBulk) && SourceEntry.BulkCount > 0)
+          {
+            const auto& SourceBulk = Source.Pack.BulkEntries;
+            if (SourceEntry.BulkFirstIndex > SourceBulk.size() || SourceEntry.BulkCount > SourceBulk.size() - SourceEntry.BulkFirstIndex)
+            {
+              return std::unexpected(Source.Path + ": asset has invalid bulk entry range");
+            }
+            Entry.Flags = static_cast<uint8_t>(Entry.Flags | Pack::IndexEntryFlag_HasBulk);
+            Entry.BulkFirstIndex = static_cast<uint32_t>(BulkEntries.size());
+            Entry.BulkCount = SourceEntry.BulkCount;
+            for (uint32_t BulkIndex = 0; BulkIndex < SourceEntry.BulkCount; ++BulkIndex)
+            {
+              const Pack::SnPakBulkEntryV1& BulkEntry = SourceBulk[SourceEntry.BulkFirstIndex + BulkIndex];
+              auto BulkChunk = UseChunk(SourceIndex, BulkEntry.ChunkOffset, BulkEntry.SizeCompressed);
+              if (!BulkChunk)
+              {
+                return std::unexpected(BulkChunk.error());
+              }
+              BulkEntries.push_back(BulkEntry);
+              BulkChunks.push_back(*BulkChunk);
+            }
+          }
+
+          if (const auto OwnerIt = OwnersBySource[SourceIndex].find(EntryIndex); OwnerIt != OwnersBySource[SourceIndex].end())
+          {
+            const auto& SourceOwner = Source.Pack.DependencyOwners[OwnerIt->second];
+            Pack::SnPakDependencyOwnerV1 Owner{};
+            Owner.AssetIndex = static_cast<uint32_t>(IndexEntries.size());
+            Owner.FirstDependencyIndex = static_cast<uint32_t>(DependencyEntries.size());
+            Owner.DependencyCount = SourceOwner.DependencyCount;
+            DependencyOwners.push_back(Owner);
+            for (uint32_t DependencyIndex = 0; DependencyIndex < SourceOwner.DependencyCount; ++DependencyIndex)
+            {
+              Pack::SnPakDependencyEntryV1 Dependency = Source.Pack.DependencyEntries[SourceOwner.FirstDependencyIndex + DependencyIndex];
+              if (auto DependencyResult = RemapString(Source, Dependency.LogicalNameStringId); !DependencyResult)
+              {
+                return std::unexpected(DependencyResult.error());
+              }
+              DependencyEntries.push_back(Dependency);
+            }
+          }
+
+          IndexEntries.push_back(Entry);
+        }
+
+        if (IndexEntries.size() > std::numeric_limits<uint32_t>::max() || BulkEntries.size() > std::numeric_limits<uint32_t>::max() ||
+            DependencyEntries.size() > std::numeric_limits<uint32_t>::max())
+        {
+          return std::unexpected("Index exceeds 32-bit range");
+        }
+
+        // Read every chunk header, both to check it against the index and to find duplicates
+        std::unordered_map<ChunkContentKey, size_t, ChunkContentKeyHasher> ChunksByContent;
+        for (size_t ChunkIndex = 0; ChunkIndex < Chunks.size(); ++ChunkIndex)
+        {
+          CopiedChunk& Chunk = Chunks[ChunkIndex];
+          CopySource& Source = Sources[Chunk.Source];
+          Source.File.clear();
+          Source.File.seekg(static_cast<std::streamoff>(Chunk.Offset), std::ios::beg);
+          Source.File.read(reinterpret_cast<char*>(&Chunk.Header), sizeof(Chunk.Header));
+          if (!Source.File.good() || std::memcmp(Chunk.Header.Magic, Pack::kChunkMagic, 4) != 0 ||
+              sizeof(Chunk.Header) + Chunk.Header.SizeCompressed != Chunk.Size)
+          {
+            return std::unexpected(Source.Path + ": invalid chunk at offset " + std::to_string(Chunk.Offset));
+          }
+          Chunk.Canonical = ChunkIndex;
+          if (bDeduplicateChunks)
+          {
+            Chunk.Canonical = ChunksByContent.try_emplace(MakeChunkKey(Chunk.Header), ChunkIndex).first->second;
+          }
+        }
+
+        // Entries whose chunk turned out to be a copy of another now share that one
+        for (size_t EntryIndex = 0; EntryIndex < IndexEntries.size(); ++EntryIndex)
+        {
+          const size_t ChunkIndex = PayloadChunks[EntryIndex];
+          if (Chunks[ChunkIndex].Canonical != ChunkIndex && !(IndexEntries[EntryIndex].Flags & Pack::IndexEntryFlag_SolidBlock))
+          {
+            IndexEntries[EntryIndex].Flags |= Pack::IndexEntryFlag_SharedPayload;
+          }
+        }
+        for (size_t BulkIndex = 0; BulkIndex < BulkEntries.size(); ++BulkIndex)
+        {
+          const size_t ChunkIndex = BulkChunks[BulkIndex];
+          if (Chunks[ChunkIndex].Canonical != ChunkIndex)
+          {
+            Pack::SetBulkEntryFlags(BulkEntries[BulkIndex], Pack::GetBulkEntryFlags(BulkEntries[BulkIndex]) | Pack::BulkEntryFlag_SharedChunk);
+          }
+        }
+
+        // Lay the pack out like Write does: header, string table, dictionaries, chunks, lookup, index
+        Pack::SnPakHeaderV1& Header = Plan.Header;
+        std::memcpy(Header.Magic, Pack::kSnPakMagic, 8);
+        Header.Version = Pack::kSnPakVersion;
+        Header.HeaderSize = sizeof(Pack::SnPakHeaderV1);
+        Header.EndianMarker = Pack::kEndianMarker;
+        Pack::SetChunkAlignment(Header, Plan.Alignment);
+        uint64_t CurrentOffset = sizeof(Header);
+
+        Plan.StringTableData = BuildStringTableBlock(Strings);
+        Header.StringTableOffset = CurrentOffset;
+        Header.StringTableSize = Plan.StringTableData.size();
+        CurrentOffset += Plan.StringTableData.size();
+
+        if (!Dictionaries.empty())
+        {
+          Plan.DictionaryData = BuildDictionaryBlock(Dictionaries);
+          Pack::SetDictionaryBlock(Header, CurrentOffset, Plan.DictionaryData.size());
+          CurrentOffset += Plan.DictionaryData.size();
+        }
+
+        std::vector<size_t> WriteOrder;
+        for (size_t ChunkIndex = 0; ChunkIndex < Chunks.size(); ++ChunkIndex)
+        {
+          if (Chunks[ChunkIndex].Canonical == ChunkIndex)
+          {
+            WriteOrder.push_back(ChunkIndex);
+          }
+        }
+        std::ranges::sort(WriteOrder, [&Chunks](const size_t A, const size_t B) {
+          return std::tie(Chunks[A].Source, Chunks[A].Offset) < std::tie(Chunks[B].Source, Chunks[B].Offset);
+        });
+        for (size_t Position = 1; Position < WriteOrder.size(); ++Position)
+        {
+          const CopiedChunk& Previous = Chunks[WriteOrder[Position - 1]];
+          const CopiedChunk& Chunk = Chunks[WriteOrder[Position]];
+          if (Previous.Source == Chunk.Source && Chunk.Offset < Previous.Offset + Previous.Size)
+          {
+            return std::unexpected(Sources[Chunk.Source].Path + ": chunks at offsets " + std::to_string(Previous.Offset) + " and " +
+                                   std::to_string(Chunk.Offset) + " overlap");
+          }
         }
-      }
 
-      static Pack::ESnPakCompressionLevel ToInternalCompressionLevel(const EPackCompressionLevel Level)
-      {
-        switch (Level)
+        if (!AccessOrderProfile.empty())
         {
-          case EPackCompressionLevel::Fast:
-            return Pack::ESnPakCompressionLevel::Fast;
-          case EPackCompressionLevel::High:
-            return Pack::ESnPakCompressionLevel::High;
-          case EPackCompressionLevel::Max:
-            return Pack::ESnPakCompressionLevel::Max;
-          case EPackCompressionLevel::Default:
-          default:
-            return Pack::ESnPakCompressionLevel::Default;
+          // Each chunk moves to the layout position of the first asset that uses it
+          std::vector<AssetId> Ids(IndexEntries.size());
+          std::vector<std::vector<AssetId>> Dependencies(IndexEntries.size());
+          for (size_t EntryIndex = 0; EntryIndex < IndexEntries.size(); ++EntryIndex)
+          {
+            std::memcpy(Ids[EntryIndex].Bytes, IndexEntries[EntryIndex].AssetId, sizeof(Ids[EntryIndex].Bytes));
+          }
+          for (const Pack::SnPakDependencyOwnerV1& Owner : DependencyOwners)
+          {
+            for (uint32_t DependencyIndex = 0; DependencyIndex < Owner.DependencyCount; ++DependencyIndex)
+            {
+              AssetId& Id = Dependencies[Owner.AssetIndex].emplace_back();
+              std::memcpy(Id.Bytes, DependencyEntries[Owner.FirstDependencyIndex + DependencyIndex].AssetId, sizeof(Id.Bytes));
+            }
+          }
+
+          std::vector<size_t> Rank(Chunks.size(), std::numeric_limits<size_t>::max());
+          const std::vector<size_t> Layout = ComputeLayoutOrder(Ids, Dependencies);
+          for (size_t Position = 0; Position < Layout.size(); ++Position)
+          {
+            const size_t EntryIndex = Layout[Position];
+            size_t& PayloadRank = Rank[Chunks[PayloadChunks[EntryIndex]].Canonical];
+            PayloadRank = std::min(PayloadRank, Position);
+            const Pack::SnPakIndexEntryV1& Entry = IndexEntries[EntryIndex];
+            for (uint32_t BulkIndex = 0; (Entry.Flags & Pack::IndexEntryFlag_HasBulk) && BulkIndex < Entry.BulkCount; ++BulkIndex)
+            {
+              size_t& BulkRank = Rank[Chunks[BulkChunks[Entry.BulkFirstIndex + BulkIndex]].Canonical];
+              BulkRank = std::min(BulkRank, Position);
+            }
+          }
+          std::ranges::stable_sort(WriteOrder, {}, [&Rank](const size_t ChunkIndex) { return Rank[ChunkIndex]; });
         }
-      }
 
-      static Pack::ESnPakCompression ResolveCompression(const std::optional<EPackCompression>& Override,
-                                                        const Pack::ESnPakCompression Fallback)
-      {
-        return Override ? ToInternalCompression(*Override) : Fallback;
-      }
+        for (const size_t ChunkIndex : WriteOrder)
+        {
+          CopiedChunk& Chunk = Chunks[ChunkIndex];
+          Chunk.NewOffset = Pack::AlignChunkOffset(CurrentOffset, Plan.Alignment);
+          CurrentOffset = Chunk.NewOffset + Chunk.Size;
+        }
 
-      static Pack::ESnPakCompressionLevel ResolveCompressionLevel(const std::optional<EPackCompressionLevel>& Override,
-                                                                  const Pack::ESnPakCompressionLevel Fallback,
-                                                                  const Pack::ESnPakCompression Compression)
-      {
-        if (Override)
+        for (size_t EntryIndex = 0; EntryIndex < IndexEntries.size(); ++EntryIndex)
         {
-          return ToInternalCompressionLevel(*Override);
+          IndexEntries[EntryIndex].PayloadChunkOffset = Chunks[Chunks[PayloadChunks[EntryIndex]].Canonical].NewOffset;
         }
-        if (Compression == Pack::ESnPakCompression::None)
+        for (size_t BulkIndex = 0; BulkIndex < BulkEntries.size(); ++BulkIndex)
         {
-          return Pack::ESnPakCompressionLevel::Default;
+          BulkEntries[BulkIndex].ChunkOffset = Chunks[Chunks[BulkChunks[BulkIndex]].Canonical].NewOffset;
         }
-        return Fallback;
+        Plan.Chunks.reserve(WriteOrder.size());
+        for (const size_t ChunkIndex : WriteOrder)
+        {
+          Plan.Chunks.push_back(Chunks[ChunkIndex]);
+        }
+
+        const uint64_t LookupOffset = CurrentOffset;
+        if (bWriteLookupTables)
+        {
+          Plan.LookupData = BuildLookupBlock(IndexEntries);
+        }
+        CurrentOffset += Plan.LookupData.size();
+
+        Plan.IndexData = BuildIndexBlock(IndexEntries, BulkEntries, DependencyOwners, DependencyEntries, LookupOffset, Plan.LookupData.size(),
+                                         Plan.bCompressIndex);
+        Header.IndexOffset = CurrentOffset;
+        Header.IndexSize = Plan.IndexData.size();
+        CurrentOffset += Plan.IndexData.size();
+        Header.FileSize = CurrentOffset;
+
+        const XXH128_hash_t IndexHash = XXH3_128bits(Plan.IndexData.data(), Plan.IndexData.size());
+        Header.IndexHashHi = IndexHash.high64;
+        Header.IndexHashLo = IndexHash.low64;
+        return Plan;
       }
 
-      std::vector<uint8_t> CompressData(const uint8_t* Data, size_t Size) const
+      // Write Plan to OutputPath (through a temp file and rename), copying chunk bytes from Sources.
+      // The sources are closed before the rename so OutputPath may be one of them.
+      static std::expected<void, std::string> WriteCopy(std::vector<CopySource>& Sources, const CopyPlan& Plan, const std::string& OutputPath)
       {
-        return Pack::Compress(Data, Size, Compression, CompressionLevel);
+        const std::string TempPath = OutputPath + ".tmp";
+        {
+          std::ofstream File(TempPath, std::ios::binary | std::ios::trunc);
+          if (!File.is_open())
+          {
+            return std::unexpected("Failed to open output file: " + TempPath);
+          }
+          auto Abandon = [&File, &TempPath](std::string Error) {
+            File.close();
+            std::error_code Ec;
+            std::filesystem::remove(TempPath, Ec);
+            return std::unexpected(std::move(Error));
+          };
+
+          File.write(reinterpret_cast<const char*>(&Plan.Header), sizeof(Plan.Header));
+          File.write(reinterpret_cast<const char*>(Plan.StringTableData.data()), static_cast<std::streamsize>(Plan.StringTableData.size()));
+          File.write(reinterpret_cast<const char*>(Plan.DictionaryData.data()), static_cast<std::streamsize>(Plan.DictionaryData.size()));
+          uint64_t CurrentOffset = sizeof(Plan.Header) + Plan.StringTableData.size() + Plan.DictionaryData.size();
+
+          std::vector<char> Buffer(4u * 1024 * 1024);
+          for (const CopiedChunk& Chunk : Plan.Chunks)
+          {
+            if (!PadToChunkAlignment(File, CurrentOffset, Plan.Alignment) || CurrentOffset != Chunk.NewOffset)
+            {
+              return Abandon("Failed to write chunk padding to " + TempPath);
+            }
+            File.write(reinterpret_cast<const char*>(&Chunk.Header), sizeof(Chunk.Header));
+
+            CopySource& Source = Sources[Chunk.Source];
+            Source.File.clear();
+            Source.File.seekg(static_cast<std::streamoff>(Chunk.Offset + sizeof(Chunk.Header)), std::ios::beg);
+            uint64_t Remaining = Chunk.Header.SizeCompressed;
+            while (Remaining > 0)
+            {
+              const auto Count = static_cast<std::streamsize>(std::min<uint64_t>(Remaining, Buffer.size()));
+              Source.File.read(Buffer.data(), Count);
+              File.write(Buffer.data(), Count);
+              if (!Source.File.good() || !File.good())
+              {
+                return Abandon(Source.Path + ": failed to copy chunk at offset " + std::to_string(Chunk.Offset));
+              }
+              Remaining -= static_cast<uint64_t>(Count);
+            }
+            CurrentOffset += Chunk.Size;
+          }
+
+          File.write(reinterpret_cast<const char*>(Plan.LookupData.data()), static_cast<std::streamsize>(Plan.LookupData.size()));
+          File.write(reinterpret_cast<const char*>(Plan.IndexData.data()), static_cast<std::streamsize>(Plan.IndexData.size()));
+          if (!File.good())
+          {
+            return Abandon("Failed to write pack: " + TempPath);
+          }
+        }
+
+        for (CopySource& Source : Sources)
+        {
+          Source.File.close();
+        }
+        try
+        {
+          std::filesystem::rename(TempPath, OutputPath);
+        }
+        catch (const std::exception& E)
+        {
+          return std::unexpected(std::string("Failed to rename temp file: ") + E.what());
+        }
+        return {};
       }
 
       static std::vector<uint8_t> BuildStringTableBlock(const std::vector<std::string>& Strings)
@@ -125,10 +2018,101 @@ namespace SnAPI::AssetPipeline
         return Result;
       }
 
+      // Precomputed lookup tables so readers can resolve AssetIds and names straight from the
+      // mapping instead of building hash maps on every mount.
+      static std::vector<uint8_t> BuildLookupBlock(const std::vector<Pack::SnPakIndexEntryV1>& Entries)
+      {
+        const uint32_t EntryCount = static_cast<uint32_t>(Entries.size());
+
+        // Unique AssetIds in sorted order; for duplicates the last entry wins, like the reader's map
+        std::vector<uint32_t> Sorted(EntryCount);
+        std::iota(Sorted.begin(), Sorted.end(), 0u);
+        std::sort(Sorted.begin(), Sorted.end(), [&Entries](const uint32_t A, const uint32_t B) {
+          const int Cmp = std::memcmp(Entries[A].AssetId, Entries[B].AssetId, 16);
+          return Cmp != 0 ? Cmp < 0 : A < B;
+        });
+        std::vector<uint32_t> Unique;
+        Unique.reserve(Sorted.size());
+        for (const uint32_t AssetIndex : Sorted)
+        {
+          if (!Unique.empty() && std::memcmp(Entries[Unique.back()].AssetId, Entries[AssetIndex].AssetId, 16) == 0)
+          {
+            Unique.back() = AssetIndex;
+          }
+          else
+          {
+            Unique.push_back(AssetIndex);
+          }
+        }
+
+        // Eytzinger layout: node k (1-based) has children 2k and 2k+1, filled by in-order traversal
+        const size_t IdCount = Unique.size();
+        std::vector<Pack::SnPakIdLookupEntryV1> IdEntries(IdCount);
+        size_t NextSorted = 0;
+        auto Fill = [&](auto& Self, const size_t Node) -> void {
+          if (Node > IdCount)
+          {
+            return;
+          }
+          Self(Self, Node * 2);
+          const uint32_t AssetIndex = Unique[NextSorted++];
+          Pack::CopyUuid(IdEntries[Node - 1].AssetId, Entries[AssetIndex].AssetId);
+          IdEntries[Node - 1].AssetIndex = AssetIndex;
+          Self(Self, Node * 2 + 1);
+        };
+        Fill(Fill, 1);
+
+        // Linear-probed name hash table at <= 50% load; entries sharing a hash stay in index order
+        const uint32_t BucketCount = EntryCount == 0 ? 0 : std::bit_ceil(EntryCount * 2u);
+        std::vector<Pack::SnPakNameBucketV1> Buckets(BucketCount, Pack::SnPakNameBucketV1{0, Pack::kEmptyNameBucket});
+        for (uint32_t AssetIndex = 0; AssetIndex < EntryCount; ++AssetIndex)
+        {
+          uint32_t Slot = static_cast<uint32_t>(Entries[AssetIndex].NameHash64) & (BucketCount - 1);
+          while (Buckets[Slot].AssetIndex != Pack::kEmptyNameBucket)
+          {
+            Slot = (Slot + 1) & (BucketCount - 1);
+          }
+          Buckets[Slot].NameHash64 = Entries[AssetIndex].NameHash64;
+          Buckets[Slot].AssetIndex = AssetIndex;
+        }
+
+        Pack::SnPakLookupHeaderV1 Header = {};
+        std::memcpy(Header.Magic, Pack::kLookupMagic, 4);
+        Header.Version = 1;
+        Header.IdCount = static_cast<uint32_t>(IdCount);
+        Header.NameBucketCount = BucketCount;
+
+        const size_t IdsSize = IdEntries.size() * sizeof(Pack::SnPakIdLookupEntryV1);
+        const size_t BucketsSize = Buckets.size() * sizeof(Pack::SnPakNameBucketV1);
+        Header.BlockSize = sizeof(Header) + IdsSize + BucketsSize;
+
+        std::vector<uint8_t> Result(Header.BlockSize);
+        if (!IdEntries.empty())
+        {
+          std::memcpy(Result.data() + sizeof(Header), IdEntries.data(), IdsSize);
+        }
+        if (!Buckets.empty())
+        {
+          std::memcpy(Result.data() + sizeof(Header) + IdsSize, Buckets.data(), BucketsSize);
+        }
+
+        const XXH128_hash_t Hash = XXH3_128bits(Result.data() + sizeof(Header), IdsSize + BucketsSize);
+        Header.HashHi = Hash.high64;
+        Header.HashLo = Hash.low64;
+        std::memcpy(Result.data(), &Header, sizeof(Header));
+
+        return Result;
+      }
+
+      // With bCompressArrays the arrays are stored as compressed record blocks
+      // (IndexFlag_CompressedArrays); EntriesHash always covers the decoded arrays
       static std::vector<uint8_t> BuildIndexBlock(const std::vector<Pack::SnPakIndexEntryV1>& Entries,
                                                   const std::vector<Pack::SnPakBulkEntryV1>& BulkEntries,
                                                   const std::vector<Pack::SnPakDependencyOwnerV1>& DependencyOwners,
                                                   const std::vector<Pack::SnPakDependencyEntryV1>& DependencyEntries,
+                                                  uint64_t LookupOffset,
+                                                  uint64_t LookupSize,
+                                                  bool bCompressArrays,
                                                   uint64_t PrevOffset = 0,
                                                   uint64_t PrevSize = 0)
       {
@@ -141,6 +2125,12 @@ namespace SnAPI::AssetPipeline
         Header.PreviousIndexSize = PrevSize;
         Pack::SetDependencyOwnerCount(Header, static_cast<uint32_t>(DependencyOwners.size()));
         Pack::SetDependencyEntryCount(Header, static_cast<uint32_t>(DependencyEntries.size()));
+        uint32_t Flags = Pack::IndexFlag_None;
+        if (LookupSize > 0)
+        {
+          Flags |= Pack::IndexFlag_HasLookupBlock;
+          Pack::SetLookupBlock(Header, LookupOffset, LookupSize);
+        }
 
         size_t EntriesSize = Entries.size() * sizeof(Pack::SnPakIndexEntryV1);
         size_t BulkEntriesSize = BulkEntries.size() * sizeof(Pack::SnPakBulkEntryV1);
@@ -149,7 +2139,6 @@ namespace SnAPI::AssetPipeline
         Header.BlockSize = sizeof(Header) + EntriesSize + BulkEntriesSize + DependencyOwnersSize + DependencyEntriesSize;
 
         std::vector<uint8_t> Result(Header.BlockSize);
-        std::memcpy(Result.data(), &Header, sizeof(Header));
         if (!Entries.empty())
         {
           std::memcpy(Result.data() + sizeof(Header), Entries.data(), EntriesSize);
@@ -169,15 +2158,224 @@ namespace SnAPI::AssetPipeline
                       DependencyEntriesSize);
         }
 
-        auto [low64, high64] =
-            XXH3_128bits(Result.data() + sizeof(Header), EntriesSize + BulkEntriesSize + DependencyOwnersSize + DependencyEntriesSize);
-        auto* HeaderPtr = reinterpret_cast<Pack::SnPakIndexHeaderV1*>(Result.data());
-        HeaderPtr->EntriesHashHi = high64;
-        HeaderPtr->EntriesHashLo = low64;
+        const std::span<const uint8_t> Arrays(Result.data() + sizeof(Header), Result.size() - sizeof(Header));
+        auto [low64, high64] = XXH3_128bits(Arrays.data(), Arrays.size());
+        Header.EntriesHashHi = high64;
+        Header.EntriesHashLo = low64;
+
+        if (bCompressArrays)
+        {
+          const std::vector<uint8_t> Encoded = Pack::EncodeIndexArrays(Arrays, Pack::GetIndexArrayLayout(Header));
+          Flags |= Pack::IndexFlag_CompressedArrays;
+          Header.BlockSize = sizeof(Header) + Encoded.size();
+          Result.resize(Header.BlockSize);
+          std::memcpy(Result.data() + sizeof(Header), Encoded.data(), Encoded.size());
+        }
 
+        Pack::SetIndexFlags(Header, Flags);
+        std::memcpy(Result.data(), &Header, sizeof(Header));
         return Result;
       }
 
+      // Compress and append all buffered assets to the streaming temp file, keeping only
+      // their index metadata. Errors are latched in Streaming->Error.
+      void FlushStreaming()
+      {
+        if (!Streaming || !Streaming->Error.empty() || Assets.empty())
+        {
+          return;
+        }
+
+        StreamingState& State = *Streaming;
+        std::vector<const AssetPackEntry*> PendingAssets;
+        PendingAssets.reserve(Assets.size());
+        const size_t FirstEntry = State.IndexEntries.size();
+        for (const auto& Asset : Assets)
+        {
+          PendingAssets.push_back(&Asset);
+          // String ids are assigned when the string table is built in Write()
+          State.IndexEntries.push_back(MakeIndexEntry(Asset, Pack::kInvalidStringId, Pack::kInvalidStringId));
+        }
+
+        // Within the batch, chunks follow the access-order profile
+        const std::vector<size_t> Layout = ComputeLayoutOrder(PendingAssets);
+        std::vector<const AssetPackEntry*> LayoutAssets;
+        LayoutAssets.reserve(Layout.size());
+        for (const size_t AssetIndex : Layout)
+        {
+          LayoutAssets.push_back(PendingAssets[AssetIndex]);
+        }
+
+        try
+        {
+          auto ChunkResult = EncodeChunksInOrder(
+              LayoutAssets, State.WrittenChunks, [&](const ChunkJob& Job, EncodedChunk&& Chunk) -> std::expected<void, std::string> {
+                auto Offset = PlaceChunk(State.File, Chunk, State.CurrentOffset, State.ChunkAlignment, State.WrittenChunks);
+                if (!Offset)
+                {
+                  return std::unexpected(Offset.error() + " to " + State.TempPath);
+                }
+
+                const AssetPackEntry& Asset = *LayoutAssets[Job.AssetIndex];
+                Pack::SnPakIndexEntryV1& Entry = State.IndexEntries[FirstEntry + Layout[Job.AssetIndex]];
+                if (Job.ChunkIndex == 0)
+                {
+                  SetPayloadLocation(Entry, Chunk, *Offset);
+                  if (!Asset.Bulk.empty())
+                  {
+                    if (State.BulkEntries.size() > static_cast<size_t>(std::numeric_limits<uint32_t>::max()) - Asset.Bulk.size())
+                    {
+                      return std::unexpected("Bulk table exceeds 32-bit range");
+                    }
+                    Entry.Flags |= Pack::IndexEntryFlag_HasBulk;
+                    Entry.BulkFirstIndex = static_cast<uint32_t>(State.BulkEntries.size());
+                    Entry.BulkCount = static_cast<uint32_t>(Asset.Bulk.size());
+                  }
+                }
+                else
+                {
+                  State.BulkEntries.push_back(MakeBulkEntry(Asset.Bulk[Job.ChunkIndex - 1], Chunk, *Offset));
+                }
+                return {};
+              });
+          if (!ChunkResult)
+          {
+            State.Error = ChunkResult.error();
+          }
+        }
+        catch (const std::exception& E)
+        {
+          State.Error = E.what();
+        }
+
+        for (auto& Asset : Assets)
+        {
+          State.Assets.push_back({std::move(Asset.Name), std::move(Asset.VariantKey), std::move(Asset.AssetDependencies)});
+        }
+        Assets.clear();
+        State.BufferedBytes = 0;
+      }
+
+      // Flush remaining buffered assets, then write string table, index and header for a
+      // streaming write and move the temp file into place
+      std::expected<void, std::string> FinishStreamingWrite()
+      {
+        FlushStreaming();
+
+        std::unique_ptr<StreamingState> State = std::move(Streaming);
+        auto Fail = [&State](const std::string& Message) -> std::expected<void, std::string> {
+          State->File.close();
+          std::error_code Ec;
+          std::filesystem::remove(State->TempPath, Ec);
+          return std::unexpected(Message);
+        };
+
+        if (!State->Error.empty())
+        {
+          return Fail("Streaming write failed: " + State->Error);
+        }
+
+        std::vector<std::string> StringTable;
+        std::unordered_map<std::string, uint32_t> StringToId;
+        auto AddString = [&](const std::string& Str) -> std::expected<uint32_t, std::string> {
+          if (auto It = StringToId.find(Str); It != StringToId.end())
+          {
+            return It->second;
+          }
+          if (StringTable.size() >= static_cast<size_t>(std::numeric_limits<uint32_t>::max()))
+          {
+            return std::unexpected("String table exceeds 32-bit string id range");
+          }
+          const auto Id = static_cast<uint32_t>(StringTable.size());
+          StringTable.push_back(Str);
+          StringToId.emplace(Str, Id);
+          return Id;
+        };
+
+        std::vector<Pack::SnPakDependencyOwnerV1> DependencyOwners;
+        std::vector<Pack::SnPakDependencyEntryV1> DependencyEntries;
+        for (size_t AssetIndex = 0; AssetIndex < State->Assets.size(); ++AssetIndex)
+        {
+          const StreamedAsset& Asset = State->Assets[AssetIndex];
+          Pack::SnPakIndexEntryV1& Entry = State->IndexEntries[AssetIndex];
+
+          auto NameId = AddString(Asset.Name);
+          if (!NameId)
+          {
+            return Fail(NameId.error());
+          }
+          Entry.NameStringId = *NameId;
+          if (!Asset.VariantKey.empty())
+          {
+            auto VariantId = AddString(Asset.VariantKey);
+            if (!VariantId)
+            {
+              return Fail(VariantId.error());
+            }
+            Entry.VariantStringId = *VariantId;
+          }
+
+          auto DependencyResult = AppendDependencyMetadata(
+              static_cast<uint32_t>(AssetIndex), Asset.AssetDependencies, DependencyOwners, DependencyEntries, AddString);
+          if (!DependencyResult)
+          {
+            return Fail(DependencyResult.error());
+          }
+        }
+
+        const uint64_t StringTableOffset = State->CurrentOffset;
+        const std::vector<uint8_t> StringTableData = BuildStringTableBlock(StringTable);
+        State->File.write(reinterpret_cast<const char*>(StringTableData.data()), static_cast<std::streamsize>(StringTableData.size()));
+        State->CurrentOffset += StringTableData.size();
+
+        const uint64_t LookupOffset = State->CurrentOffset;
+        const std::vector<uint8_t> LookupData = bWriteLookupTables ? BuildLookupBlock(State->IndexEntries) : std::vector<uint8_t>{};
+        State->File.write(reinterpret_cast<const char*>(LookupData.data()), static_cast<std::streamsize>(LookupData.size()));
+        State->CurrentOffset += LookupData.size();
+
+        const uint64_t IndexOffset = State->CurrentOffset;
+        const std::vector<uint8_t> IndexData =
+            BuildIndexBlock(State->IndexEntries, State->BulkEntries, DependencyOwners, DependencyEntries, LookupOffset, LookupData.size(),
+                            bCompressIndex);
+        State->File.write(reinterpret_cast<const char*>(IndexData.data()), static_cast<std::streamsize>(IndexData.size()));
+        State->CurrentOffset += IndexData.size();
+
+        Pack::SnPakHeaderV1 Header = {};
+        std::memcpy(Header.Magic, Pack::kSnPakMagic, 8);
+        Header.Version = Pack::kSnPakVersion;
+        Header.HeaderSize = sizeof(Pack::SnPakHeaderV1);
+        Header.EndianMarker = Pack::kEndianMarker;
+        Header.FileSize = State->CurrentOffset;
+        Header.IndexOffset = IndexOffset;
+        Header.IndexSize = IndexData.size();
+        Header.StringTableOffset = StringTableOffset;
+        Header.StringTableSize = StringTableData.size();
+        Pack::SetChunkAlignment(Header, State->ChunkAlignment);
+
+        const XXH128_hash_t IndexHash = XXH3_128bits(IndexData.data(), IndexData.size());
+        Header.IndexHashHi = IndexHash.high64;
+        Header.IndexHashLo = IndexHash.low64;
+
+        State->File.seekp(0, std::ios::beg);
+        State->File.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+        if (!State->File.good())
+        {
+          return Fail("Failed to finalize streamed pack: " + State->TempPath);
+        }
+        State->File.close();
+
+        try
+        {
+          std::filesystem::rename(State->TempPath, State->OutputPath);
+        }
+        catch (const std::exception& E)
+        {
+          return Fail(std::string("Failed to rename temp file: ") + E.what());
+        }
+
+        return {};
+      }
+
       template <typename AddStringFn>
       static std::expected<void, std::string> AppendDependencyMetadata(const uint32_t AssetIndex,
                                                                        const std::vector<AssetDependencyRef>& Dependencies,
@@ -239,7 +2437,30 @@ namespace SnAPI::AssetPipeline
 
   void AssetPackWriter::SetCompression(const EPackCompression Mode) const
   {
-    m_Impl->Compression = Impl::ToInternalCompression(Mode);
+    m_Impl->bAutoCompression = Mode == EPackCompression::Auto;
+    if (!m_Impl->bAutoCompression)
+    {
+      m_Impl->Compression = Impl::ToInternalCompression(Mode);
+    }
+  }
+
+  void AssetPackWriter::SetAutoCompressionSettings(PackAutoCompressionSettings Settings) const
+  {
+    m_Impl->AutoCompression = std::move(Settings);
+  }
+
+  std::vector<PackCodecStats> AssetPackWriter::GetCompressionStats() const
+  {
+    std::vector<PackCodecStats> Stats;
+    for (size_t Mode = 0; Mode < m_Impl->CodecStats.size(); ++Mode)
+    {
+      if (m_Impl->CodecStats[Mode].ChunkCount > 0)
+      {
+        Stats.push_back(m_Impl->CodecStats[Mode]);
+        Stats.back().Compression = Impl::ToPublicCompression(static_cast<Pack::ESnPakCompression>(Mode));
+      }
+    }
+    return Stats;
   }
 
   void AssetPackWriter::SetCompressionLevel(const EPackCompressionLevel Level) const
@@ -252,8 +2473,113 @@ namespace SnAPI::AssetPipeline
     m_Impl->CompressionLevel = bEnable ? Pack::ESnPakCompressionLevel::Max : Pack::ESnPakCompressionLevel::Default;
   }
 
+  void AssetPackWriter::SetCompressionThreads(const uint32_t ThreadCount) const
+  {
+    m_Impl->CompressionThreads = ThreadCount;
+  }
+
+  void AssetPackWriter::SetWriteLookupTables(const bool bEnable) const
+  {
+    m_Impl->bWriteLookupTables = bEnable;
+  }
+
+  void AssetPackWriter::SetCompressIndex(const bool bEnable) const
+  {
+    m_Impl->bCompressIndex = bEnable;
+  }
+
+  void AssetPackWriter::SetDeduplicateChunks(const bool bEnable) const
+  {
+    m_Impl->bDeduplicateChunks = bEnable;
+  }
+
+  void AssetPackWriter::SetChunkAlignment(const uint32_t Alignment) const
+  {
+    m_Impl->ChunkAlignment = std::bit_ceil(std::clamp(Alignment, 1u, Pack::kMaxChunkAlignment));
+  }
+
+  void AssetPackWriter::SetDictionaryTraining(PackDictionarySettings Settings) const
+  {
+    m_Impl->DictionaryTraining = Settings;
+  }
+
+  void AssetPackWriter::SetSolidBlocks(PackSolidBlockSettings Settings) const
+  {
+    m_Impl->SolidBlocks = Settings;
+  }
+
+  void AssetPackWriter::SetAccessOrderProfile(std::vector<AssetId> LoadOrder) const
+  {
+    m_Impl->AccessOrderProfile = std::move(LoadOrder);
+  }
+
+  void AssetPackWriter::SetBulkFraming(const uint64_t Threshold, const uint32_t FrameSize) const
+  {
+    m_Impl->FrameThreshold = Threshold;
+    m_Impl->FrameSize = std::clamp(FrameSize, kMinBulkFrameSize, kMaxBulkFrameSize);
+  }
+
+  std::expected<void, std::string> AssetPackWriter::BeginStreamingWrite(const std::string& OutputPath) const
+  {
+    if (m_Impl->Streaming)
+    {
+      return std::unexpected("A streaming write is already active for: " + m_Impl->Streaming->OutputPath);
+    }
+
+    auto State = std::make_unique<Impl::StreamingState>();
+    State->OutputPath = OutputPath;
+    State->TempPath = OutputPath + ".tmp";
+    State->ChunkAlignment = m_Impl->ChunkAlignment;
+    State->File.open(State->TempPath, std::ios::binary | std::ios::trunc);
+    if (!State->File.is_open())
+    {
+      return std::unexpected("Failed to open output file: " + State->TempPath);
+    }
+
+    // Header placeholder, rewritten by Write()
+    const Pack::SnPakHeaderV1 Placeholder = {};
+    State->File.write(reinterpret_cast<const char*>(&Placeholder), sizeof(Placeholder));
+    State->CurrentOffset = sizeof(Placeholder);
+
+    m_Impl->Streaming = std::move(State);
+    m_Impl->CodecStats = {};
+    // Streamed chunks are written before all payloads are known, so there is nothing to train on
+    m_Impl->Dictionaries.clear();
+
+    // Assets added before streaming began are treated like any other buffered assets
+    for (const auto& Asset : m_Impl->Assets)
+    {
+      m_Impl->Streaming->BufferedBytes += Impl::GetAssetDataSize(Asset);
+    }
+    if (m_Impl->Streaming->BufferedBytes >= m_Impl->StreamingBudget)
+    {
+      m_Impl->FlushStreaming();
+    }
+    return {};
+  }
+
+  void AssetPackWriter::SetStreamingBudget(const uint64_t MaxInFlightBytes) const
+  {
+    m_Impl->StreamingBudget = MaxInFlightBytes;
+  }
+
+  bool AssetPackWriter::IsStreaming() const
+  {
+    return m_Impl->Streaming != nullptr;
+  }
+
   void AssetPackWriter::AddAsset(AssetPackEntry Entry) const
   {
+    if (m_Impl->Streaming)
+    {
+      m_Impl->Streaming->BufferedBytes += Impl::GetAssetDataSize(Entry);
+      m_Impl->Assets.push_back(std::move(Entry));
+      if (m_Impl->Streaming->BufferedBytes >= m_Impl->StreamingBudget)
+      {
+        m_Impl->FlushStreaming();
+      }
+      return;
+    }
     m_Impl->Assets.push_back(std::move(Entry));
   }
 
@@ -267,21 +2593,33 @@ namespace SnAPI::AssetPipeline
     Entry.VariantKey = VariantKey;
     Entry.Cooked = std::move(Cooked);
     Entry.Bulk = std::move(Bulk);
-    m_Impl->Assets.push_back(std::move(Entry));
+    AddAsset(std::move(Entry));
   }
 
   void AssetPackWriter::Clear() const
   {
     m_Impl->Assets.clear();
+    m_Impl->AbandonStreaming();
   }
 
   uint32_t AssetPackWriter::GetPendingAssetCount() const
   {
-    return static_cast<uint32_t>(m_Impl->Assets.size());
+    const size_t Streamed = m_Impl->Streaming ? m_Impl->Streaming->Assets.size() : 0;
+    return static_cast<uint32_t>(m_Impl->Assets.size() + Streamed);
   }
 
   std::expected<void, std::string> AssetPackWriter::Write(const std::string& OutputPath) const
   {
+    if (m_Impl->Streaming)
+    {
+      if (m_Impl->Streaming->OutputPath != OutputPath)
+      {
+        return std::unexpected("Streaming write was started for a different output path: " + m_Impl->Streaming->OutputPath);
+      }
+      return m_Impl->FinishStreamingWrite();
+    }
+    m_Impl->CodecStats = {};
+
     std::string TempPath = OutputPath + ".tmp";
 
     std::ofstream File(TempPath, std::ios::binary | std::ios::trunc);
@@ -343,6 +2681,7 @@ namespace SnAPI::AssetPipeline
     Header.Version = Pack::kSnPakVersion;
     Header.HeaderSize = sizeof(Pack::SnPakHeaderV1);
     Header.EndianMarker = Pack::kEndianMarker;
+    Pack::SetChunkAlignment(Header, m_Impl->ChunkAlignment);
 
     File.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
     uint64_t CurrentOffset = sizeof(Header);
@@ -356,130 +2695,88 @@ namespace SnAPI::AssetPipeline
     // Freeze string table - no new strings allowed after serialization
     bStringTableFrozen = true;
 
+    std::vector<const AssetPackEntry*> PendingAssets;
+    PendingAssets.reserve(m_Impl->Assets.size());
+    for (const auto& Asset : m_Impl->Assets)
+    {
+      PendingAssets.push_back(&Asset);
+    }
+
+    // Train dictionaries and store them ahead of the chunks compressed against them
+    m_Impl->Dictionaries.clear();
+    m_Impl->TrainDictionaries(PendingAssets);
+    if (!m_Impl->Dictionaries.empty())
+    {
+      const std::vector<uint8_t> DictionaryData = Impl::BuildDictionaryBlock(m_Impl->Dictionaries);
+      File.write(reinterpret_cast<const char*>(DictionaryData.data()), static_cast<std::streamsize>(DictionaryData.size()));
+      Pack::SetDictionaryBlock(Header, CurrentOffset, DictionaryData.size());
+      CurrentOffset += DictionaryData.size();
+    }
+
     // Write chunks and build index entries
     std::vector<Pack::SnPakIndexEntryV1> IndexEntries;
     std::vector<Pack::SnPakBulkEntryV1> BulkEntries;
     std::vector<Pack::SnPakDependencyOwnerV1> DependencyOwners;
     std::vector<Pack::SnPakDependencyEntryV1> DependencyEntries;
 
-    for (auto& Asset : m_Impl->Assets)
+    IndexEntries.reserve(m_Impl->Assets.size());
+    for (const auto& Asset : m_Impl->Assets)
     {
-      Pack::SnPakIndexEntryV1 Entry = {};
-
-      Pack::CopyUuid(Entry.AssetId, Asset.Id.Bytes);
-      Pack::CopyUuid(Entry.AssetKind, Asset.AssetKind.Bytes);
-      Pack::CopyUuid(Entry.CookedPayloadType, Asset.Cooked.PayloadType.Bytes);
-      Entry.CookedSchemaVersion = Asset.Cooked.SchemaVersion;
-
-      Entry.NameStringId = GetStringId(Asset.Name);
-      Entry.NameHash64 = XXH3_64bits(Asset.Name.data(), Asset.Name.size());
+      IndexEntries.push_back(
+          Impl::MakeIndexEntry(Asset, GetStringId(Asset.Name), Asset.VariantKey.empty() ? Pack::kInvalidStringId : GetStringId(Asset.VariantKey)));
+    }
 
-      if (!Asset.VariantKey.empty())
-      {
-        Entry.VariantStringId = GetStringId(Asset.VariantKey);
-        Entry.VariantHash64 = XXH3_64bits(Asset.VariantKey.data(), Asset.VariantKey.size());
-      }
-      else
-      {
-        Entry.VariantStringId = 0xFFFFFFFF;
-        Entry.VariantHash64 = 0;
-      }
-
-      // Write main payload chunk
-      const auto AssetCompression = Impl::ResolveCompression(Asset.CompressionOverride, m_Impl->Compression);
-      const auto AssetLevel = Impl::ResolveCompressionLevel(Asset.CompressionLevelOverride, m_Impl->CompressionLevel, AssetCompression);
-      std::vector<uint8_t> CompressedPayload = Pack::Compress(Asset.Cooked.Bytes.data(), Asset.Cooked.Bytes.size(), AssetCompression, AssetLevel);
-
-      Pack::SnPakChunkHeaderV1 ChunkHeader = {};
-      std::memcpy(ChunkHeader.Magic, Pack::kChunkMagic, 4);
-      ChunkHeader.Version = 1;
-      Pack::CopyUuid(ChunkHeader.AssetId, Asset.Id.Bytes);
-      Pack::CopyUuid(ChunkHeader.PayloadType, Asset.Cooked.PayloadType.Bytes);
-      ChunkHeader.SchemaVersion = Asset.Cooked.SchemaVersion;
-      ChunkHeader.Compression = static_cast<uint8_t>(AssetCompression);
-      ChunkHeader.ChunkKind = static_cast<uint8_t>(Pack::ESnPakChunkKind::MainPayload);
-      ChunkHeader.Reserved0 = static_cast<uint16_t>(AssetLevel);
-      ChunkHeader.SizeCompressed = CompressedPayload.size();
-      ChunkHeader.SizeUncompressed = Asset.Cooked.Bytes.size();
-
-      XXH128_hash_t PayloadHash = XXH3_128bits(Asset.Cooked.Bytes.data(), Asset.Cooked.Bytes.size());
-      ChunkHeader.HashHi = PayloadHash.high64;
-      ChunkHeader.HashLo = PayloadHash.low64;
-
-      Entry.PayloadChunkOffset = CurrentOffset;
-      Entry.PayloadChunkSizeCompressed = sizeof(ChunkHeader) + CompressedPayload.size();
-      Entry.PayloadChunkSizeUncompressed = Asset.Cooked.Bytes.size();
-      Entry.Compression = static_cast<uint8_t>(AssetCompression);
-      Entry.Reserved0 = static_cast<uint16_t>(AssetLevel);
-      Entry.PayloadHashHi = PayloadHash.high64;
-      Entry.PayloadHashLo = PayloadHash.low64;
-
-      File.write(reinterpret_cast<const char*>(&ChunkHeader), sizeof(ChunkHeader));
-      File.write(reinterpret_cast<const char*>(CompressedPayload.data()), CompressedPayload.size());
-      CurrentOffset += sizeof(ChunkHeader) + CompressedPayload.size();
-
-      // Write bulk chunks
-      if (!Asset.Bulk.empty())
-      {
-        Entry.Flags |= Pack::IndexEntryFlag_HasBulk;
-        Entry.BulkFirstIndex = static_cast<uint32_t>(BulkEntries.size());
-        Entry.BulkCount = static_cast<uint32_t>(Asset.Bulk.size());
+    // Chunks are placed in layout order; index entries keep AddAsset order
+    const std::vector<size_t> Layout = m_Impl->ComputeLayoutOrder(PendingAssets);
+    std::vector<const AssetPackEntry*> LayoutAssets;
+    LayoutAssets.reserve(Layout.size());
+    for (const size_t AssetIndex : Layout)
+    {
+      LayoutAssets.push_back(PendingAssets[AssetIndex]);
+    }
 
-        for (uint32_t BulkIdx = 0; BulkIdx < Asset.Bulk.size(); ++BulkIdx)
-        {
-          auto& Bulk = Asset.Bulk[BulkIdx];
-          Pack::ESnPakCompression BulkCompression = Bulk.CompressionOverride
-                                                      ? Impl::ToInternalCompression(*Bulk.CompressionOverride)
-                                                      : (Bulk.bCompress ? m_Impl->Compression : Pack::ESnPakCompression::None);
-          Pack::ESnPakCompressionLevel BulkLevel = Impl::ResolveCompressionLevel(Bulk.CompressionLevelOverride, m_Impl->CompressionLevel, BulkCompression);
-          std::vector<uint8_t> CompressedBulk = Pack::Compress(Bulk.Bytes.data(), Bulk.Bytes.size(), BulkCompression, BulkLevel);
-
-          Pack::SnPakChunkHeaderV1 BulkChunkHeader = {};
-          std::memcpy(BulkChunkHeader.Magic, Pack::kChunkMagic, 4);
-          BulkChunkHeader.Version = 1;
-          Pack::CopyUuid(BulkChunkHeader.AssetId, Asset.Id.Bytes);
-          Pack::CopyUuid(BulkChunkHeader.PayloadType, Asset.Cooked.PayloadType.Bytes);
-          BulkChunkHeader.SchemaVersion = 0;
-          BulkChunkHeader.Compression = static_cast<uint8_t>(BulkCompression);
-          BulkChunkHeader.ChunkKind = static_cast<uint8_t>(Pack::ESnPakChunkKind::Bulk);
-          BulkChunkHeader.Reserved0 = static_cast<uint16_t>(BulkLevel);
-          BulkChunkHeader.SizeCompressed = CompressedBulk.size();
-          BulkChunkHeader.SizeUncompressed = Bulk.Bytes.size();
-
-          XXH128_hash_t BulkHash = XXH3_128bits(Bulk.Bytes.data(), Bulk.Bytes.size());
-          BulkChunkHeader.HashHi = BulkHash.high64;
-          BulkChunkHeader.HashLo = BulkHash.low64;
-
-          Pack::SnPakBulkEntryV1 BulkEntry = {};
-          auto SemanticVal = static_cast<uint32_t>(Bulk.Semantic);
-          std::memcpy(BulkEntry.Semantic, &SemanticVal, 4);
-          BulkEntry.SubIndex = Bulk.SubIndex;
-          BulkEntry.ChunkOffset = CurrentOffset;
-          BulkEntry.SizeCompressed = sizeof(BulkChunkHeader) + CompressedBulk.size();
-          BulkEntry.SizeUncompressed = Bulk.Bytes.size();
-          BulkEntry.Compression = static_cast<uint8_t>(BulkCompression);
-          BulkEntry.Reserved0[0] = static_cast<uint8_t>(BulkLevel);
-          BulkEntry.HashHi = BulkHash.high64;
-          BulkEntry.HashLo = BulkHash.low64;
-
-          BulkEntries.push_back(BulkEntry);
-
-          File.write(reinterpret_cast<const char*>(&BulkChunkHeader), sizeof(BulkChunkHeader));
-          File.write(reinterpret_cast<const char*>(CompressedBulk.data()), CompressedBulk.size());
-          CurrentOffset += sizeof(BulkChunkHeader) + CompressedBulk.size();
-        }
-      }
-      else
-      {
-        Entry.BulkFirstIndex = 0;
-        Entry.BulkCount = 0;
-      }
+    Impl::ChunkDedupTable WrittenChunks;
+    auto ChunkResult = m_Impl->EncodeChunksInOrder(
+        LayoutAssets, WrittenChunks, [&](const Impl::ChunkJob& Job, Impl::EncodedChunk&& Chunk) -> std::expected<void, std::string> {
+          auto Offset = m_Impl->PlaceChunk(File, Chunk, CurrentOffset, m_Impl->ChunkAlignment, WrittenChunks);
+          if (!Offset)
+          {
+            return std::unexpected(Offset.error() + " to " + TempPath);
+          }
 
-      IndexEntries.push_back(Entry);
+          const AssetPackEntry& Asset = *LayoutAssets[Job.AssetIndex];
+          Pack::SnPakIndexEntryV1& Entry = IndexEntries[Layout[Job.AssetIndex]];
+          if (Job.ChunkIndex == 0)
+          {
+            Impl::SetPayloadLocation(Entry, Chunk, *Offset);
+            if (!Asset.Bulk.empty())
+            {
+              Entry.Flags |= Pack::IndexEntryFlag_HasBulk;
+              Entry.BulkFirstIndex = static_cast<uint32_t>(BulkEntries.size());
+              Entry.BulkCount = static_cast<uint32_t>(Asset.Bulk.size());
+            }
+            else
+            {
+              Entry.BulkFirstIndex = 0;
+              Entry.BulkCount = 0;
+            }
+          }
+          else
+          {
+            BulkEntries.push_back(Impl::MakeBulkEntry(Asset.Bulk[Job.ChunkIndex - 1], Chunk, *Offset));
+          }
+          return {};
+        });
+    if (!ChunkResult)
+    {
+      return std::unexpected(ChunkResult.error());
+    }
 
+    for (size_t AssetIndex = 0; AssetIndex < PendingAssets.size(); ++AssetIndex)
+    {
       auto DependencyResult =
-          Impl::AppendDependencyMetadata(static_cast<uint32_t>(IndexEntries.size() - 1),
-                                         Asset.AssetDependencies,
+          Impl::AppendDependencyMetadata(static_cast<uint32_t>(AssetIndex),
+                                         PendingAssets[AssetIndex]->AssetDependencies,
                                          DependencyOwners,
                                          DependencyEntries,
                                          [&GetStringId](const std::string& Value) -> std::expected<uint32_t, std::string> {
@@ -498,9 +2795,17 @@ namespace SnAPI::AssetPipeline
       }
     }
 
+    // Write lookup block (read in place by AssetPackReader, placed just before the index)
+    const uint64_t LookupOffset = CurrentOffset;
+    const std::vector<uint8_t> LookupData = m_Impl->bWriteLookupTables ? Impl::BuildLookupBlock(IndexEntries) : std::vector<uint8_t>{};
+    File.write(reinterpret_cast<const char*>(LookupData.data()), static_cast<std::streamsize>(LookupData.size()));
+    CurrentOffset += LookupData.size();
+
     // Write index block
     uint64_t IndexOffset = CurrentOffset;
-    std::vector<uint8_t> IndexData = Impl::BuildIndexBlock(IndexEntries, BulkEntries, DependencyOwners, DependencyEntries);
+    std::vector<uint8_t> IndexData =
+        Impl::BuildIndexBlock(IndexEntries, BulkEntries, DependencyOwners, DependencyEntries, LookupOffset, LookupData.size(),
+                              m_Impl->bCompressIndex);
     File.write(reinterpret_cast<const char*>(IndexData.data()), IndexData.size());
     CurrentOffset += IndexData.size();
 
@@ -535,6 +2840,12 @@ namespace SnAPI::AssetPipeline
 
   std::expected<void, std::string> AssetPackWriter::AppendUpdate(const std::string& PackPath) const
   {
+    if (m_Impl->Streaming)
+    {
+      return std::unexpected("AppendUpdate is not available while a streaming write is active");
+    }
+    m_Impl->CodecStats = {};
+
     if (m_Impl->Assets.empty())
     {
       return {};
@@ -546,224 +2857,25 @@ namespace SnAPI::AssetPipeline
       return Write(PackPath);
     }
 
-    Pack::SnPakHeaderV1 OldHeader{};
-    File.read(reinterpret_cast<char*>(&OldHeader), sizeof(OldHeader));
-    if (!File.good())
-    {
-      return std::unexpected("Failed to read existing pack header");
-    }
-    if (std::memcmp(OldHeader.Magic, Pack::kSnPakMagic, 8) != 0)
-    {
-      return std::unexpected("Invalid pack file magic");
-    }
-    if (OldHeader.Version != Pack::kSnPakVersion)
-    {
-      return std::unexpected("Pack version mismatch - expected " + std::to_string(Pack::kSnPakVersion) +
-                             ", got " + std::to_string(OldHeader.Version));
-    }
-    if (OldHeader.HeaderSize != sizeof(Pack::SnPakHeaderV1))
-    {
-      return std::unexpected("Header size mismatch - pack may be from incompatible version");
-    }
-    if (OldHeader.EndianMarker != Pack::kEndianMarker)
-    {
-      return std::unexpected("Endian mismatch - pack was created on different architecture");
-    }
-
-    File.seekg(0, std::ios::end);
-    const uint64_t ActualFileSize = static_cast<uint64_t>(File.tellg());
-    if (OldHeader.FileSize > ActualFileSize)
-    {
-      return std::unexpected("Header FileSize (" + std::to_string(OldHeader.FileSize) +
-                             ") exceeds actual file size (" + std::to_string(ActualFileSize) +
-                             ") - pack may be truncated");
-    }
-
-    const auto CheckRange = [ActualFileSize](const uint64_t Offset, const uint64_t Size) {
-      if (Size > ActualFileSize)
-      {
-        return false;
-      }
-      if (Offset > ActualFileSize - Size)
-      {
-        return false;
-      }
-      return true;
-    };
-
-    if (!CheckRange(OldHeader.StringTableOffset, OldHeader.StringTableSize))
-    {
-      return std::unexpected("String table offset/size exceeds file bounds");
-    }
-
-    File.seekg(static_cast<std::streamoff>(OldHeader.StringTableOffset), std::ios::beg);
-    if (!File.good())
-    {
-      return std::unexpected("Failed to seek to string table");
-    }
-
-    Pack::SnPakStrBlockHeaderV1 StringHeader{};
-    File.read(reinterpret_cast<char*>(&StringHeader), sizeof(StringHeader));
-    if (!File.good())
-    {
-      return std::unexpected("Failed to read string table header");
-    }
-    if (std::memcmp(StringHeader.Magic, Pack::kStringMagic, 4) != 0)
-    {
-      return std::unexpected("Invalid string table magic");
-    }
-    if (StringHeader.Version != 1)
-    {
-      return std::unexpected("Unsupported string table version: " + std::to_string(StringHeader.Version));
-    }
-    if (StringHeader.BlockSize != OldHeader.StringTableSize)
-    {
-      return std::unexpected("String table BlockSize mismatch with header");
-    }
-    if (StringHeader.StringCount > (std::numeric_limits<size_t>::max() / sizeof(uint32_t)))
-    {
-      return std::unexpected("String table count exceeds host addressable range");
-    }
-
-    const size_t ExistingOffsetsSize = static_cast<size_t>(StringHeader.StringCount) * sizeof(uint32_t);
-    if (StringHeader.BlockSize < sizeof(Pack::SnPakStrBlockHeaderV1) + ExistingOffsetsSize)
+    auto Existing = Impl::ReadExistingPack(File);
+    if (!Existing)
     {
-      return std::unexpected("String table block size too small for offsets");
+      return std::unexpected(Existing.error());
     }
-
-    std::vector<uint32_t> ExistingStringOffsets(StringHeader.StringCount);
-    if (!ExistingStringOffsets.empty())
-    {
-      File.read(reinterpret_cast<char*>(ExistingStringOffsets.data()), static_cast<std::streamsize>(ExistingOffsetsSize));
-      if (!File.good())
-      {
-        return std::unexpected("Failed to read string table offsets");
-      }
-    }
-
-    const size_t ExistingStringDataSize =
-        static_cast<size_t>(StringHeader.BlockSize - sizeof(Pack::SnPakStrBlockHeaderV1) - ExistingOffsetsSize);
-    std::vector<uint8_t> ExistingStringData(ExistingStringDataSize);
-    if (!ExistingStringData.empty())
-    {
-      File.read(reinterpret_cast<char*>(ExistingStringData.data()), static_cast<std::streamsize>(ExistingStringDataSize));
-      if (!File.good())
-      {
-        return std::unexpected("Failed to read string table data");
-      }
-    }
-
-    std::vector<std::string> StringTable{};
-    StringTable.reserve(static_cast<size_t>(StringHeader.StringCount) + m_Impl->Assets.size() * 2u);
+    const Pack::SnPakHeaderV1& OldHeader = Existing->Header;
+    const uint64_t ActualFileSize = Existing->FileSize;
+    const std::vector<Pack::SnPakIndexEntryV1>& ExistingIndexEntries = Existing->IndexEntries;
+    const std::vector<Pack::SnPakBulkEntryV1>& ExistingBulkEntries = Existing->BulkEntries;
+    const std::vector<Pack::SnPakDependencyOwnerV1>& ExistingDependencyOwners = Existing->DependencyOwners;
+    const std::vector<Pack::SnPakDependencyEntryV1>& ExistingDependencyEntries = Existing->DependencyEntries;
+
+    std::vector<std::string>& StringTable = Existing->Strings;
+    StringTable.reserve(StringTable.size() + m_Impl->Assets.size() * 2u);
     std::unordered_map<std::string, uint32_t> StringToId{};
-    StringToId.reserve(static_cast<size_t>(StringHeader.StringCount) + m_Impl->Assets.size() * 2u);
-
-    for (uint32_t StringIndex = 0; StringIndex < StringHeader.StringCount; ++StringIndex)
-    {
-      const uint32_t Offset = ExistingStringOffsets[StringIndex];
-      if (Offset >= ExistingStringDataSize)
-      {
-        return std::unexpected("String table offset " + std::to_string(StringIndex) + " out of range");
-      }
-
-      const uint8_t* const Start = ExistingStringData.data() + Offset;
-      const size_t MaxLen = ExistingStringDataSize - Offset;
-      const void* const NullPos = std::memchr(Start, 0, MaxLen);
-      if (NullPos == nullptr)
-      {
-        return std::unexpected("String table entry " + std::to_string(StringIndex) + " missing null terminator");
-      }
-
-      const size_t Length = static_cast<const uint8_t*>(NullPos) - Start;
-      std::string StringValue(reinterpret_cast<const char*>(Start), Length);
-      StringTable.push_back(StringValue);
-      StringToId.try_emplace(StringValue, StringIndex);
-    }
-
-    if (!CheckRange(OldHeader.IndexOffset, OldHeader.IndexSize))
-    {
-      return std::unexpected("Index offset/size exceeds file bounds");
-    }
-
-    File.seekg(static_cast<std::streamoff>(OldHeader.IndexOffset), std::ios::beg);
-    if (!File.good())
-    {
-      return std::unexpected("Failed to seek to index block");
-    }
-
-    Pack::SnPakIndexHeaderV1 OldIndexHeader{};
-    File.read(reinterpret_cast<char*>(&OldIndexHeader), sizeof(OldIndexHeader));
-    if (!File.good())
-    {
-      return std::unexpected("Failed to read index header");
-    }
-    if (std::memcmp(OldIndexHeader.Magic, Pack::kIndexMagic, 4) != 0)
-    {
-      return std::unexpected("Invalid index magic");
-    }
-    if (OldIndexHeader.Version != 1)
-    {
-      return std::unexpected("Unsupported index version: " + std::to_string(OldIndexHeader.Version));
-    }
-    if (OldIndexHeader.BlockSize != OldHeader.IndexSize)
-    {
-      return std::unexpected("Index BlockSize mismatch with header");
-    }
-
-    const uint64_t ExistingIndexEntriesSize = static_cast<uint64_t>(OldIndexHeader.EntryCount) * sizeof(Pack::SnPakIndexEntryV1);
-    const uint64_t ExistingBulkEntriesSize = static_cast<uint64_t>(OldIndexHeader.BulkEntryCount) * sizeof(Pack::SnPakBulkEntryV1);
-    const uint64_t ExistingDependencyOwnerCount = Pack::GetDependencyOwnerCount(OldIndexHeader);
-    const uint64_t ExistingDependencyEntryCount = Pack::GetDependencyEntryCount(OldIndexHeader);
-    const uint64_t ExistingDependencyOwnersSize =
-        ExistingDependencyOwnerCount * sizeof(Pack::SnPakDependencyOwnerV1);
-    const uint64_t ExistingDependencyEntriesSize =
-        ExistingDependencyEntryCount * sizeof(Pack::SnPakDependencyEntryV1);
-    const uint64_t ExpectedIndexBlockSize =
-        static_cast<uint64_t>(sizeof(Pack::SnPakIndexHeaderV1)) + ExistingIndexEntriesSize + ExistingBulkEntriesSize +
-        ExistingDependencyOwnersSize + ExistingDependencyEntriesSize;
-    if (ExpectedIndexBlockSize != OldIndexHeader.BlockSize)
-    {
-      return std::unexpected("Index block size does not match entry counts");
-    }
-
-    std::vector<Pack::SnPakIndexEntryV1> ExistingIndexEntries(OldIndexHeader.EntryCount);
-    if (!ExistingIndexEntries.empty())
-    {
-      File.read(reinterpret_cast<char*>(ExistingIndexEntries.data()), static_cast<std::streamsize>(ExistingIndexEntriesSize));
-      if (!File.good())
-      {
-        return std::unexpected("Failed to read existing index entries");
-      }
-    }
-
-    std::vector<Pack::SnPakBulkEntryV1> ExistingBulkEntries(OldIndexHeader.BulkEntryCount);
-    if (!ExistingBulkEntries.empty())
-    {
-      File.read(reinterpret_cast<char*>(ExistingBulkEntries.data()), static_cast<std::streamsize>(ExistingBulkEntriesSize));
-      if (!File.good())
-      {
-        return std::unexpected("Failed to read existing bulk entries");
-      }
-    }
-
-    std::vector<Pack::SnPakDependencyOwnerV1> ExistingDependencyOwners(static_cast<size_t>(ExistingDependencyOwnerCount));
-    if (!ExistingDependencyOwners.empty())
-    {
-      File.read(reinterpret_cast<char*>(ExistingDependencyOwners.data()), static_cast<std::streamsize>(ExistingDependencyOwnersSize));
-      if (!File.good())
-      {
-        return std::unexpected("Failed to read existing dependency owner entries");
-      }
-    }
-
-    std::vector<Pack::SnPakDependencyEntryV1> ExistingDependencyEntries(static_cast<size_t>(ExistingDependencyEntryCount));
-    if (!ExistingDependencyEntries.empty())
+    StringToId.reserve(StringTable.size() + m_Impl->Assets.size() * 2u);
+    for (uint32_t StringIndex = 0; StringIndex < StringTable.size(); ++StringIndex)
     {
-      File.read(reinterpret_cast<char*>(ExistingDependencyEntries.data()), static_cast<std::streamsize>(ExistingDependencyEntriesSize));
-      if (!File.good())
-      {
-        return std::unexpected("Failed to read existing dependency entries");
-      }
+      StringToId.try_emplace(StringTable[StringIndex], StringIndex);
     }
 
     std::unordered_map<AssetId, size_t, UuidHash> ExistingAssetToIndex{};
@@ -894,10 +3006,121 @@ namespace SnAPI::AssetPipeline
       return {};
     };
 
+    // Pending assets are written in the order their index entries will appear (replacements
+    // of existing assets in existing index order, then new assets in AddAsset order) unless an
+    // access-order profile rearranges them. When the same id was added more than once, the last
+    // AddAsset wins.
+    std::vector<size_t> WriteOrder{};
+    WriteOrder.reserve(PendingById.size());
+    for (const AssetId& ExistingId : ExistingAssetOrder)
+    {
+      if (const auto PendingIt = PendingById.find(ExistingId); PendingIt != PendingById.end())
+      {
+        WriteOrder.push_back(PendingIt->second);
+      }
+    }
+    for (size_t PendingIndex = 0; PendingIndex < m_Impl->Assets.size(); ++PendingIndex)
+    {
+      const AssetId& PendingId = m_Impl->Assets[PendingIndex].Id;
+      if (PendingById[PendingId] == PendingIndex && !ExistingAssetToIndex.contains(PendingId))
+      {
+        WriteOrder.push_back(PendingIndex);
+      }
+    }
+
+    if (!m_Impl->AccessOrderProfile.empty())
+    {
+      std::vector<const AssetPackEntry*> IndexOrderAssets;
+      IndexOrderAssets.reserve(WriteOrder.size());
+      for (const size_t PendingIndex : WriteOrder)
+      {
+        IndexOrderAssets.push_back(&m_Impl->Assets[PendingIndex]);
+      }
+      std::vector<size_t> LayoutOrder;
+      LayoutOrder.reserve(WriteOrder.size());
+      for (const size_t Position : m_Impl->ComputeLayoutOrder(IndexOrderAssets))
+      {
+        LayoutOrder.push_back(WriteOrder[Position]);
+      }
+      WriteOrder = std::move(LayoutOrder);
+    }
+
+    // Chunks already in the pack can be shared by the update as well
+    Impl::ChunkDedupTable WrittenChunks;
+    if (m_Impl->bDeduplicateChunks)
+    {
+      Impl::AddExistingChunks(WrittenChunks, ExistingIndexEntries, ExistingBulkEntries);
+    }
+
+    auto ExistingDictionaries = Impl::ReadDictionaryBlock(File, OldHeader, ActualFileSize);
+    if (!ExistingDictionaries)
+    {
+      return std::unexpected(ExistingDictionaries.error());
+    }
+    m_Impl->Dictionaries = std::move(*ExistingDictionaries);
+
     File.clear();
     File.seekp(0, std::ios::end);
     uint64_t CurrentOffset = static_cast<uint64_t>(File.tellp());
 
+    // New chunks follow the existing pack's layout so its recorded alignment stays truthful
+    const uint32_t ExistingAlignment = Pack::GetChunkAlignment(OldHeader);
+
+    // Chunk locations of each written asset, indexed by pending asset index
+    std::vector<Pack::SnPakIndexEntryV1> WrittenEntries(m_Impl->Assets.size());
+    std::vector<std::vector<Pack::SnPakBulkEntryV1>> WrittenBulkEntries(m_Impl->Assets.size());
+
+    std::vector<const AssetPackEntry*> OrderedAssets{};
+    OrderedAssets.reserve(WriteOrder.size());
+    for (const size_t PendingIndex : WriteOrder)
+    {
+      OrderedAssets.push_back(&m_Impl->Assets[PendingIndex]);
+    }
+
+    // Kinds that gained a dictionary get a new dictionary block holding the old and new ones;
+    // otherwise the existing block stays referenced by the carried-over header
+    const size_t ExistingDictionaryCount = m_Impl->Dictionaries.size();
+    m_Impl->TrainDictionaries(OrderedAssets);
+    uint64_t NewDictionaryOffset = 0;
+    uint64_t NewDictionarySize = 0;
+    if (m_Impl->Dictionaries.size() > ExistingDictionaryCount)
+    {
+      const std::vector<uint8_t> DictionaryData = Impl::BuildDictionaryBlock(m_Impl->Dictionaries);
+      File.write(reinterpret_cast<const char*>(DictionaryData.data()), static_cast<std::streamsize>(DictionaryData.size()));
+      if (!File.good())
+      {
+        return std::unexpected("Failed to write dictionary block");
+      }
+      NewDictionaryOffset = CurrentOffset;
+      NewDictionarySize = DictionaryData.size();
+      CurrentOffset += DictionaryData.size();
+    }
+
+    auto ChunkResult = m_Impl->EncodeChunksInOrder(
+        OrderedAssets, WrittenChunks, [&](const Impl::ChunkJob& Job, Impl::EncodedChunk&& Chunk) -> std::expected<void, std::string> {
+          auto Offset = m_Impl->PlaceChunk(File, Chunk, CurrentOffset, ExistingAlignment, WrittenChunks);
+          if (!Offset)
+          {
+            return std::unexpected(Job.ChunkIndex == 0 ? "Failed to write payload chunk" : "Failed to write bulk chunk");
+          }
+
+          const size_t PendingIndex = WriteOrder[Job.AssetIndex];
+          if (Job.ChunkIndex == 0)
+          {
+            Impl::SetPayloadLocation(WrittenEntries[PendingIndex], Chunk, *Offset);
+          }
+          else
+          {
+            WrittenBulkEntries[PendingIndex].push_back(
+                Impl::MakeBulkEntry(OrderedAssets[Job.AssetIndex]->Bulk[Job.ChunkIndex - 1], Chunk, *Offset));
+          }
+          return {};
+        });
+    if (!ChunkResult)
+    {
+      return std::unexpected("Failed to write asset chunks: " + ChunkResult.error());
+    }
+
     std::vector<Pack::SnPakIndexEntryV1> NewIndexEntries{};
     std::vector<Pack::SnPakBulkEntryV1> NewBulkEntries{};
     std::vector<Pack::SnPakDependencyOwnerV1> NewDependencyOwners{};
@@ -905,24 +3128,18 @@ namespace SnAPI::AssetPipeline
     NewIndexEntries.reserve(ExistingAssetOrder.size() + PendingById.size());
 
     auto BuildUpdatedEntry =
-        [&](const AssetPackEntry& Asset,
+        [&](const size_t PendingIndex,
             const uint32_t AssetIndex,
             const Pack::SnPakIndexEntryV1* ExistingEntryForBulk) -> std::expected<Pack::SnPakIndexEntryV1, std::string> {
-      Pack::SnPakIndexEntryV1 Entry = {};
-
-      Pack::CopyUuid(Entry.AssetId, Asset.Id.Bytes);
-      Pack::CopyUuid(Entry.AssetKind, Asset.AssetKind.Bytes);
-      Pack::CopyUuid(Entry.CookedPayloadType, Asset.Cooked.PayloadType.Bytes);
-      Entry.CookedSchemaVersion = Asset.Cooked.SchemaVersion;
+      const AssetPackEntry& Asset = m_Impl->Assets[PendingIndex];
 
       auto NameIdResult = AddString(Asset.Name);
       if (!NameIdResult)
       {
         return std::unexpected(NameIdResult.error());
       }
-      Entry.NameStringId = *NameIdResult;
-      Entry.NameHash64 = XXH3_64bits(Asset.Name.data(), Asset.Name.size());
 
+      uint32_t VariantStringId = Pack::kInvalidStringId;
       if (!Asset.VariantKey.empty())
       {
         auto VariantIdResult = AddString(Asset.VariantKey);
@@ -930,52 +3147,21 @@ namespace SnAPI::AssetPipeline
         {
           return std::unexpected(VariantIdResult.error());
         }
-        Entry.VariantStringId = *VariantIdResult;
-        Entry.VariantHash64 = XXH3_64bits(Asset.VariantKey.data(), Asset.VariantKey.size());
-      }
-      else
-      {
-        Entry.VariantStringId = 0xFFFFFFFF;
-        Entry.VariantHash64 = 0;
-      }
-
-      const auto AssetCompression = Impl::ResolveCompression(Asset.CompressionOverride, m_Impl->Compression);
-      const auto AssetLevel = Impl::ResolveCompressionLevel(Asset.CompressionLevelOverride, m_Impl->CompressionLevel, AssetCompression);
-      std::vector<uint8_t> CompressedPayload = Pack::Compress(Asset.Cooked.Bytes.data(), Asset.Cooked.Bytes.size(), AssetCompression, AssetLevel);
-
-      Pack::SnPakChunkHeaderV1 ChunkHeader = {};
-      std::memcpy(ChunkHeader.Magic, Pack::kChunkMagic, 4);
-      ChunkHeader.Version = 1;
-      Pack::CopyUuid(ChunkHeader.AssetId, Asset.Id.Bytes);
-      Pack::CopyUuid(ChunkHeader.PayloadType, Asset.Cooked.PayloadType.Bytes);
-      ChunkHeader.SchemaVersion = Asset.Cooked.SchemaVersion;
-      ChunkHeader.Compression = static_cast<uint8_t>(AssetCompression);
-      ChunkHeader.ChunkKind = static_cast<uint8_t>(Pack::ESnPakChunkKind::MainPayload);
-      ChunkHeader.Reserved0 = static_cast<uint16_t>(AssetLevel);
-      ChunkHeader.SizeCompressed = CompressedPayload.size();
-      ChunkHeader.SizeUncompressed = Asset.Cooked.Bytes.size();
-
-      XXH128_hash_t PayloadHash = XXH3_128bits(Asset.Cooked.Bytes.data(), Asset.Cooked.Bytes.size());
-      ChunkHeader.HashHi = PayloadHash.high64;
-      ChunkHeader.HashLo = PayloadHash.low64;
-
-      Entry.PayloadChunkOffset = CurrentOffset;
-      Entry.PayloadChunkSizeCompressed = sizeof(ChunkHeader) + CompressedPayload.size();
-      Entry.PayloadChunkSizeUncompressed = Asset.Cooked.Bytes.size();
-      Entry.Compression = static_cast<uint8_t>(AssetCompression);
-      Entry.Reserved0 = static_cast<uint16_t>(AssetLevel);
-      Entry.PayloadHashHi = PayloadHash.high64;
-      Entry.PayloadHashLo = PayloadHash.low64;
-
-      File.write(reinterpret_cast<const char*>(&ChunkHeader), sizeof(ChunkHeader));
-      File.write(reinterpret_cast<const char*>(CompressedPayload.data()), static_cast<std::streamsize>(CompressedPayload.size()));
-      if (!File.good())
-      {
-        return std::unexpected("Failed to write payload chunk");
+        VariantStringId = *VariantIdResult;
       }
-      CurrentOffset += sizeof(ChunkHeader) + CompressedPayload.size();
 
-      Entry.Flags = static_cast<uint8_t>(Entry.Flags & ~Pack::IndexEntryFlag_HasBulk);
+      Pack::SnPakIndexEntryV1 Entry = Impl::MakeIndexEntry(Asset, *NameIdResult, VariantStringId);
+
+      const Pack::SnPakIndexEntryV1& Written = WrittenEntries[PendingIndex];
+      Entry.PayloadChunkOffset = Written.PayloadChunkOffset;
+      Entry.PayloadChunkSizeCompressed = Written.PayloadChunkSizeCompressed;
+      Entry.PayloadChunkSizeUncompressed = Written.PayloadChunkSizeUncompressed;
+      Entry.Compression = Written.Compression;
+      Entry.Reserved0 = Written.Reserved0;
+      Entry.PayloadHashHi = Written.PayloadHashHi;
+      Entry.PayloadHashLo = Written.PayloadHashLo;
+
+      Entry.Flags = static_cast<uint8_t>((Entry.Flags | Written.Flags) & ~Pack::IndexEntryFlag_HasBulk);
       Entry.BulkFirstIndex = 0;
       Entry.BulkCount = 0;
 
@@ -993,54 +3179,7 @@ namespace SnAPI::AssetPipeline
         Entry.Flags = static_cast<uint8_t>(Entry.Flags | Pack::IndexEntryFlag_HasBulk);
         Entry.BulkFirstIndex = static_cast<uint32_t>(NewBulkEntries.size());
         Entry.BulkCount = static_cast<uint32_t>(Asset.Bulk.size());
-
-        for (const auto& Bulk : Asset.Bulk)
-        {
-          const Pack::ESnPakCompression BulkCompression = Bulk.CompressionOverride
-                                                            ? Impl::ToInternalCompression(*Bulk.CompressionOverride)
-                                                            : (Bulk.bCompress ? m_Impl->Compression : Pack::ESnPakCompression::None);
-          const Pack::ESnPakCompressionLevel BulkLevel =
-              Impl::ResolveCompressionLevel(Bulk.CompressionLevelOverride, m_Impl->CompressionLevel, BulkCompression);
-          std::vector<uint8_t> CompressedBulk = Pack::Compress(Bulk.Bytes.data(), Bulk.Bytes.size(), BulkCompression, BulkLevel);
-
-          Pack::SnPakChunkHeaderV1 BulkChunkHeader = {};
-          std::memcpy(BulkChunkHeader.Magic, Pack::kChunkMagic, 4);
-          BulkChunkHeader.Version = 1;
-          Pack::CopyUuid(BulkChunkHeader.AssetId, Asset.Id.Bytes);
-          Pack::CopyUuid(BulkChunkHeader.PayloadType, Asset.Cooked.PayloadType.Bytes);
-          BulkChunkHeader.SchemaVersion = 0;
-          BulkChunkHeader.Compression = static_cast<uint8_t>(BulkCompression);
-          BulkChunkHeader.ChunkKind = static_cast<uint8_t>(Pack::ESnPakChunkKind::Bulk);
-          BulkChunkHeader.Reserved0 = static_cast<uint16_t>(BulkLevel);
-          BulkChunkHeader.SizeCompressed = CompressedBulk.size();
-          BulkChunkHeader.SizeUncompressed = Bulk.Bytes.size();
-
-          const XXH128_hash_t BulkHash = XXH3_128bits(Bulk.Bytes.data(), Bulk.Bytes.size());
-          BulkChunkHeader.HashHi = BulkHash.high64;
-          BulkChunkHeader.HashLo = BulkHash.low64;
-
-          Pack::SnPakBulkEntryV1 BulkEntry = {};
-          const auto SemanticVal = static_cast<uint32_t>(Bulk.Semantic);
-          std::memcpy(BulkEntry.Semantic, &SemanticVal, 4);
-          BulkEntry.SubIndex = Bulk.SubIndex;
-          BulkEntry.ChunkOffset = CurrentOffset;
-          BulkEntry.SizeCompressed = sizeof(BulkChunkHeader) + CompressedBulk.size();
-          BulkEntry.SizeUncompressed = Bulk.Bytes.size();
-          BulkEntry.Compression = static_cast<uint8_t>(BulkCompression);
-          BulkEntry.Reserved0[0] = static_cast<uint8_t>(BulkLevel);
-          BulkEntry.HashHi = BulkHash.high64;
-          BulkEntry.HashLo = BulkHash.low64;
-
-          NewBulkEntries.push_back(BulkEntry);
-
-          File.write(reinterpret_cast<const char*>(&BulkChunkHeader), sizeof(BulkChunkHeader));
-          File.write(reinterpret_cast<const char*>(CompressedBulk.data()), static_cast<std::streamsize>(CompressedBulk.size()));
-          if (!File.good())
-          {
-            return std::unexpected("Failed to write bulk chunk");
-          }
-          CurrentOffset += sizeof(BulkChunkHeader) + CompressedBulk.size();
-        }
+        NewBulkEntries.insert(NewBulkEntries.end(), WrittenBulkEntries[PendingIndex].begin(), WrittenBulkEntries[PendingIndex].end());
       }
       else if (ExistingEntryForBulk != nullptr)
       {
@@ -1072,8 +3211,7 @@ namespace SnAPI::AssetPipeline
       const auto& ExistingEntry = ExistingIndexEntries[ExistingIndexIt->second];
       if (const auto PendingIt = PendingById.find(ExistingId); PendingIt != PendingById.end())
       {
-        const AssetPackEntry& PendingAsset = m_Impl->Assets[PendingIt->second];
-        auto NewEntryResult = BuildUpdatedEntry(PendingAsset, static_cast<uint32_t>(NewIndexEntries.size()), &ExistingEntry);
+        auto NewEntryResult = BuildUpdatedEntry(PendingIt->second, static_cast<uint32_t>(NewIndexEntries.size()), &ExistingEntry);
         if (!NewEntryResult)
         {
           return std::unexpected("Failed to build updated asset entry: " + NewEntryResult.error());
@@ -1112,7 +3250,7 @@ namespace SnAPI::AssetPipeline
         continue;
       }
 
-      auto NewEntryResult = BuildUpdatedEntry(PendingAsset, static_cast<uint32_t>(NewIndexEntries.size()), nullptr);
+      auto NewEntryResult = BuildUpdatedEntry(PendingIndex, static_cast<uint32_t>(NewIndexEntries.size()), nullptr);
       if (!NewEntryResult)
       {
         return std::unexpected("Failed to build new asset entry: " + NewEntryResult.error());
@@ -1147,9 +3285,20 @@ namespace SnAPI::AssetPipeline
     }
     CurrentOffset += StringTableData.size();
 
+    const uint64_t NewLookupOffset = CurrentOffset;
+    const std::vector<uint8_t> LookupData = m_Impl->bWriteLookupTables ? Impl::BuildLookupBlock(NewIndexEntries) : std::vector<uint8_t>{};
+    File.write(reinterpret_cast<const char*>(LookupData.data()), static_cast<std::streamsize>(LookupData.size()));
+    if (!File.good())
+    {
+      return std::unexpected("Failed to write updated lookup block");
+    }
+    CurrentOffset += LookupData.size();
+
     const uint64_t NewIndexOffset = CurrentOffset;
+    // A compressed index stays compressed so updates never grow the pack's index back to full size
     std::vector<uint8_t> IndexData =
-        Impl::BuildIndexBlock(NewIndexEntries, NewBulkEntries, NewDependencyOwners, NewDependencyEntries, OldHeader.IndexOffset, OldHeader.IndexSize);
+        Impl::BuildIndexBlock(NewIndexEntries, NewBulkEntries, NewDependencyOwners, NewDependencyEntries, NewLookupOffset, LookupData.size(),
+                              m_Impl->bCompressIndex || Existing->bCompressedIndex, OldHeader.IndexOffset, OldHeader.IndexSize);
     File.write(reinterpret_cast<const char*>(IndexData.data()), static_cast<std::streamsize>(IndexData.size()));
     if (!File.good())
     {
@@ -1166,6 +3315,10 @@ namespace SnAPI::AssetPipeline
     NewHeader.PreviousIndexOffset = OldHeader.IndexOffset;
     NewHeader.PreviousIndexSize = OldHeader.IndexSize;
     NewHeader.Flags |= Pack::SnPakFlag_HasTrailingIndex;
+    if (NewDictionarySize != 0)
+    {
+      Pack::SetDictionaryBlock(NewHeader, NewDictionaryOffset, NewDictionarySize);
+    }
 
     const XXH128_hash_t IndexHash = XXH3_128bits(IndexData.data(), IndexData.size());
     NewHeader.IndexHashHi = IndexHash.high64;
@@ -1182,4 +3335,107 @@ namespace SnAPI::AssetPipeline
     return {};
   }
 
+  std::expected<PackCompactionResult, std::string> AssetPackWriter::Compact(const std::string& PackPath, const double MinDeadRatio) const
+  {
+    auto Source = Impl::OpenCopySource(PackPath);
+    if (!Source)
+    {
+      return std::unexpected(Source.error());
+    }
+    std::vector<Impl::CopySource> Sources;
+    Sources.push_back(std::move(*Source));
+
+    std::vector<std::pair<uint32_t, uint32_t>> Selected;
+    Selected.reserve(Sources[0].Pack.IndexEntries.size());
+    for (uint32_t EntryIndex = 0; EntryIndex < Sources[0].Pack.IndexEntries.size(); ++EntryIndex)
+    {
+      Selected.emplace_back(0u, EntryIndex);
+    }
+
+    auto Plan = m_Impl->PlanCopy(Sources, Selected);
+    if (!Plan)
+    {
+      return std::unexpected(Plan.error());
+    }
+
+    PackCompactionResult Result;
+    Result.SizeBefore = Sources[0].Pack.FileSize;
+    Result.SizeAfter = Plan->Header.FileSize;
+    Result.ChunkCount = static_cast<uint32_t>(Plan->Chunks.size());
+    const uint64_t DeadBytes = Result.SizeBefore > Result.SizeAfter ? Result.SizeBefore - Result.SizeAfter : 0;
+    if (Result.SizeBefore == 0 || static_cast<double>(DeadBytes) < MinDeadRatio * static_cast<double>(Result.SizeBefore))
+    {
+      return Result;
+    }
+
+    auto WriteResult = Impl::WriteCopy(Sources, *Plan, PackPath);
+    if (!WriteResult)
+    {
+      return std::unexpected(WriteResult.error());
+    }
+    Result.bCompacted = true;
+    return Result;
+  }
+
+  std::expected<PackMergeResult, std::string> AssetPackWriter::Merge(const std::vector<std::string>& InputPaths, const std::string& OutputPath) const
+  {
+    if (InputPaths.empty())
+    {
+      return std::unexpected("No input packs to merge");
+    }
+
+    std::vector<Impl::CopySource> Sources;
+    Sources.reserve(InputPaths.size());
+    for (const std::string& InputPath : InputPaths)
+    {
+      auto Source = Impl::OpenCopySource(InputPath);
+      if (!Source)
+      {
+        return std::unexpected(Source.error());
+      }
+      Sources.push_back(std::move(*Source));
+    }
+
+    // An asset takes the position of its first occurrence and the entry of its last one
+    PackMergeResult Result;
+    std::vector<std::pair<uint32_t, uint32_t>> Selected;
+    std::unordered_map<AssetId, size_t, UuidHash> PositionById;
+    for (uint32_t SourceIndex = 0; SourceIndex < Sources.size(); ++SourceIndex)
+    {
+      const auto& Entries = Sources[SourceIndex].Pack.IndexEntries;
+      for (uint32_t EntryIndex = 0; EntryIndex < Entries.size(); ++EntryIndex)
+      {
+        AssetId Id{};
+        std::memcpy(Id.Bytes, Entries[EntryIndex].AssetId, sizeof(Id.Bytes));
+        const auto [It, bAdded] = PositionById.try_emplace(Id, Selected.size());
+        if (bAdded)
+        {
+          Selected.emplace_back(SourceIndex, EntryIndex);
+        }
+        else
+        {
+          Selected[It->second] = {SourceIndex, EntryIndex};
+          ++Result.ReplacedAssetCount;
+        }
+      }
+    }
+
+    auto Plan = m_Impl->PlanCopy(Sources, Selected);
+    if (!Plan)
+    {
+      return std::unexpected(Plan.error());
+    }
+
+    auto WriteResult = Impl::WriteCopy(Sources, *Plan, OutputPath);
+    if (!WriteResult)
+    {
+      return std::unexpected(WriteResult.error());
+    }
+
+    Result.AssetCount = static_cast<uint32_t>(Selected.size());
+    Result.ChunkCount = static_cast<uint32_t>(Plan->Chunks.size());
+    Result.FileSize = Plan->Header.FileSize;
+    return Result;
+  }
+
 } // namespace SnAPI::AssetPipeline
@@ -3,7 +3,14 @@
 #include <lz4.h>
 #include <lz4hc.h>
 #include <zstd.h>
+#include <zdict.h>
+#include <xxhash.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 namespace SnAPI::AssetPipeline::Pack
@@ -196,18 +203,32 @@ namespace SnAPI::AssetPipeline::Pack
     return Compress(Data, Size, Mode, ESnPakCompressionLevel::Max);
   }
 
-  std::vector<uint8_t> Decompress(const uint8_t* Data, const size_t CompressedSize, const size_t UncompressedSize, ESnPakCompression Mode)
+  void Decompress(const uint8_t* Data, const size_t CompressedSize, const std::span<uint8_t> Output, const ESnPakCompression Mode)
+  {
+    Decompress(Data, CompressedSize, Output, Mode, nullptr);
+  }
+
+  void Decompress(const uint8_t* Data, const size_t CompressedSize, const std::span<uint8_t> Output, ESnPakCompression Mode,
+                  const ZstdDictionarySet* Dictionaries)
   {
+    const size_t UncompressedSize = Output.size();
+
     if (Mode == ESnPakCompression::None)
     {
-      return {Data, Data + UncompressedSize};
+      if (CompressedSize != UncompressedSize)
+      {
+        throw std::runtime_error("Uncompressed data size mismatch");
+      }
+      if (UncompressedSize > 0)
+      {
+        std::memcpy(Output.data(), Data, UncompressedSize);
+      }
+      return;
     }
 
-    std::vector<uint8_t> Result(UncompressedSize);
-
     if (Mode == ESnPakCompression::LZ4 || Mode == ESnPakCompression::LZ4HC)
     {
-      const int DecompressedSize = LZ4_decompress_safe(reinterpret_cast<const char*>(Data), reinterpret_cast<char*>(Result.data()),
+      const int DecompressedSize = LZ4_decompress_safe(reinterpret_cast<const char*>(Data), reinterpret_cast<char*>(Output.data()),
                                                        static_cast<int>(CompressedSize), static_cast<int>(UncompressedSize));
 
       if (DecompressedSize < 0 || static_cast<size_t>(DecompressedSize) != UncompressedSize)
@@ -218,9 +239,23 @@ namespace SnAPI::AssetPipeline::Pack
     else if (Mode == ESnPakCompression::Zstd || Mode == ESnPakCompression::ZstdFast)
     {
       auto& Context = GetZstdContext();
-      const size_t DecompressedSize = Context.DecompressCtx
-                                      ? ZSTD_decompressDCtx(Context.DecompressCtx, Result.data(), Result.size(), Data, CompressedSize)
-                                      : ZSTD_decompress(Result.data(), Result.size(), Data, CompressedSize);
+      const ZSTD_DDict* Dictionary = nullptr;
+      if (const unsigned DictionaryId = ZSTD_getDictID_fromFrame(Data, CompressedSize); DictionaryId != 0)
+      {
+        Dictionary = Dictionaries != nullptr ? Dictionaries->Find(DictionaryId) : nullptr;
+        if (Dictionary == nullptr)
+        {
+          throw std::runtime_error("Zstd frame references missing dictionary " + std::to_string(DictionaryId));
+        }
+        if (Context.DecompressCtx == nullptr)
+        {
+          throw std::runtime_error("Zstd decompression context unavailable");
+        }
+      }
+      const size_t DecompressedSize =
+          Dictionary != nullptr ? ZSTD_decompress_usingDDict(Context.DecompressCtx, Output.data(), Output.size(), Data, CompressedSize, Dictionary)
+          : Context.DecompressCtx ? ZSTD_decompressDCtx(Context.DecompressCtx, Output.data(), Output.size(), Data, CompressedSize)
+                                  : ZSTD_decompress(Output.data(), Output.size(), Data, CompressedSize);
 
       if (ZSTD_isError(DecompressedSize))
       {
@@ -236,8 +271,512 @@ namespace SnAPI::AssetPipeline::Pack
     {
       throw std::runtime_error("Unknown compression mode");
     }
+  }
+
+  std::vector<uint8_t> Decompress(const uint8_t* Data, const size_t CompressedSize, const size_t UncompressedSize, ESnPakCompression Mode)
+  {
+    if (Mode == ESnPakCompression::None)
+    {
+      return {Data, Data + UncompressedSize};
+    }
+
+    std::vector<uint8_t> Result(UncompressedSize);
+    Decompress(Data, CompressedSize, std::span<uint8_t>(Result), Mode);
+    return Result;
+  }
+
+  namespace
+  {
+    // Records are transposed in blocks so both sides of the copy stay in cache
+    constexpr size_t kTransposeBlockRecords = 256;
+
+    size_t GetIndexArraysSize(const std::span<const IndexArrayLayout> Layout)
+    {
+      size_t Size = 0;
+      for (const IndexArrayLayout& Array : Layout)
+      {
+        Size += Array.RecordSize * Array.RecordCount;
+      }
+      return Size;
+    }
+
+    // Rows -> columns: Out[k * Count + i] = In[i * RecordSize + k]
+    void TransposeToColumns(const uint8_t* In, uint8_t* Out, const size_t RecordSize, const size_t Count)
+    {
+      for (size_t First = 0; First < Count; First += kTransposeBlockRecords)
+      {
+        const size_t Last = std::min(Count, First + kTransposeBlockRecords);
+        for (size_t k = 0; k < RecordSize; ++k)
+        {
+          uint8_t* Column = Out + k * Count;
+          for (size_t i = First; i < Last; ++i)
+          {
+            Column[i] = In[i * RecordSize + k];
+          }
+        }
+      }
+    }
+
+    // Columns -> rows: Out[i * RecordSize + k] = In[k * Count + i]
+    void TransposeToRows(const uint8_t* In, uint8_t* Out, const size_t RecordSize, const size_t Count)
+    {
+      for (size_t First = 0; First < Count; First += kTransposeBlockRecords)
+      {
+        const size_t Last = std::min(Count, First + kTransposeBlockRecords);
+        for (size_t k = 0; k < RecordSize; ++k)
+        {
+          const uint8_t* Column = In + k * Count;
+          for (size_t i = First; i < Last; ++i)
+          {
+            Out[i * RecordSize + k] = Column[i];
+          }
+        }
+      }
+    }
+  } // namespace
+
+  std::vector<uint8_t> EncodeIndexArrays(const std::span<const uint8_t> Arrays, const std::span<const IndexArrayLayout> Layout)
+  {
+    if (Layout.size() != 4 || GetIndexArraysSize(Layout) != Arrays.size())
+    {
+      throw std::runtime_error("Index array layout does not match the array data");
+    }
+
+    SnPakIndexBlockTableHeaderV1 TableHeader{};
+    size_t BlockCount = 0;
+    for (size_t Array = 0; Array < Layout.size(); ++Array)
+    {
+      const size_t RecordsPerBlock = std::max<size_t>(1, kIndexBlockSize / Layout[Array].RecordSize);
+      TableHeader.RecordsPerBlock[Array] = static_cast<uint32_t>(RecordsPerBlock);
+      BlockCount += (Layout[Array].RecordCount + RecordsPerBlock - 1) / RecordsPerBlock;
+    }
+
+    const size_t TableSize = sizeof(TableHeader) + BlockCount * sizeof(SnPakIndexBlockEntryV1);
+    std::vector<uint8_t> Result(TableSize);
+
+    std::vector<uint8_t> Columns;
+    size_t ArrayOffset = 0;
+    size_t BlockIndex = 0;
+    for (size_t Array = 0; Array < Layout.size(); ++Array)
+    {
+      const size_t RecordSize = Layout[Array].RecordSize;
+      const size_t RecordCount = Layout[Array].RecordCount;
+      for (size_t First = 0; First < RecordCount; First += TableHeader.RecordsPerBlock[Array], ++BlockIndex)
+      {
+        const size_t Count = std::min<size_t>(TableHeader.RecordsPerBlock[Array], RecordCount - First);
+        const uint8_t* Records = Arrays.data() + ArrayOffset + First * RecordSize;
+        Columns.resize(Count * RecordSize);
+        TransposeToColumns(Records, Columns.data(), RecordSize, Count);
+        const std::vector<uint8_t> Compressed = Compress(Columns.data(), Columns.size(), ESnPakCompression::Zstd, ESnPakCompressionLevel::High);
+        Result.insert(Result.end(), Compressed.begin(), Compressed.end());
+
+        const SnPakIndexBlockEntryV1 Entry{Result.size() - TableSize, XXH3_64bits(Records, Count * RecordSize)};
+        std::memcpy(Result.data() + sizeof(TableHeader) + BlockIndex * sizeof(Entry), &Entry, sizeof(Entry));
+      }
+      ArrayOffset += RecordSize * RecordCount;
+    }
+
+    std::memcpy(Result.data(), &TableHeader, sizeof(TableHeader));
+    constexpr size_t HashedFrom = offsetof(SnPakIndexBlockTableHeaderV1, RecordsPerBlock);
+    TableHeader.TableHash = XXH3_64bits(Result.data() + HashedFrom, TableSize - HashedFrom);
+    std::memcpy(Result.data(), &TableHeader, sizeof(TableHeader));
+    return Result;
+  }
+
+  IndexBlockTable::IndexBlockTable(const std::span<const uint8_t> Encoded, const std::span<const IndexArrayLayout> Layout)
+  {
+    SnPakIndexBlockTableHeaderV1 TableHeader{};
+    if (Layout.size() != m_Layout.size() || Encoded.size() < sizeof(TableHeader))
+    {
+      throw std::runtime_error("Compressed index block table is truncated");
+    }
+    std::memcpy(&TableHeader, Encoded.data(), sizeof(TableHeader));
+
+    uint64_t BlockCount = 0;
+    for (size_t Array = 0; Array < Layout.size(); ++Array)
+    {
+      const uint64_t RecordsPerBlock = TableHeader.RecordsPerBlock[Array];
+      if (RecordsPerBlock == 0 || RecordsPerBlock * Layout[Array].RecordSize > kMaxIndexBlockSize)
+      {
+        throw std::runtime_error("Compressed index block size is invalid");
+      }
+      m_Layout[Array] = Layout[Array];
+      m_RecordsPerBlock[Array] = static_cast<size_t>(RecordsPerBlock);
+      m_BlockCount[Array] = static_cast<size_t>((Layout[Array].RecordCount + RecordsPerBlock - 1) / RecordsPerBlock);
+      m_FirstBlock[Array] = static_cast<size_t>(BlockCount);
+      BlockCount += m_BlockCount[Array];
+    }
+
+    // Every block holds at least one compressed byte, so counts the stored data cannot back are
+    // rejected here rather than when a block is decoded
+    const uint64_t Available = Encoded.size() - sizeof(TableHeader);
+    if (BlockCount > Available / (sizeof(SnPakIndexBlockEntryV1) + 1))
+    {
+      throw std::runtime_error("Compressed index size does not match entry counts");
+    }
+    const size_t TableSize = sizeof(TableHeader) + static_cast<size_t>(BlockCount) * sizeof(SnPakIndexBlockEntryV1);
+    constexpr size_t HashedFrom = offsetof(SnPakIndexBlockTableHeaderV1, RecordsPerBlock);
+    if (XXH3_64bits(Encoded.data() + HashedFrom, TableSize - HashedFrom) != TableHeader.TableHash)
+    {
+      throw std::runtime_error("Compressed index block table hash mismatch - data corrupted");
+    }
+    m_Entries = Encoded.data() + sizeof(TableHeader);
+    m_Blocks = Encoded.subspan(TableSize);
+
+    uint64_t PreviousEnd = 0;
+    for (uint64_t Block = 0; Block < BlockCount; ++Block)
+    {
+      SnPakIndexBlockEntryV1 Entry{};
+      std::memcpy(&Entry, m_Entries + Block * sizeof(Entry), sizeof(Entry));
+      if (Entry.DataEnd <= PreviousEnd || Entry.DataEnd > m_Blocks.size())
+      {
+        throw std::runtime_error("Compressed index block table entry is out of bounds");
+      }
+      PreviousEnd = Entry.DataEnd;
+    }
+    if (PreviousEnd != m_Blocks.size())
+    {
+      throw std::runtime_error("Compressed index size does not match entry counts");
+    }
+  }
+
+  size_t IndexBlockTable::GetBlockSize(const size_t Array, const size_t Block) const
+  {
+    const size_t First = Block * m_RecordsPerBlock[Array];
+    return std::min(m_RecordsPerBlock[Array], m_Layout[Array].RecordCount - First) * m_Layout[Array].RecordSize;
+  }
+
+  void IndexBlockTable::DecodeBlock(const size_t Array, const size_t Block, const std::span<uint8_t> Records) const
+  {
+    if (Array >= m_Layout.size() || Block >= m_BlockCount[Array] || Records.size() != GetBlockSize(Array, Block))
+    {
+      throw std::runtime_error("Compressed index block request is out of range");
+    }
+
+    const size_t BlockIndex = m_FirstBlock[Array] + Block;
+    SnPakIndexBlockEntryV1 Entry{};
+    std::memcpy(&Entry, m_Entries + BlockIndex * sizeof(Entry), sizeof(Entry));
+    uint64_t DataBegin = 0;
+    if (BlockIndex > 0)
+    {
+      std::memcpy(&DataBegin, m_Entries + (BlockIndex - 1) * sizeof(Entry), sizeof(DataBegin));
+    }
+
+    // Bounds were validated when the table was built. Column scratch is reused per thread.
+    thread_local std::vector<uint8_t> Columns;
+    Columns.resize(Records.size());
+    Decompress(m_Blocks.data() + DataBegin, static_cast<size_t>(Entry.DataEnd - DataBegin), std::span<uint8_t>(Columns),
+               ESnPakCompression::Zstd);
+    const size_t RecordSize = m_Layout[Array].RecordSize;
+    TransposeToRows(Columns.data(), Records.data(), RecordSize, Records.size() / RecordSize);
+    if (XXH3_64bits(Records.data(), Records.size()) != Entry.Hash)
+    {
+      throw std::runtime_error("Compressed index block hash mismatch - data corrupted");
+    }
+  }
+
+  std::vector<uint8_t> DecodeIndexArrays(const std::span<const uint8_t> Encoded, const std::span<const IndexArrayLayout> Layout)
+  {
+    const IndexBlockTable Table(Encoded, Layout);
+    std::vector<uint8_t> Arrays;
+    for (size_t Array = 0; Array < Layout.size(); ++Array)
+    {
+      for (size_t Block = 0; Block < Table.GetBlockCount(Array); ++Block)
+      {
+        const size_t Offset = Arrays.size();
+        Arrays.resize(Offset + Table.GetBlockSize(Array, Block));
+        Table.DecodeBlock(Array, Block, std::span<uint8_t>(Arrays).subspan(Offset));
+      }
+    }
+    return Arrays;
+  }
+
+  std::vector<uint8_t> CompressFrames(const uint8_t* Data, const size_t Size, const uint32_t FrameSize, const ESnPakCompression Mode,
+                                      const ESnPakCompressionLevel Level)
+  {
+    if (FrameSize == 0)
+    {
+      throw std::invalid_argument("Frame size must be non-zero");
+    }
+    const uint64_t FrameCount = (static_cast<uint64_t>(Size) + FrameSize - 1) / FrameSize;
+    if (FrameCount > UINT32_MAX)
+    {
+      throw std::runtime_error("Too many frames for one chunk");
+    }
 
+    const size_t TableSize = sizeof(SnPakFrameTableHeaderV1) + static_cast<size_t>(FrameCount) * sizeof(SnPakFrameEntryV1);
+    std::vector<uint8_t> Result(TableSize);
+    const SnPakFrameTableHeaderV1 TableHeader{static_cast<uint32_t>(FrameCount), FrameSize};
+    std::memcpy(Result.data(), &TableHeader, sizeof(TableHeader));
+
+    uint64_t DataEnd = 0;
+    for (uint32_t FrameIndex = 0; FrameIndex < FrameCount; ++FrameIndex)
+    {
+      const size_t Begin = static_cast<size_t>(FrameIndex) * FrameSize;
+      const size_t Length = std::min<size_t>(FrameSize, Size - Begin);
+      const auto Frame = Compress(Data + Begin, Length, Mode, Level);
+      Result.insert(Result.end(), Frame.begin(), Frame.end());
+      DataEnd += Frame.size();
+
+      const SnPakFrameEntryV1 Entry{DataEnd, XXH3_64bits(Data + Begin, Length)};
+      std::memcpy(Result.data() + sizeof(TableHeader) + FrameIndex * sizeof(Entry), &Entry, sizeof(Entry));
+    }
+    return Result;
+  }
+
+  void DecompressFrameRange(const uint8_t* Data, const size_t StoredSize, const uint64_t UncompressedSize, const uint64_t Offset,
+                            const std::span<uint8_t> Output, const ESnPakCompression Mode, const bool bVerifyFrames)
+  {
+    SnPakFrameTableHeaderV1 TableHeader{};
+    if (StoredSize < sizeof(TableHeader))
+    {
+      throw std::runtime_error("Frame table is truncated");
+    }
+    std::memcpy(&TableHeader, Data, sizeof(TableHeader));
+
+    const uint64_t FrameSize = TableHeader.FrameSize;
+    if (FrameSize == 0 || TableHeader.FrameCount != (UncompressedSize + FrameSize - 1) / FrameSize)
+    {
+      throw std::runtime_error("Frame table does not match the chunk size");
+    }
+    const uint64_t TableSize = sizeof(TableHeader) + static_cast<uint64_t>(TableHeader.FrameCount) * sizeof(SnPakFrameEntryV1);
+    if (TableSize > StoredSize)
+    {
+      throw std::runtime_error("Frame table is truncated");
+    }
+    if (Offset > UncompressedSize || Output.size() > UncompressedSize - Offset)
+    {
+      throw std::runtime_error("Frame range exceeds the chunk size");
+    }
+    if (Output.empty())
+    {
+      return;
+    }
+
+    const uint8_t* Frames = Data + TableSize;
+    const uint64_t FramesSize = StoredSize - TableSize;
+    auto ReadEntry = [Data](const uint64_t FrameIndex) {
+      SnPakFrameEntryV1 Entry{};
+      std::memcpy(&Entry, Data + sizeof(SnPakFrameTableHeaderV1) + FrameIndex * sizeof(Entry), sizeof(Entry));
+      return Entry;
+    };
+
+    const uint64_t RangeEnd = Offset + Output.size();
+    const uint64_t FirstFrame = Offset / FrameSize;
+    const uint64_t LastFrame = (RangeEnd - 1) / FrameSize;
+    uint64_t FrameBegin = FirstFrame == 0 ? 0 : ReadEntry(FirstFrame - 1).DataEnd;
+    std::vector<uint8_t> Scratch;
+
+    for (uint64_t FrameIndex = FirstFrame; FrameIndex <= LastFrame; ++FrameIndex)
+    {
+      const SnPakFrameEntryV1 Entry = ReadEntry(FrameIndex);
+      if (Entry.DataEnd < FrameBegin || Entry.DataEnd > FramesSize)
+      {
+        throw std::runtime_error("Frame table entry is out of bounds");
+      }
+
+      const uint64_t FrameStart = FrameIndex * FrameSize;
+      const uint64_t FrameLength = std::min(FrameSize, UncompressedSize - FrameStart);
+      const uint64_t CopyBegin = std::max(Offset, FrameStart);
+      const uint64_t CopyEnd = std::min(RangeEnd, FrameStart + FrameLength);
+
+      // Whole frames decode straight into Output; frames cut by the range go through Scratch
+      const bool bPartial = CopyBegin != FrameStart || CopyEnd != FrameStart + FrameLength;
+      std::span<uint8_t> Target;
+      if (bPartial)
+      {
+        Scratch.resize(static_cast<size_t>(FrameLength));
+        Target = Scratch;
+      }
+      else
+      {
+        Target = Output.subspan(static_cast<size_t>(FrameStart - Offset), static_cast<size_t>(FrameLength));
+      }
+
+      Decompress(Frames + FrameBegin, static_cast<size_t>(Entry.DataEnd - FrameBegin), Target, Mode);
+      if (bVerifyFrames && XXH3_64bits(Target.data(), Target.size()) != Entry.Hash)
+      {
+        throw std::runtime_error("Frame hash mismatch - data corrupted");
+      }
+      if (bPartial)
+      {
+        std::memcpy(Output.data() + (CopyBegin - Offset), Scratch.data() + (CopyBegin - FrameStart), static_cast<size_t>(CopyEnd - CopyBegin));
+      }
+      FrameBegin = Entry.DataEnd;
+    }
+  }
+
+  std::vector<uint8_t> TrainZstdDictionary(const std::vector<std::span<const uint8_t>>& Samples, const size_t Capacity)
+  {
+    std::vector<uint8_t> Concatenated;
+    std::vector<size_t> SampleSizes;
+    SampleSizes.reserve(Samples.size());
+    for (const auto& Sample : Samples)
+    {
+      Concatenated.insert(Concatenated.end(), Sample.begin(), Sample.end());
+      SampleSizes.push_back(Sample.size());
+    }
+    if (SampleSizes.empty() || Capacity == 0)
+    {
+      return {};
+    }
+
+    std::vector<uint8_t> Dictionary(Capacity);
+    const size_t Size = ZDICT_trainFromBuffer(Dictionary.data(), Dictionary.size(), Concatenated.data(), SampleSizes.data(),
+                                              static_cast<unsigned>(SampleSizes.size()));
+    if (ZDICT_isError(Size))
+    {
+      return {};
+    }
+    Dictionary.resize(Size);
+    return Dictionary;
+  }
+
+  uint32_t GetZstdDictionaryId(const std::span<const uint8_t> Bytes)
+  {
+    return ZSTD_getDictID_fromDict(Bytes.data(), Bytes.size());
+  }
+
+  std::vector<DictionaryBlockEntry> ParseDictionaryBlock(const std::span<const uint8_t> Block)
+  {
+    SnPakDictionaryHeaderV1 Header{};
+    if (Block.size() < sizeof(Header))
+    {
+      throw std::runtime_error("Dictionary block size too small for header");
+    }
+    std::memcpy(&Header, Block.data(), sizeof(Header));
+    if (std::memcmp(Header.Magic, kDictionaryMagic, 4) != 0)
+    {
+      throw std::runtime_error("Invalid dictionary block magic");
+    }
+    if (Header.Version != 1)
+    {
+      throw std::runtime_error("Unsupported dictionary block version: " + std::to_string(Header.Version));
+    }
+    if (Header.BlockSize != Block.size())
+    {
+      throw std::runtime_error("Dictionary BlockSize mismatch with header");
+    }
+    if (Header.DictionaryCount > (Block.size() - sizeof(Header)) / sizeof(SnPakDictionaryEntryV1))
+    {
+      throw std::runtime_error("Dictionary block too small for its entries");
+    }
+    const XXH128_hash_t Hash = XXH3_128bits(Block.data() + sizeof(Header), Block.size() - sizeof(Header));
+    if (Hash.high64 != Header.HashHi || Hash.low64 != Header.HashLo)
+    {
+      throw std::runtime_error("Dictionary block hash mismatch - data corrupted");
+    }
+
+    std::vector<DictionaryBlockEntry> Result(Header.DictionaryCount);
+    for (uint32_t Index = 0; Index < Header.DictionaryCount; ++Index)
+    {
+      auto& [Entry, Data] = Result[Index];
+      std::memcpy(&Entry, Block.data() + sizeof(Header) + static_cast<size_t>(Index) * sizeof(Entry), sizeof(Entry));
+      if (Entry.DataSize > Block.size() || Entry.DataOffset > Block.size() - Entry.DataSize)
+      {
+        throw std::runtime_error("Dictionary " + std::to_string(Index) + " exceeds dictionary block");
+      }
+      Data = Block.subspan(static_cast<size_t>(Entry.DataOffset), static_cast<size_t>(Entry.DataSize));
+      if (GetZstdDictionaryId(Data) != Entry.DictionaryId)
+      {
+        throw std::runtime_error("Dictionary " + std::to_string(Index) + " id mismatch");
+      }
+    }
     return Result;
   }
 
+  struct ZstdEncoderDictionary::Prepared
+  {
+      std::mutex Mutex;
+      std::unordered_map<int, ZSTD_CDict*> ByLevel;
+
+      ~Prepared()
+      {
+        for (const auto& [Level, CDict] : ByLevel)
+        {
+          ZSTD_freeCDict(CDict);
+        }
+      }
+  };
+
+  ZstdEncoderDictionary::ZstdEncoderDictionary(std::vector<uint8_t> Bytes)
+      : m_Bytes(std::move(Bytes))
+      , m_Id(GetZstdDictionaryId(m_Bytes))
+      , m_Prepared(std::make_unique<Prepared>())
+  {
+  }
+
+  ZstdEncoderDictionary::~ZstdEncoderDictionary() = default;
+
+  std::vector<uint8_t> ZstdEncoderDictionary::Compress(const uint8_t* Data, const size_t Size, const ESnPakCompression Mode,
+                                                       const ESnPakCompressionLevel Level) const
+  {
+    if (Mode != ESnPakCompression::Zstd && Mode != ESnPakCompression::ZstdFast)
+    {
+      throw std::invalid_argument("Dictionary compression requires a Zstd mode");
+    }
+
+    const int LevelValue = ZstdLevelForMode(Mode, Level);
+    const ZSTD_CDict* CDict = nullptr;
+    {
+      std::lock_guard Lock(m_Prepared->Mutex);
+      ZSTD_CDict*& Slot = m_Prepared->ByLevel[LevelValue];
+      if (Slot == nullptr)
+      {
+        Slot = ZSTD_createCDict(m_Bytes.data(), m_Bytes.size(), LevelValue);
+      }
+      CDict = Slot;
+    }
+    auto& Context = GetZstdContext();
+    if (CDict == nullptr || Context.CompressCtx == nullptr)
+    {
+      throw std::runtime_error("Failed to prepare Zstd dictionary for compression");
+    }
+
+    std::vector<uint8_t> Result(ZSTD_compressBound(Size));
+    const size_t CompressedSize = ZSTD_compress_usingCDict(Context.CompressCtx, Result.data(), Result.size(), Data, Size, CDict);
+    if (ZSTD_isError(CompressedSize))
+    {
+      throw std::runtime_error(std::string("Zstd dictionary compression failed: ") + ZSTD_getErrorName(CompressedSize));
+    }
+    Result.resize(CompressedSize);
+    return Result;
+  }
+
+  ZstdDictionarySet::~ZstdDictionarySet()
+  {
+    Clear();
+  }
+
+  bool ZstdDictionarySet::Add(const std::span<const uint8_t> Bytes)
+  {
+    const uint32_t Id = GetZstdDictionaryId(Bytes);
+    if (Id == 0 || m_Dictionaries.contains(Id))
+    {
+      return false;
+    }
+    ZSTD_DDict* DDict = ZSTD_createDDict(Bytes.data(), Bytes.size());
+    if (DDict == nullptr)
+    {
+      return false;
+    }
+    m_Dictionaries.emplace(Id, DDict);
+    return true;
+  }
+
+  const ZSTD_DDict_s* ZstdDictionarySet::Find(const uint32_t DictionaryId) const
+  {
+    const auto It = m_Dictionaries.find(DictionaryId);
+    return It == m_Dictionaries.end() ? nullptr : It->second;
+  }
+
+  void ZstdDictionarySet::Clear()
+  {
+    for (const auto& [Id, DDict] : m_Dictionaries)
+    {
+      ZSTD_freeDDict(DDict);
+    }
+    m_Dictionaries.clear();
+  }
+
 } // namespace SnAPI::AssetPipeline::Pack
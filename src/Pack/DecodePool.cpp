@@ -0,0 +1,141 @@
+#include "DecodePool.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace SnAPI::AssetPipeline::Pack
+{
+
+  struct DecodePool::Job
+  {
+      const std::function<void(size_t)>* Body = nullptr;
+      size_t Count = 0;
+      std::atomic<size_t> Next{0};
+      uint32_t HelperSlots = 0; // helpers that may still join, guarded by the pool mutex
+
+      std::mutex Mutex;
+      std::condition_variable AllDone;
+      size_t Completed = 0;
+
+      // Claim and run items until none are left. Body is only dereferenced for claimed items,
+      // so a helper that picks the job up after the caller returned touches nothing stale.
+      void Run()
+      {
+        size_t Ran = 0;
+        for (size_t Index = Next.fetch_add(1); Index < Count; Index = Next.fetch_add(1))
+        {
+          (*Body)(Index);
+          ++Ran;
+        }
+        if (Ran == 0)
+        {
+          return;
+        }
+        std::lock_guard Lock(Mutex);
+        Completed += Ran;
+        if (Completed == Count)
+        {
+          AllDone.notify_all();
+        }
+      }
+  };
+
+  DecodePool& DecodePool::Get()
+  {
+    static DecodePool Pool;
+    return Pool;
+  }
+
+  DecodePool::DecodePool()
+  {
+    const uint32_t HardwareThreads = std::max(2u, std::thread::hardware_concurrency());
+    m_Threads.reserve(HardwareThreads - 1);
+    for (uint32_t ThreadIndex = 1; ThreadIndex < HardwareThreads; ++ThreadIndex)
+    {
+      m_Threads.emplace_back([this] { HelperLoop(); });
+    }
+  }
+
+  DecodePool::~DecodePool()
+  {
+    {
+      std::lock_guard Lock(m_Mutex);
+      m_bStopping = true;
+    }
+    m_WorkReady.notify_all();
+    for (auto& Thread : m_Threads)
+    {
+      Thread.join();
+    }
+  }
+
+  uint32_t DecodePool::GetThreadCount() const
+  {
+    return static_cast<uint32_t>(m_Threads.size());
+  }
+
+  void DecodePool::HelperLoop()
+  {
+    while (true)
+    {
+      std::shared_ptr<Job> Current;
+      {
+        std::unique_lock Lock(m_Mutex);
+        m_WorkReady.wait(Lock, [this] { return m_bStopping || !m_Queue.empty(); });
+        if (m_bStopping)
+        {
+          return;
+        }
+        Current = m_Queue.front();
+        if (--Current->HelperSlots == 0)
+        {
+          m_Queue.pop_front();
+        }
+      }
+      Current->Run();
+    }
+  }
+
+  void DecodePool::ParallelFor(const size_t Count, const uint32_t MaxParallelism, const std::function<void(size_t)>& Body)
+  {
+    if (Count == 0)
+    {
+      return;
+    }
+
+    const auto Helpers = static_cast<uint32_t>(std::min<size_t>({Count - 1, MaxParallelism > 0 ? MaxParallelism - 1 : 0, m_Threads.size()}));
+    if (Helpers == 0)
+    {
+      for (size_t Index = 0; Index < Count; ++Index)
+      {
+        Body(Index);
+      }
+      return;
+    }
+
+    auto Work = std::make_shared<Job>();
+    Work->Body = &Body;
+    Work->Count = Count;
+    Work->HelperSlots = Helpers;
+    {
+      std::lock_guard Lock(m_Mutex);
+      m_Queue.push_back(Work);
+    }
+    for (uint32_t Helper = 0; Helper < Helpers; ++Helper)
+    {
+      m_WorkReady.notify_one();
+    }
+
+    Work->Run();
+
+    {
+      std::unique_lock Lock(Work->Mutex);
+      Work->AllDone.wait(Lock, [&Work] { return Work->Completed == Work->Count; });
+    }
+
+    // Drop the job if not every helper slot was taken
+    std::lock_guard Lock(m_Mutex);
+    std::erase(m_Queue, Work);
+  }
+
+} // namespace SnAPI::AssetPipeline::Pack
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SnAPI::AssetPipeline::Pack
+{
+
+  // Process-wide helper threads for splitting one decode (e.g. the frames of a large chunk) across
+  // cores. The pool is created on first use with one thread per hardware thread minus one.
+  class DecodePool
+  {
+  public:
+      static DecodePool& Get();
+
+      ~DecodePool();
+
+      // Number of helper threads (the caller of ParallelFor always works as well)
+      uint32_t GetThreadCount() const;
+
+      // Run Body(I) for every I in [0, Count) on the calling thread plus up to MaxParallelism - 1
+      // helpers, and return once all calls finished. The calling thread claims work too, so the
+      // call makes progress even when every helper is busy with other callers. Body must not throw.
+      void ParallelFor(size_t Count, uint32_t MaxParallelism, const std::function<void(size_t)>& Body);
+
+      DecodePool(const DecodePool&) = delete;
+      DecodePool& operator=(const DecodePool&) = delete;
+
+  private:
+      DecodePool();
+
+      struct Job;
+      void HelperLoop();
+
+      std::mutex m_Mutex;
+      std::condition_variable m_WorkReady;
+      std::deque<std::shared_ptr<Job>> m_Queue;
+      std::vector<std::thread> m_Threads;
+      bool m_bStopping = false;
+  };
+
+} // namespace SnAPI::AssetPipeline::Pack
@@ -0,0 +1,114 @@
+#include "DirectFile.h"
+
+#include <cerrno>
+#include <cstring>
+
+#ifdef _WIN32
+#  define WIN32_LEAN_AND_MEAN
+#  define NOMINMAX
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
+namespace SnAPI::AssetPipeline::Pack
+{
+
+  std::expected<std::unique_ptr<DirectFile>, std::string> DirectFile::Open(const std::string& Path)
+  {
+    std::unique_ptr<DirectFile> File(new DirectFile());
+
+#ifdef _WIN32
+    HANDLE Handle = CreateFileA(Path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL | FILE_FLAG_NO_BUFFERING, nullptr);
+    if (Handle == INVALID_HANDLE_VALUE)
+    {
+      return std::unexpected("Failed to open file for unbuffered reads: " + Path);
+    }
+    File->m_Handle = Handle;
+#else
+    int Flags = O_RDONLY | O_CLOEXEC;
+#  ifdef O_DIRECT
+    Flags |= O_DIRECT;
+#  endif
+    File->m_Fd = open(Path.c_str(), Flags);
+    if (File->m_Fd < 0)
+    {
+      return std::unexpected("Failed to open file for direct reads: " + Path + " (" + std::strerror(errno) + ")");
+    }
+#  if defined(__APPLE__)
+    if (fcntl(File->m_Fd, F_NOCACHE, 1) != 0)
+    {
+      return std::unexpected("Failed to disable caching for: " + Path);
+    }
+#  elif !defined(O_DIRECT)
+    return std::unexpected("Direct reads are not supported on this platform");
+#  endif
+#endif
+
+    return File;
+  }
+
+  DirectFile::~DirectFile()
+  {
+#ifdef _WIN32
+    if (m_Handle != nullptr)
+    {
+      CloseHandle(static_cast<HANDLE>(m_Handle));
+    }
+#else
+    if (m_Fd >= 0)
+    {
+      close(m_Fd);
+    }
+#endif
+  }
+
+  std::expected<size_t, std::string> DirectFile::Read(const uint64_t Offset, std::span<uint8_t> Buffer) const
+  {
+    size_t Total = 0;
+    while (Total < Buffer.size())
+    {
+#ifdef _WIN32
+      OVERLAPPED Overlapped{};
+      const uint64_t ReadOffset = Offset + Total;
+      Overlapped.Offset = static_cast<DWORD>(ReadOffset & 0xFFFFFFFFull);
+      Overlapped.OffsetHigh = static_cast<DWORD>(ReadOffset >> 32);
+      const size_t Remaining = Buffer.size() - Total;
+      const DWORD Request = static_cast<DWORD>(Remaining > 0x40000000ull ? 0x40000000ull : Remaining);
+      DWORD BytesRead = 0;
+      if (!ReadFile(static_cast<HANDLE>(m_Handle), Buffer.data() + Total, Request, &BytesRead, &Overlapped))
+      {
+        if (GetLastError() == ERROR_HANDLE_EOF)
+        {
+          break;
+        }
+        return std::unexpected("Unbuffered read failed at offset " + std::to_string(ReadOffset));
+      }
+#else
+      const ssize_t BytesRead = pread(m_Fd, Buffer.data() + Total, Buffer.size() - Total, static_cast<off_t>(Offset + Total));
+      if (BytesRead < 0)
+      {
+        if (errno == EINTR)
+        {
+          continue;
+        }
+        return std::unexpected("Direct read failed at offset " + std::to_string(Offset + Total) + ": " + std::strerror(errno));
+      }
+#endif
+      if (BytesRead == 0)
+      {
+        break;
+      }
+      Total += static_cast<size_t>(BytesRead);
+      if (static_cast<size_t>(BytesRead) % kBlockSize != 0)
+      {
+        // Only the read that reaches the end of the file can end off a block boundary
+        break;
+      }
+    }
+    return Total;
+  }
+
+} // namespace SnAPI::AssetPipeline::Pack
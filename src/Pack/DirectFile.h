@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <new>
+#include <span>
+#include <string>
+
+namespace SnAPI::AssetPipeline::Pack
+{
+
+  // Read-only file opened for unbuffered positional reads that bypass the OS page cache
+  // (O_DIRECT on Linux, F_NOCACHE on macOS, FILE_FLAG_NO_BUFFERING on Windows).
+  // Offsets, sizes and buffer addresses passed to Read must be multiples of kBlockSize.
+  // Reads do not share a file position, so one DirectFile may be read from several threads.
+  class DirectFile
+  {
+  public:
+      static constexpr size_t kBlockSize = 4096;
+
+      // Fails when the file cannot be opened or the platform/filesystem refuses unbuffered I/O
+      static std::expected<std::unique_ptr<DirectFile>, std::string> Open(const std::string& Path);
+
+      ~DirectFile();
+
+      // Read up to Buffer.size() bytes at Offset; returns the number of bytes read, which is
+      // short only at the end of the file
+      std::expected<size_t, std::string> Read(uint64_t Offset, std::span<uint8_t> Buffer) const;
+
+      DirectFile(const DirectFile&) = delete;
+      DirectFile& operator=(const DirectFile&) = delete;
+
+  private:
+      DirectFile() = default;
+
+#ifdef _WIN32
+      void* m_Handle = nullptr;
+#else
+      int m_Fd = -1;
+#endif
+  };
+
+  struct AlignedBlockDeleter
+  {
+      void operator()(uint8_t* Data) const
+      {
+        ::operator delete[](Data, std::align_val_t{DirectFile::kBlockSize});
+      }
+  };
+
+  // Heap memory aligned to DirectFile::kBlockSize
+  using AlignedBlockBuffer = std::unique_ptr<uint8_t[], AlignedBlockDeleter>;
+
+  inline AlignedBlockBuffer AllocateAlignedBlocks(const size_t Size)
+  {
+    return AlignedBlockBuffer(static_cast<uint8_t*>(::operator new[](Size, std::align_val_t{DirectFile::kBlockSize})));
+  }
+
+  constexpr uint64_t AlignUpToBlock(const uint64_t Value)
+  {
+    return (Value + DirectFile::kBlockSize - 1) / DirectFile::kBlockSize * DirectFile::kBlockSize;
+  }
+
+} // namespace SnAPI::AssetPipeline::Pack
@@ -0,0 +1,290 @@
+#include "IoUring.h"
+
+#if defined(SNAPI_ASSETPIPELINE_HAS_IO_URING)
+#  include <algorithm>
+#  include <atomic>
+#  include <cerrno>
+#  include <cstring>
+#  include <linux/io_uring.h>
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+namespace SnAPI::AssetPipeline::Pack
+{
+
+#if defined(SNAPI_ASSETPIPELINE_HAS_IO_URING)
+
+  struct IoUringQueue::Ring
+  {
+      int Fd = -1;
+
+      void* SqRing = nullptr;
+      size_t SqRingSize = 0;
+      void* CqRing = nullptr;
+      size_t CqRingSize = 0;
+      io_uring_sqe* Sqes = nullptr;
+      size_t SqesSize = 0;
+
+      uint32_t* SqHead = nullptr;
+      uint32_t* SqTail = nullptr;
+      uint32_t SqMask = 0;
+      uint32_t SqEntries = 0;
+      uint32_t* SqArray = nullptr;
+
+      uint32_t* CqHead = nullptr;
+      uint32_t* CqTail = nullptr;
+      uint32_t CqMask = 0;
+      io_uring_cqe* Cqes = nullptr;
+
+      uint32_t Unsubmitted = 0;
+
+      ~Ring()
+      {
+        if (Sqes != nullptr)
+        {
+          munmap(Sqes, SqesSize);
+        }
+        if (CqRing != nullptr && CqRing != SqRing)
+        {
+          munmap(CqRing, CqRingSize);
+        }
+        if (SqRing != nullptr)
+        {
+          munmap(SqRing, SqRingSize);
+        }
+        if (Fd >= 0)
+        {
+          close(Fd);
+        }
+      }
+
+      io_uring_sqe* NextSqe()
+      {
+        const uint32_t Tail = *SqTail;
+        const uint32_t Head = std::atomic_ref<uint32_t>(*SqHead).load(std::memory_order_acquire);
+        if (Tail - Head >= SqEntries)
+        {
+          return nullptr;
+        }
+        io_uring_sqe* Sqe = &Sqes[Tail & SqMask];
+        std::memset(Sqe, 0, sizeof(*Sqe));
+        return Sqe;
+      }
+
+      void Publish()
+      {
+        const uint32_t Tail = *SqTail;
+        SqArray[Tail & SqMask] = Tail & SqMask;
+        std::atomic_ref<uint32_t>(*SqTail).store(Tail + 1, std::memory_order_release);
+        ++Unsubmitted;
+      }
+
+      static int Enter(const int RingFd, const uint32_t ToSubmit, const uint32_t MinComplete, const uint32_t Flags)
+      {
+        return static_cast<int>(syscall(__NR_io_uring_enter, RingFd, ToSubmit, MinComplete, Flags, nullptr, 0));
+      }
+  };
+
+  std::expected<std::unique_ptr<IoUringQueue>, std::string> IoUringQueue::Create(const uint32_t QueueDepth)
+  {
+    io_uring_params Params{};
+    const int RingFd = static_cast<int>(syscall(__NR_io_uring_setup, QueueDepth == 0 ? 1u : QueueDepth, &Params));
+    if (RingFd < 0)
+    {
+      return std::unexpected(std::string("io_uring_setup failed: ") + std::strerror(errno));
+    }
+
+    std::unique_ptr<IoUringQueue> Queue(new IoUringQueue());
+    Queue->m_Ring = std::make_unique<Ring>();
+    Ring& R = *Queue->m_Ring;
+    R.Fd = RingFd;
+
+    R.SqRingSize = Params.sq_off.array + Params.sq_entries * sizeof(uint32_t);
+    R.CqRingSize = Params.cq_off.cqes + Params.cq_entries * sizeof(io_uring_cqe);
+    const bool bSingleMap = (Params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (bSingleMap)
+    {
+      R.SqRingSize = std::max(R.SqRingSize, R.CqRingSize);
+      R.CqRingSize = R.SqRingSize;
+    }
+
+    R.SqRing = mmap(nullptr, R.SqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingFd, IORING_OFF_SQ_RING);
+    if (R.SqRing == MAP_FAILED)
+    {
+      R.SqRing = nullptr;
+      return std::unexpected(std::string("Failed to map io_uring submission ring: ") + std::strerror(errno));
+    }
+
+    if (bSingleMap)
+    {
+      R.CqRing = R.SqRing;
+    }
+    else
+    {
+      R.CqRing = mmap(nullptr, R.CqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingFd, IORING_OFF_CQ_RING);
+      if (R.CqRing == MAP_FAILED)
+      {
+        R.CqRing = nullptr;
+        return std::unexpected(std::string("Failed to map io_uring completion ring: ") + std::strerror(errno));
+      }
+    }
+
+    R.SqesSize = Params.sq_entries * sizeof(io_uring_sqe);
+    void* Sqes = mmap(nullptr, R.SqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingFd, IORING_OFF_SQES);
+    if (Sqes == MAP_FAILED)
+    {
+      return std::unexpected(std::string("Failed to map io_uring submission entries: ") + std::strerror(errno));
+    }
+    R.Sqes = static_cast<io_uring_sqe*>(Sqes);
+
+    auto* SqBase = static_cast<uint8_t*>(R.SqRing);
+    R.SqHead = reinterpret_cast<uint32_t*>(SqBase + Params.sq_off.head);
+    R.SqTail = reinterpret_cast<uint32_t*>(SqBase + Params.sq_off.tail);
+    R.SqMask = *reinterpret_cast<uint32_t*>(SqBase + Params.sq_off.ring_mask);
+    R.SqEntries = *reinterpret_cast<uint32_t*>(SqBase + Params.sq_off.ring_entries);
+    R.SqArray = reinterpret_cast<uint32_t*>(SqBase + Params.sq_off.array);
+
+    auto* CqBase = static_cast<uint8_t*>(R.CqRing);
+    R.CqHead = reinterpret_cast<uint32_t*>(CqBase + Params.cq_off.head);
+    R.CqTail = reinterpret_cast<uint32_t*>(CqBase + Params.cq_off.tail);
+    R.CqMask = *reinterpret_cast<uint32_t*>(CqBase + Params.cq_off.ring_mask);
+    R.Cqes = reinterpret_cast<io_uring_cqe*>(CqBase + Params.cq_off.cqes);
+
+    return Queue;
+  }
+
+  IoUringQueue::~IoUringQueue() = default;
+
+  uint32_t IoUringQueue::GetQueueDepth() const
+  {
+    return m_Ring->SqEntries;
+  }
+
+  bool IoUringQueue::QueueRead(const int Fd, const uint64_t Offset, void* Buffer, const uint32_t Length, const uint64_t UserData)
+  {
+    io_uring_sqe* Sqe = m_Ring->NextSqe();
+    if (Sqe == nullptr)
+    {
+      return false;
+    }
+    Sqe->opcode = IORING_OP_READ;
+    Sqe->fd = Fd;
+    Sqe->off = Offset;
+    Sqe->addr = reinterpret_cast<uint64_t>(Buffer);
+    Sqe->len = Length;
+    Sqe->user_data = UserData;
+    m_Ring->Publish();
+    return true;
+  }
+
+  bool IoUringQueue::QueueNop(const uint64_t UserData)
+  {
+    io_uring_sqe* Sqe = m_Ring->NextSqe();
+    if (Sqe == nullptr)
+    {
+      return false;
+    }
+    Sqe->opcode = IORING_OP_NOP;
+    Sqe->user_data = UserData;
+    m_Ring->Publish();
+    return true;
+  }
+
+  std::expected<void, std::string> IoUringQueue::Submit()
+  {
+    while (m_Ring->Unsubmitted > 0)
+    {
+      const int Submitted = Ring::Enter(m_Ring->Fd, m_Ring->Unsubmitted, 0, 0);
+      if (Submitted < 0)
+      {
+        if (errno == EINTR || errno == EAGAIN || errno == EBUSY)
+        {
+          continue;
+        }
+        return std::unexpected(std::string("io_uring_enter submit failed: ") + std::strerror(errno));
+      }
+      m_Ring->Unsubmitted -= static_cast<uint32_t>(Submitted);
+    }
+    return {};
+  }
+
+  std::expected<void, std::string> IoUringQueue::WaitForCompletion()
+  {
+    while (true)
+    {
+      const uint32_t Head = std::atomic_ref<uint32_t>(*m_Ring->CqHead).load(std::memory_order_relaxed);
+      if (std::atomic_ref<uint32_t>(*m_Ring->CqTail).load(std::memory_order_acquire) != Head)
+      {
+        return {};
+      }
+      if (Ring::Enter(m_Ring->Fd, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR)
+      {
+        return std::unexpected(std::string("io_uring_enter wait failed: ") + std::strerror(errno));
+      }
+    }
+  }
+
+  size_t IoUringQueue::ReapCompletions(std::span<Completion> Out)
+  {
+    uint32_t Head = std::atomic_ref<uint32_t>(*m_Ring->CqHead).load(std::memory_order_relaxed);
+    const uint32_t Tail = std::atomic_ref<uint32_t>(*m_Ring->CqTail).load(std::memory_order_acquire);
+
+    size_t Count = 0;
+    while (Head != Tail && Count < Out.size())
+    {
+      const io_uring_cqe& Cqe = m_Ring->Cqes[Head & m_Ring->CqMask];
+      Out[Count++] = {Cqe.user_data, Cqe.res};
+      ++Head;
+    }
+    std::atomic_ref<uint32_t>(*m_Ring->CqHead).store(Head, std::memory_order_release);
+    return Count;
+  }
+
+#else
+
+  struct IoUringQueue::Ring
+  {
+  };
+
+  std::expected<std::unique_ptr<IoUringQueue>, std::string> IoUringQueue::Create(uint32_t)
+  {
+    return std::unexpected("io_uring support is not available in this build");
+  }
+
+  IoUringQueue::~IoUringQueue() = default;
+
+  uint32_t IoUringQueue::GetQueueDepth() const
+  {
+    return 0;
+  }
+
+  bool IoUringQueue::QueueRead(int, uint64_t, void*, uint32_t, uint64_t)
+  {
+    return false;
+  }
+
+  bool IoUringQueue::QueueNop(uint64_t)
+  {
+    return false;
+  }
+
+  std::expected<void, std::string> IoUringQueue::Submit()
+  {
+    return std::unexpected("io_uring support is not available in this build");
+  }
+
+  std::expected<void, std::string> IoUringQueue::WaitForCompletion()
+  {
+    return std::unexpected("io_uring support is not available in this build");
+  }
+
+  size_t IoUringQueue::ReapCompletions(std::span<Completion>)
+  {
+    return 0;
+  }
+
+#endif
+
+} // namespace SnAPI::AssetPipeline::Pack
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <span>
+#include <string>
+
+namespace SnAPI::AssetPipeline::Pack
+{
+
+  // Minimal io_uring read queue built on the raw syscalls (no liburing dependency).
+  // Only available on Linux builds with SNAPI_ASSETPIPELINE_HAS_IO_URING; elsewhere, or when the
+  // kernel refuses to create a ring (old kernel, seccomp, container policy), Create() fails and
+  // callers fall back to memory-mapped reads.
+  //
+  // Queueing and submitting must be serialized by the caller. Reaping completions may run on
+  // another thread concurrently with submission; a single thread must own reaping.
+  class IoUringQueue
+  {
+  public:
+      struct Completion
+      {
+          uint64_t UserData = 0;
+          int32_t Result = 0; // bytes read, or -errno
+      };
+
+      static std::expected<std::unique_ptr<IoUringQueue>, std::string> Create(uint32_t QueueDepth);
+
+      ~IoUringQueue();
+
+      // Number of submission queue entries (may be rounded up from the requested depth)
+      uint32_t GetQueueDepth() const;
+
+      // Queue a read of Length bytes at Offset of Fd into Buffer. Returns false when the
+      // submission queue is full; nothing is sent to the kernel until Submit(). The caller owns
+      // Fd and Buffer and keeps both valid until the read's completion has been reaped.
+      bool QueueRead(int Fd, uint64_t Offset, void* Buffer, uint32_t Length, uint64_t UserData);
+
+      // Queue a no-op whose completion carries UserData (used to wake a reaping thread)
+      bool QueueNop(uint64_t UserData);
+
+      // Hand all queued entries to the kernel without waiting
+      std::expected<void, std::string> Submit();
+
+      // Block until at least one completion is available
+      std::expected<void, std::string> WaitForCompletion();
+
+      // Copy available completions into Out; returns how many were written
+      size_t ReapCompletions(std::span<Completion> Out);
+
+      IoUringQueue(const IoUringQueue&) = delete;
+      IoUringQueue& operator=(const IoUringQueue&) = delete;
+
+  private:
+      IoUringQueue() = default;
+
+      struct Ring;
+      std::unique_ptr<Ring> m_Ring;
+  };
+
+} // namespace SnAPI::AssetPipeline::Pack
@@ -1,6 +1,8 @@
 #include "MemoryMappedFile.h"
 #include "SnPakFormat.h"
 
+#include <algorithm>
+#include <cerrno>
 #include <cstring>
 #include <vector>
 #include <stdexcept>
@@ -27,7 +29,7 @@ namespace SnAPI::AssetPipeline
   }
 
   MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& Other) noexcept
-      : m_Path(std::move(Other.m_Path)), m_Data(Other.m_Data), m_Size(Other.m_Size), m_Access(Other.m_Access)
+      : m_Path(std::move(Other.m_Path)), m_Data(Other.m_Data), m_Size(Other.m_Size), m_Access(Other.m_Access), m_bLocked(Other.m_bLocked)
 #ifdef _WIN32
         ,
         m_FileHandle(Other.m_FileHandle), m_MappingHandle(Other.m_MappingHandle)
@@ -38,6 +40,7 @@ namespace SnAPI::AssetPipeline
   {
     Other.m_Data = nullptr;
     Other.m_Size = 0;
+    Other.m_bLocked = false;
 #ifdef _WIN32
     Other.m_FileHandle = nullptr;
     Other.m_MappingHandle = nullptr;
@@ -55,6 +58,7 @@ namespace SnAPI::AssetPipeline
       m_Data = Other.m_Data;
       m_Size = Other.m_Size;
       m_Access = Other.m_Access;
+      m_bLocked = Other.m_bLocked;
 #ifdef _WIN32
       m_FileHandle = Other.m_FileHandle;
       m_MappingHandle = Other.m_MappingHandle;
@@ -66,6 +70,7 @@ namespace SnAPI::AssetPipeline
 #endif
       Other.m_Data = nullptr;
       Other.m_Size = 0;
+      Other.m_bLocked = false;
     }
     return *this;
   }
@@ -193,11 +198,24 @@ namespace SnAPI::AssetPipeline
     return {};
   }
 
+  int MemoryMappedFile::GetFileDescriptor() const
+  {
+#ifdef _WIN32
+    return -1;
+#else
+    return m_Fd;
+#endif
+  }
+
   void MemoryMappedFile::Close()
   {
 #ifdef _WIN32
     if (m_Data)
     {
+      if (m_bLocked)
+      {
+        VirtualUnlock(m_Data, m_Size);
+      }
       UnmapViewOfFile(m_Data);
       m_Data = nullptr;
     }
@@ -214,6 +232,7 @@ namespace SnAPI::AssetPipeline
 #else
     if (m_Data && m_Size > 0)
     {
+      // Unmapping also drops any mlock on the pages
       munmap(m_Data, m_Size);
       m_Data = nullptr;
     }
@@ -224,6 +243,7 @@ namespace SnAPI::AssetPipeline
     }
 #endif
     m_Size = 0;
+    m_bLocked = false;
     m_Path.clear();
   }
 
@@ -278,6 +298,138 @@ namespace SnAPI::AssetPipeline
 #endif
   }
 
+  bool MemoryMappedFile::IsResident(size_t Offset, size_t Length) const
+  {
+    if (!m_Data || Offset >= m_Size)
+    {
+      return false;
+    }
+    Length = std::min(Length, m_Size - Offset);
+    if (Length == 0)
+    {
+      return true;
+    }
+
+#ifdef _WIN32
+    return false;
+#else
+    const size_t PageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t Begin = Offset / PageSize * PageSize;
+    const size_t PageCount = (Offset + Length - Begin + PageSize - 1) / PageSize;
+    std::vector<unsigned char> Residency(PageCount);
+    if (mincore(m_Data + Begin, Offset + Length - Begin, Residency.data()) != 0)
+    {
+      return false;
+    }
+    return std::all_of(Residency.begin(), Residency.end(), [](const unsigned char Page) { return (Page & 1) != 0; });
+#endif
+  }
+
+  void MemoryMappedFile::SetAccessPattern(const EMapAccessPattern Pattern, const size_t Offset, size_t Length) const
+  {
+    if (!m_Data || Offset >= m_Size)
+    {
+      return;
+    }
+    Length = std::min(Length, m_Size - Offset);
+
+#ifdef _WIN32
+    (void)Pattern;
+#else
+    int Advice = MADV_NORMAL;
+    if (Pattern == EMapAccessPattern::Sequential)
+    {
+      Advice = MADV_SEQUENTIAL;
+    }
+    else if (Pattern == EMapAccessPattern::Random)
+    {
+      Advice = MADV_RANDOM;
+    }
+    // madvise wants a page-aligned start; widen the region to the pages it touches
+    const size_t PageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t Begin = Offset / PageSize * PageSize;
+    madvise(m_Data + Begin, Offset + Length - Begin, Advice);
+#endif
+  }
+
+  bool MemoryMappedFile::RequestHugePages() const
+  {
+#if defined(MADV_HUGEPAGE)
+    return m_Data != nullptr && madvise(m_Data, m_Size, MADV_HUGEPAGE) == 0;
+#else
+    return false;
+#endif
+  }
+
+  void MemoryMappedFile::Release(const size_t Offset, size_t Length) const
+  {
+    if (!m_Data || Offset >= m_Size)
+    {
+      return;
+    }
+    Length = std::min(Length, m_Size - Offset);
+
+#ifndef _WIN32
+    // Only pages entirely inside the region, so neighbouring data stays mapped
+    const size_t PageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t Begin = (Offset + PageSize - 1) / PageSize * PageSize;
+    const size_t End = Offset + Length == m_Size ? m_Size : (Offset + Length) / PageSize * PageSize;
+    if (End > Begin)
+    {
+      madvise(m_Data + Begin, End - Begin, MADV_DONTNEED);
+    }
+#endif
+  }
+
+  std::expected<void, std::string> MemoryMappedFile::MakeResident(const bool bLock)
+  {
+    if (!m_Data)
+    {
+      return {};
+    }
+
+#ifdef _WIN32
+    const size_t PageSize = 4096;
+#else
+    const long QueriedPageSize = sysconf(_SC_PAGESIZE);
+    const size_t PageSize = QueriedPageSize > 0 ? static_cast<size_t>(QueriedPageSize) : 4096;
+#  ifdef MADV_POPULATE_READ
+    // Linux 5.14+: populate the page tables in one call, as MAP_POPULATE would have at mmap time
+    const bool bPopulated = madvise(m_Data, m_Size, MADV_POPULATE_READ) == 0;
+#  else
+    const bool bPopulated = false;
+#  endif
+    if (!bPopulated)
+#endif
+    {
+      Prefetch(0, m_Size);
+      volatile uint8_t Dummy = 0;
+      for (size_t I = 0; I < m_Size; I += PageSize)
+      {
+        Dummy = m_Data[I];
+      }
+      (void)Dummy;
+    }
+
+    if (!bLock || m_bLocked)
+    {
+      return {};
+    }
+#ifdef _WIN32
+    if (!VirtualLock(m_Data, m_Size))
+    {
+      return std::unexpected("Failed to lock mapping in memory: " + m_Path);
+    }
+#else
+    if (mlock(m_Data, m_Size) != 0)
+    {
+      return std::unexpected("Failed to lock mapping in memory: " + m_Path + " (" + std::strerror(errno) + ")");
+    }
+#endif
+    m_bLocked = true;
+    return {};
+  }
+
   // ========== MemoryMappedRegion ==========
 
   MemoryMappedRegion::~MemoryMappedRegion()
@@ -1,9 +1,15 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <cstring>
+#include <memory>
+#include <span>
+#include <unordered_map>
 #include <vector>
 
+struct ZSTD_DDict_s;
+
 // All structs are byte-packed, little-endian
 #pragma pack(push, 1)
 
@@ -18,6 +24,8 @@ namespace SnAPI::AssetPipeline::Pack
   constexpr uint8_t kChunkMagic[4] = {'C', 'H', 'N', 'K'};
   constexpr uint8_t kIndexMagic[4] = {'I', 'N', 'D', 'X'};
   constexpr uint8_t kStringMagic[4] = {'S', 'T', 'R', 'S'};
+  constexpr uint8_t kLookupMagic[4] = {'L', 'K', 'U', 'P'};
+  constexpr uint8_t kDictionaryMagic[4] = {'D', 'I', 'C', 'T'};
   constexpr uint32_t kInvalidStringId = 0xFFFFFFFFu;
 
   // Endian marker: 0x01020304 in native order
@@ -47,13 +55,22 @@ namespace SnAPI::AssetPipeline::Pack
     SnPakFlag_None = 0,
     SnPakFlag_HasTrailingIndex = 1 << 0,
     SnPakFlag_HasTypeTable = 1 << 1,
+    // Chunk data starts are aligned; the alignment is stored in SnPakHeaderV1::Reserved0
+    SnPakFlag_AlignedChunks = 1 << 2,
+    // A Zstd dictionary block is referenced from SnPakHeaderV1::Reserved[0..15]
+    SnPakFlag_HasDictionaries = 1 << 3,
   };
 
+  // Largest chunk alignment a writer may request
+  constexpr uint32_t kMaxChunkAlignment = 1u << 20;
+
   // Chunk kinds
   enum class ESnPakChunkKind : uint8_t
   {
     MainPayload = 0,
     Bulk = 1,
+    // Main payloads of several small assets stored back to back (see IndexEntryFlag_SolidBlock)
+    SolidBlock = 2,
   };
 
   struct SnPakHeaderV1
@@ -87,12 +104,13 @@ namespace SnAPI::AssetPipeline::Pack
 
       // Flags
       uint32_t Flags;
-      uint32_t Reserved0;
+      uint32_t Reserved0; // chunk data alignment when SnPakFlag_AlignedChunks is set
 
       // For append-update mode
       uint64_t PreviousIndexOffset; // 0 if none
       uint64_t PreviousIndexSize;   // 0 if none
 
+      // [0..7] dictionary block offset, [8..15] dictionary block size (SnPakFlag_HasDictionaries)
       uint8_t Reserved[64]; // pad for future expansions
   };
 
@@ -130,11 +148,98 @@ namespace SnAPI::AssetPipeline::Pack
       uint64_t PreviousIndexOffset;
       uint64_t PreviousIndexSize;
 
+      // [0..3] dependency owner count, [4..7] dependency entry count, [8..11] ESnPakIndexFlags,
+      // [16..23] lookup block offset, [24..31] lookup block size
       uint8_t Reserved[32];
   };
 
   static_assert(sizeof(SnPakIndexHeaderV1) == 88, "SnPakIndexHeaderV1 size mismatch");
 
+  // Index flags (stored in SnPakIndexHeaderV1::Reserved[8..11])
+  enum ESnPakIndexFlags : uint32_t
+  {
+    IndexFlag_None = 0,
+    IndexFlag_HasLookupBlock = 1 << 0,
+    // The arrays after the index header are stored as independently compressed record blocks
+    // (SnPakIndexBlockTableHeaderV1, see EncodeIndexArrays); BlockSize is the stored size, the
+    // decoded size follows from the counts
+    IndexFlag_CompressedArrays = 1 << 1,
+  };
+
+  /**
+   * @brief Optional precomputed lookup tables for an index block.
+   *
+   * Followed by IdCount SnPakIdLookupEntryV1 records (AssetIds in Eytzinger order) and
+   * NameBucketCount SnPakNameBucketV1 records (linear-probed hash table keyed by NameHash64).
+   */
+  struct SnPakLookupHeaderV1
+  {
+      uint8_t Magic[4];   // "LKUP"
+      uint32_t Version;   // 1
+      uint64_t BlockSize; // includes header + arrays
+
+      uint32_t IdCount;         // unique AssetIds (duplicates resolve to the last index entry)
+      uint32_t NameBucketCount; // power of two > index EntryCount, 0 if the index is empty
+
+      // Hash of the arrays following this header
+      uint64_t HashHi;
+      uint64_t HashLo;
+
+      uint8_t Reserved[16];
+  };
+
+  static_assert(sizeof(SnPakLookupHeaderV1) == 56, "SnPakLookupHeaderV1 size mismatch");
+
+  struct SnPakIdLookupEntryV1
+  {
+      uint8_t AssetId[16];
+      uint32_t AssetIndex;
+  };
+
+  static_assert(sizeof(SnPakIdLookupEntryV1) == 20, "SnPakIdLookupEntryV1 size mismatch");
+
+  struct SnPakNameBucketV1
+  {
+      uint64_t NameHash64;
+      uint32_t AssetIndex; // kEmptyNameBucket if unused
+  };
+
+  static_assert(sizeof(SnPakNameBucketV1) == 12, "SnPakNameBucketV1 size mismatch");
+
+  constexpr uint32_t kEmptyNameBucket = 0xFFFFFFFFu;
+
+  /**
+   * @brief Zstd dictionaries referenced by chunks with ChunkFlag_Dictionary.
+   *
+   * Followed by DictionaryCount SnPakDictionaryEntryV1 records, then the dictionaries back to
+   * back. Each dictionary is a complete Zstd dictionary (ZDICT format) whose ID is also written
+   * into every frame compressed with it.
+   */
+  struct SnPakDictionaryHeaderV1
+  {
+      uint8_t Magic[4];   // "DICT"
+      uint32_t Version;   // 1
+      uint64_t BlockSize; // includes header + entries + dictionary data
+      uint32_t DictionaryCount;
+      uint32_t Reserved0;
+      // Hash of everything following this header
+      uint64_t HashHi;
+      uint64_t HashLo;
+  };
+
+  static_assert(sizeof(SnPakDictionaryHeaderV1) == 40, "SnPakDictionaryHeaderV1 size mismatch");
+
+  struct SnPakDictionaryEntryV1
+  {
+      uint32_t DictionaryId;  // Zstd dictionary ID, unique within the block
+      uint32_t Reserved0;
+      uint8_t AssetKind[16];  // kind whose payloads the dictionary was trained on
+      uint64_t DataOffset;    // relative to the start of the block
+      uint64_t DataSize;
+  };
+
+  static_assert(sizeof(SnPakDictionaryEntryV1) == 40, "SnPakDictionaryEntryV1 size mismatch");
+
   struct SnPakIndexEntryV1
   {
       uint8_t AssetId[16];
@@ -156,7 +261,7 @@ namespace SnAPI::AssetPipeline::Pack
       uint64_t PayloadChunkSizeUncompressed;
 
       uint8_t Compression; // ESnPakCompression
-      uint8_t Flags;       // bit0=HasBulk
+      uint8_t Flags;       // ESnPakIndexEntryFlags
       uint16_t Reserved0;  // Compression level (low byte), reserved (high byte)
 
       uint32_t BulkFirstIndex; // into bulk array
@@ -173,8 +278,31 @@ namespace SnAPI::AssetPipeline::Pack
   {
     IndexEntryFlag_None = 0,
     IndexEntryFlag_HasBulk = 1 << 0,
+    // The payload chunk is shared with an earlier asset that has identical content, so the
+    // chunk header's AssetId names that asset rather than this one
+    IndexEntryFlag_SharedPayload = 1 << 1,
+    // The payload is a slice of a SolidBlock chunk. PayloadChunkOffset/SizeCompressed locate the
+    // block chunk; PayloadChunkSizeUncompressed packs the payload's offset within the decoded
+    // block (high 32 bits) and its size (low 32 bits). Compression and Reserved0 are the block's.
+    IndexEntryFlag_SolidBlock = 1 << 2,
   };
 
+  inline uint64_t GetPayloadSize(const SnPakIndexEntryV1& Entry)
+  {
+    return (Entry.Flags & IndexEntryFlag_SolidBlock) ? (Entry.PayloadChunkSizeUncompressed & 0xFFFFFFFFull) : Entry.PayloadChunkSizeUncompressed;
+  }
+
+  inline uint64_t GetSolidMemberOffset(const SnPakIndexEntryV1& Entry)
+  {
+    return (Entry.Flags & IndexEntryFlag_SolidBlock) ? (Entry.PayloadChunkSizeUncompressed >> 32) : 0;
+  }
+
+  inline void SetSolidMember(SnPakIndexEntryV1& Entry, const uint32_t Offset, const uint32_t Size)
+  {
+    Entry.Flags |= IndexEntryFlag_SolidBlock;
+    Entry.PayloadChunkSizeUncompressed = (static_cast<uint64_t>(Offset) << 32) | Size;
+  }
+
   struct SnPakBulkEntryV1
   {
       uint8_t Semantic[4]; // EBulkSemantic as u32 LE
@@ -185,7 +313,7 @@ namespace SnAPI::AssetPipeline::Pack
       uint64_t SizeUncompressed;
 
       uint8_t Compression; // ESnPakCompression
-      uint8_t Reserved0[7]; // Compression level in Reserved0[0]
+      uint8_t Reserved0[7]; // Compression level in Reserved0[0], ESnPakBulkEntryFlags in Reserved0[1]
 
       uint64_t HashHi;
       uint64_t HashLo;
@@ -193,6 +321,17 @@ namespace SnAPI::AssetPipeline::Pack
 
   static_assert(sizeof(SnPakBulkEntryV1) == 56, "SnPakBulkEntryV1 size mismatch");
 
+  // Bulk entry flags (stored in SnPakBulkEntryV1::Reserved0[1])
+  enum ESnPakBulkEntryFlags : uint8_t
+  {
+    BulkEntryFlag_None = 0,
+    // The chunk is shared with an earlier chunk that has identical content; its header's
+    // AssetId may name a different asset
+    BulkEntryFlag_SharedChunk = 1 << 0,
+    // Mirrors ChunkFlag_Framed of the chunk header
+    BulkEntryFlag_Framed = 1 << 1,
+  };
+
   /**
    * @brief Span mapping from an asset index entry to its dependency records.
    */
@@ -241,6 +380,57 @@ namespace SnAPI::AssetPipeline::Pack
 
   static_assert(sizeof(SnPakChunkHeaderV1) == 80, "SnPakChunkHeaderV1 size mismatch");
 
+  // Chunk header flags (stored in the high byte of SnPakChunkHeaderV1::Reserved0)
+  enum ESnPakChunkFlags : uint8_t
+  {
+    ChunkFlag_None = 0,
+    // The stored data is a frame table followed by independently compressed frames, so any
+    // byte range can be decoded without decoding the whole chunk
+    ChunkFlag_Framed = 1 << 0,
+    // The data is a Zstd frame compressed with a dictionary from the pack's dictionary block; the
+    // frame header carries the dictionary ID
+    ChunkFlag_Dictionary = 1 << 1,
+  };
+
+  // Start of the stored data of a framed chunk. FrameCount SnPakFrameEntryV1 records follow,
+  // then the compressed frames back to back. Every frame but the last decodes to FrameSize bytes.
+  struct SnPakFrameTableHeaderV1
+  {
+      uint32_t FrameCount;
+      uint32_t FrameSize;
+  };
+
+  static_assert(sizeof(SnPakFrameTableHeaderV1) == 8, "SnPakFrameTableHeaderV1 size mismatch");
+
+  struct SnPakFrameEntryV1
+  {
+      uint64_t DataEnd; // end of the frame's compressed bytes, relative to the first frame
+      uint64_t Hash;    // XXH3-64 of the decoded frame
+  };
+
+  static_assert(sizeof(SnPakFrameEntryV1) == 16, "SnPakFrameEntryV1 size mismatch");
+
+  // Start of the stored arrays of an index with IndexFlag_CompressedArrays. Each array (asset
+  // entries, bulk entries, dependency owners, dependency entries) is split into blocks of
+  // RecordsPerBlock records that are column-encoded and Zstd-compressed on their own, so readers
+  // decode only the blocks they touch. One SnPakIndexBlockEntryV1 per block follows (every block
+  // of the first array, then of the next), then the compressed blocks back to back.
+  struct SnPakIndexBlockTableHeaderV1
+  {
+      uint64_t TableHash; // XXH3-64 of everything after this field up to the first block
+      uint32_t RecordsPerBlock[4];
+  };
+
+  static_assert(sizeof(SnPakIndexBlockTableHeaderV1) == 24, "SnPakIndexBlockTableHeaderV1 size mismatch");
+
+  struct SnPakIndexBlockEntryV1
+  {
+      uint64_t DataEnd; // end of the block's compressed bytes, relative to the first block
+      uint64_t Hash;    // XXH3-64 of the decoded records
+  };
+
+  static_assert(sizeof(SnPakIndexBlockEntryV1) == 16, "SnPakIndexBlockEntryV1 size mismatch");
+
 } // namespace SnAPI::AssetPipeline::Pack
 
 #pragma pack(pop)
@@ -291,10 +481,264 @@ namespace SnAPI::AssetPipeline::Pack
     std::memcpy(Header.Reserved + 4, &Count, sizeof(Count));
   }
 
+  inline uint32_t GetIndexFlags(const SnPakIndexHeaderV1& Header)
+  {
+    uint32_t Value = 0;
+    std::memcpy(&Value, Header.Reserved + 8, sizeof(Value));
+    return Value;
+  }
+
+  inline void SetIndexFlags(SnPakIndexHeaderV1& Header, const uint32_t Flags)
+  {
+    std::memcpy(Header.Reserved + 8, &Flags, sizeof(Flags));
+  }
+
+  inline uint64_t GetLookupBlockOffset(const SnPakIndexHeaderV1& Header)
+  {
+    uint64_t Value = 0;
+    std::memcpy(&Value, Header.Reserved + 16, sizeof(Value));
+    return Value;
+  }
+
+  inline uint64_t GetLookupBlockSize(const SnPakIndexHeaderV1& Header)
+  {
+    uint64_t Value = 0;
+    std::memcpy(&Value, Header.Reserved + 24, sizeof(Value));
+    return Value;
+  }
+
+  inline void SetLookupBlock(SnPakIndexHeaderV1& Header, const uint64_t Offset, const uint64_t Size)
+  {
+    std::memcpy(Header.Reserved + 16, &Offset, sizeof(Offset));
+    std::memcpy(Header.Reserved + 24, &Size, sizeof(Size));
+  }
+
+  // Record size and count of one of the arrays stored after an index header
+  struct IndexArrayLayout
+  {
+      size_t RecordSize;
+      size_t RecordCount;
+  };
+
+  // Entries, bulk entries, dependency owners and dependency entries, in storage order
+  inline std::array<IndexArrayLayout, 4> GetIndexArrayLayout(const SnPakIndexHeaderV1& Header)
+  {
+    return {{{sizeof(SnPakIndexEntryV1), Header.EntryCount},
+             {sizeof(SnPakBulkEntryV1), Header.BulkEntryCount},
+             {sizeof(SnPakDependencyOwnerV1), GetDependencyOwnerCount(Header)},
+             {sizeof(SnPakDependencyEntryV1), GetDependencyEntryCount(Header)}}};
+  }
+
+  // Alignment of chunk data starts (1 for packs written without alignment)
+  inline uint32_t GetChunkAlignment(const SnPakHeaderV1& Header)
+  {
+    const uint32_t Alignment = Header.Reserved0;
+    if (!(Header.Flags & SnPakFlag_AlignedChunks) || Alignment == 0 || Alignment > kMaxChunkAlignment || (Alignment & (Alignment - 1)) != 0)
+    {
+      return 1;
+    }
+    return Alignment;
+  }
+
+  inline void SetChunkAlignment(SnPakHeaderV1& Header, const uint32_t Alignment)
+  {
+    if (Alignment > 1)
+    {
+      Header.Flags |= SnPakFlag_AlignedChunks;
+      Header.Reserved0 = Alignment;
+    }
+    else
+    {
+      Header.Flags &= ~static_cast<uint32_t>(SnPakFlag_AlignedChunks);
+      Header.Reserved0 = 0;
+    }
+  }
+
+  // First offset at or after Offset where a chunk can start so that its data (which follows the
+  // chunk header) lands on an Alignment boundary. Alignment must be a power of two.
+  inline uint64_t AlignChunkOffset(const uint64_t Offset, const uint32_t Alignment)
+  {
+    const uint64_t Mask = static_cast<uint64_t>(Alignment) - 1;
+    const uint64_t DataStart = (Offset + sizeof(SnPakChunkHeaderV1) + Mask) & ~Mask;
+    return DataStart - sizeof(SnPakChunkHeaderV1);
+  }
+
+  inline uint64_t GetDictionaryBlockOffset(const SnPakHeaderV1& Header)
+  {
+    uint64_t Value = 0;
+    std::memcpy(&Value, Header.Reserved + 0, sizeof(Value));
+    return Value;
+  }
+
+  inline uint64_t GetDictionaryBlockSize(const SnPakHeaderV1& Header)
+  {
+    uint64_t Value = 0;
+    std::memcpy(&Value, Header.Reserved + 8, sizeof(Value));
+    return Value;
+  }
+
+  inline void SetDictionaryBlock(SnPakHeaderV1& Header, const uint64_t Offset, const uint64_t Size)
+  {
+    if (Size > 0)
+    {
+      Header.Flags |= SnPakFlag_HasDictionaries;
+    }
+    else
+    {
+      Header.Flags &= ~static_cast<uint32_t>(SnPakFlag_HasDictionaries);
+    }
+    std::memcpy(Header.Reserved + 0, &Offset, sizeof(Offset));
+    std::memcpy(Header.Reserved + 8, &Size, sizeof(Size));
+  }
+
+  inline uint8_t GetBulkEntryFlags(const SnPakBulkEntryV1& Entry)
+  {
+    return Entry.Reserved0[1];
+  }
+
+  inline void SetBulkEntryFlags(SnPakBulkEntryV1& Entry, const uint8_t Flags)
+  {
+    Entry.Reserved0[1] = Flags;
+  }
+
+  inline uint8_t GetChunkFlags(const SnPakChunkHeaderV1& Header)
+  {
+    return static_cast<uint8_t>(Header.Reserved0 >> 8);
+  }
+
+  inline void SetChunkFlags(SnPakChunkHeaderV1& Header, const uint8_t Flags)
+  {
+    Header.Reserved0 = static_cast<uint16_t>((Header.Reserved0 & 0xFFu) | (static_cast<uint16_t>(Flags) << 8));
+  }
+
   // Compression/decompression functions
   std::vector<uint8_t> Compress(const uint8_t* Data, size_t Size, ESnPakCompression Mode, ESnPakCompressionLevel Level);
   std::vector<uint8_t> Compress(const uint8_t* Data, size_t Size, ESnPakCompression Mode);
   std::vector<uint8_t> CompressMax(const uint8_t* Data, size_t Size, ESnPakCompression Mode);
   std::vector<uint8_t> Decompress(const uint8_t* Data, size_t CompressedSize, size_t UncompressedSize, ESnPakCompression Mode);
+  // Decompress into caller-owned memory; Output.size() must equal the uncompressed size
+  void Decompress(const uint8_t* Data, size_t CompressedSize, std::span<uint8_t> Output, ESnPakCompression Mode);
+
+  // Block encoding used by IndexFlag_CompressedArrays: Arrays holds the records described by
+  // Layout back to back. Each array is cut into blocks of about kIndexBlockSize decoded bytes;
+  // within a block the records are transposed so byte k of every record is stored together (asset
+  // kinds, payload types, flags and the high bytes of sizes and offsets become long runs) and the
+  // block is Zstd-compressed. Returns the block table followed by the blocks.
+  constexpr size_t kIndexBlockSize = 32 * 1024;
+  std::vector<uint8_t> EncodeIndexArrays(std::span<const uint8_t> Arrays, std::span<const IndexArrayLayout> Layout);
+
+  // Block table of a compressed index, checked against its hash and the counts in Layout so that
+  // every block lies inside Encoded and decodes to at most kMaxIndexBlockSize bytes. Only the
+  // table is read; blocks are touched when decoded. Throws on corrupt input. The table is viewed
+  // in place, so Encoded must outlive it.
+  constexpr size_t kMaxIndexBlockSize = 1024 * 1024;
+  class IndexBlockTable
+  {
+  public:
+      IndexBlockTable() = default;
+      IndexBlockTable(std::span<const uint8_t> Encoded, std::span<const IndexArrayLayout> Layout);
+
+      size_t GetRecordsPerBlock(size_t Array) const { return m_RecordsPerBlock[Array]; }
+      size_t GetBlockCount(size_t Array) const { return m_BlockCount[Array]; }
+
+      // Decode block Block of array Array into Records, which must hold exactly that block's
+      // records. The decoded records are checked against the block's hash. Throws on corrupt input.
+      void DecodeBlock(size_t Array, size_t Block, std::span<uint8_t> Records) const;
+
+      // Decoded size of a block of array Array
+      size_t GetBlockSize(size_t Array, size_t Block) const;
+
+  private:
+      std::span<const uint8_t> m_Blocks;
+      const uint8_t* m_Entries = nullptr;
+      std::array<IndexArrayLayout, 4> m_Layout{};
+      std::array<size_t, 4> m_RecordsPerBlock{};
+      std::array<size_t, 4> m_BlockCount{};
+      std::array<size_t, 4> m_FirstBlock{};
+  };
+
+  // Decode every array of a compressed index, growing the result block by block so corrupt
+  // counts never cause an allocation the stored data cannot back. Throws on corrupt input.
+  std::vector<uint8_t> DecodeIndexArrays(std::span<const uint8_t> Encoded, std::span<const IndexArrayLayout> Layout);
+
+  // Framed (seekable) encoding used by ChunkFlag_Framed chunks: Data is split into FrameSize-byte
+  // frames that are compressed independently, preceded by the frame table
+  std::vector<uint8_t> CompressFrames(const uint8_t* Data, size_t Size, uint32_t FrameSize, ESnPakCompression Mode,
+                                      ESnPakCompressionLevel Level);
+  // Decode bytes [Offset, Offset + Output.size()) of a framed chunk that decodes to
+  // UncompressedSize bytes, decompressing only the frames overlapping the range. With
+  // bVerifyFrames every decoded frame is checked against its hash in the frame table.
+  void DecompressFrameRange(const uint8_t* Data, size_t StoredSize, uint64_t UncompressedSize, uint64_t Offset,
+                            std::span<uint8_t> Output, ESnPakCompression Mode, bool bVerifyFrames);
+
+  // Train a Zstd dictionary of at most Capacity bytes on Samples. Returns an empty vector when
+  // the samples are too few or too small to train on.
+  std::vector<uint8_t> TrainZstdDictionary(const std::vector<std::span<const uint8_t>>& Samples, size_t Capacity);
+
+  // Zstd dictionary ID of a trained dictionary (0 if Bytes is not a Zstd dictionary)
+  uint32_t GetZstdDictionaryId(std::span<const uint8_t> Bytes);
+
+  // One dictionary of a dictionary block; Data points into the block bytes it was parsed from
+  struct DictionaryBlockEntry
+  {
+      SnPakDictionaryEntryV1 Entry{};
+      std::span<const uint8_t> Data;
+  };
+
+  // Validate a complete dictionary block (magic, version, size, entry bounds, hash and each
+  // dictionary's embedded ID) and return its dictionaries in block order. The hash is always
+  // checked: a corrupted dictionary would silently decode every chunk using it wrongly. Shared by
+  // the reader and by writer updates of an existing pack. Throws on corrupt input.
+  std::vector<DictionaryBlockEntry> ParseDictionaryBlock(std::span<const uint8_t> Block);
+
+  // A trained dictionary on the compression side. Compression parameters are digested once per
+  // level on first use; Compress may be called from several threads.
+  class ZstdEncoderDictionary
+  {
+  public:
+      explicit ZstdEncoderDictionary(std::vector<uint8_t> Bytes);
+      ~ZstdEncoderDictionary();
+
+      uint32_t GetId() const { return m_Id; }
+      std::span<const uint8_t> GetBytes() const { return m_Bytes; }
+
+      // Compress into a single Zstd frame that references this dictionary. Mode must be Zstd or ZstdFast.
+      std::vector<uint8_t> Compress(const uint8_t* Data, size_t Size, ESnPakCompression Mode, ESnPakCompressionLevel Level) const;
+
+      ZstdEncoderDictionary(const ZstdEncoderDictionary&) = delete;
+      ZstdEncoderDictionary& operator=(const ZstdEncoderDictionary&) = delete;
+
+  private:
+      struct Prepared;
+      std::vector<uint8_t> m_Bytes;
+      uint32_t m_Id = 0;
+      std::unique_ptr<Prepared> m_Prepared;
+  };
+
+  // The dictionaries of one pack, prepared for decoding (ZSTD_DDict) once when the pack is opened
+  class ZstdDictionarySet
+  {
+  public:
+      ZstdDictionarySet() = default;
+      ~ZstdDictionarySet();
+
+      // Prepare a dictionary under its embedded ID; fails for invalid bytes or a duplicate ID
+      bool Add(std::span<const uint8_t> Bytes);
+
+      const ZSTD_DDict_s* Find(uint32_t DictionaryId) const;
+      size_t GetCount() const { return m_Dictionaries.size(); }
+      void Clear();
+
+      ZstdDictionarySet(const ZstdDictionarySet&) = delete;
+      ZstdDictionarySet& operator=(const ZstdDictionarySet&) = delete;
+
+  private:
+      std::unordered_map<uint32_t, ZSTD_DDict_s*> m_Dictionaries;
+  };
+
+  // Like Decompress, but Zstd frames that reference a dictionary are decoded with the matching
+  // prepared dictionary from Dictionaries (which may be null for packs without dictionaries)
+  void Decompress(const uint8_t* Data, size_t CompressedSize, std::span<uint8_t> Output, ESnPakCompression Mode,
+                  const ZstdDictionarySet* Dictionaries);
 
 } // namespace SnAPI::AssetPipeline::Pack
@@ -13,12 +13,15 @@
 #define XXH_INLINE_ALL
 #include <xxhash.h>
 
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 #include <future>
 #include <thread>
 #include <mutex>
 #include <atomic>
+#include <condition_variable>
+#include <optional>
 #include <queue>
 #include <functional>
 #include <unordered_set>
@@ -58,6 +61,11 @@ namespace SnAPI::AssetPipeline
         Out = EPackCompression::ZstdFast;
         return true;
       }
+      if (Mode == "auto")
+      {
+        Out = EPackCompression::Auto;
+        return true;
+      }
       return false;
     }
 
@@ -90,6 +98,12 @@ namespace SnAPI::AssetPipeline
     {
       Writer.SetCompression(Config.Compression);
       Writer.SetCompressionLevel(Config.CompressionLevel);
+      Writer.SetAutoCompressionSettings(Config.AutoCompression);
+      Writer.SetDictionaryTraining(Config.DictionaryTraining);
+      Writer.SetSolidBlocks(Config.SolidBlocks);
+      Writer.SetAccessOrderProfile(Config.AccessOrderProfile);
+      Writer.SetCompressIndex(Config.bCompressIndex);
+      Writer.SetCompressionThreads(Config.ParallelJobs);
 
       auto It = Config.BuildOptions.find("compression");
       if (It != Config.BuildOptions.end())
@@ -111,6 +125,76 @@ namespace SnAPI::AssetPipeline
         }
       }
     }
+
+    // Most specific rule in Rules that matches a chunk of an asset of kind Kind (Semantic unset = the
+    // cooked payload), or nullptr
+    const PackCompressionRule* FindCompressionRule(const std::vector<PackCompressionRule>& Rules, const TypeId& Kind,
+                                                   const std::optional<EBulkSemantic> Semantic)
+    {
+      const PackCompressionRule* Best = nullptr;
+      int BestRank = -1;
+      for (const PackCompressionRule& Rule : Rules)
+      {
+        if (Rule.AssetKind && *Rule.AssetKind != Kind)
+        {
+          continue;
+        }
+        const bool bBulkOnly = Rule.Scope == EPackCompressionScope::Bulk || Rule.BulkSemantic.has_value();
+        if ((Semantic && Rule.Scope == EPackCompressionScope::Payload) || (!Semantic && bBulkOnly))
+        {
+          continue;
+        }
+        if (Semantic && Rule.BulkSemantic && *Rule.BulkSemantic != *Semantic)
+        {
+          continue;
+        }
+
+        const int Rank = (Rule.AssetKind ? 4 : 0) + (Rule.BulkSemantic ? 2 : 0) + (Rule.Scope != EPackCompressionScope::AllChunks ? 1 : 0);
+        if (Rank >= BestRank)
+        {
+          Best = &Rule;
+          BestRank = Rank;
+        }
+      }
+      return Best;
+    }
+
+    // Resolve the build's compression policy into the entry's payload and bulk overrides
+    void ApplyCompressionPolicy(const std::vector<PackCompressionRule>& Rules, AssetPackEntry& Entry)
+    {
+      if (Rules.empty())
+      {
+        return;
+      }
+
+      if (!Entry.CompressionOverride)
+      {
+        if (const PackCompressionRule* Rule = FindCompressionRule(Rules, Entry.AssetKind, std::nullopt))
+        {
+          Entry.CompressionOverride = Rule->Compression;
+          if (!Entry.CompressionLevelOverride)
+          {
+            Entry.CompressionLevelOverride = Rule->Level;
+          }
+        }
+      }
+
+      for (BulkChunk& Bulk : Entry.Bulk)
+      {
+        if (Bulk.CompressionOverride || !Bulk.bCompress)
+        {
+          continue;
+        }
+        if (const PackCompressionRule* Rule = FindCompressionRule(Rules, Entry.AssetKind, Bulk.Semantic))
+        {
+          Bulk.CompressionOverride = Rule->Compression;
+          if (!Bulk.CompressionLevelOverride)
+          {
+            Bulk.CompressionLevelOverride = Rule->Level;
+          }
+        }
+      }
+    }
   } // namespace
 
   // Incremental cache for tracking built assets
@@ -220,6 +304,41 @@ namespace SnAPI::AssetPipeline
         Warnings.push_back(Msg);
       }
 
+      // Switch Writer to streaming mode for a full pack write when the config asks for it.
+      // Falls back to an in-memory write if the streaming temp file cannot be created.
+      void BeginStreaming(AssetPackWriter& Writer, const std::string& OutputPath)
+      {
+        if (Config.StreamingWriteBudget == 0)
+        {
+          return;
+        }
+
+        Writer.SetStreamingBudget(Config.StreamingWriteBudget);
+        auto StreamResult = Writer.BeginStreamingWrite(OutputPath);
+        if (!StreamResult)
+        {
+          LogWarning("Streaming pack write unavailable, buffering in memory: " + StreamResult.error());
+        }
+      }
+
+      // Compact PackPath after an append-update when Config.AutoCompactDeadRatio asks for it and
+      // return the bytes reclaimed. Failures are only warnings: the appended pack is still valid.
+      uint64_t AutoCompact(const AssetPackWriter& Writer, const std::string& PackPath)
+      {
+        if (Config.AutoCompactDeadRatio <= 0.0)
+        {
+          return 0;
+        }
+
+        auto CompactResult = Writer.Compact(PackPath, Config.AutoCompactDeadRatio);
+        if (!CompactResult)
+        {
+          LogWarning("Pack compaction failed: " + CompactResult.error());
+          return 0;
+        }
+        return CompactResult->bCompacted ? CompactResult->SizeBefore - CompactResult->SizeAfter : 0;
+      }
+
       void ClearLogs()
       {
         std::lock_guard Lock(ErrorMutex);
@@ -248,34 +367,41 @@ namespace SnAPI::AssetPipeline
         return XXH3_64bits(Data.data(), Data.size());
       }
 
-      // Process a single source file through the pipeline
-      // Returns: number of assets successfully cooked (0 on failure)
-      uint32_t ProcessSource(const SourceRef& Source, AssetPackWriter& Writer)
+      // Imported and cooked output of one source, buffered so that results produced by
+      // parallel workers can be committed to the pack writer in source order.
+      struct SourceBuildOutput
+      {
+          std::vector<AssetPackEntry> Entries;
+          std::vector<std::string> Errors;
+          std::vector<std::string> Warnings;
+      };
+
+      // Import and cook a single source file. Safe to call concurrently: results and
+      // diagnostics go to Output only, never to shared engine state.
+      void CookSource(const SourceRef& Source, SourceBuildOutput& Output)
       {
         // Find importer
         IAssetImporter* Importer = Loader->FindImporter(Source);
         if (!Importer)
         {
-          LogWarning("No importer found for: " + Source.Uri);
-          return 0;
+          Output.Warnings.push_back("No importer found for: " + Source.Uri);
+          return;
         }
 
         // Import
         std::vector<ImportedItem> Items;
         if (!Importer->ImportWithSettings(Source, Config.ImportSettings.get(), Items, *Context))
         {
-          LogError("Import failed for: " + Source.Uri);
-          return 0;
+          Output.Errors.push_back("Import failed for: " + Source.Uri);
+          return;
         }
 
         if (Items.empty())
         {
-          LogWarning("Import produced no items for: " + Source.Uri);
-          return 0;
+          Output.Warnings.push_back("Import produced no items for: " + Source.Uri);
+          return;
         }
 
-        uint32_t SuccessCount = 0;
-
         // Cook each imported item
         for (auto& Item : Items)
         {
@@ -288,8 +414,8 @@ namespace SnAPI::AssetPipeline
           IAssetCooker* Cooker = Loader->FindCooker(Item.AssetKind, Item.Intermediate.PayloadType);
           if (!Cooker)
           {
-            LogWarning("No cooker found for asset: " + Item.LogicalName + " (Kind: " + Item.AssetKind.ToString() +
-                       ", Type: " + Item.Intermediate.PayloadType.ToString() + ")");
+            Output.Warnings.push_back("No cooker found for asset: " + Item.LogicalName + " (Kind: " + Item.AssetKind.ToString() +
+                                      ", Type: " + Item.Intermediate.PayloadType.ToString() + ")");
             continue;
           }
 
@@ -309,11 +435,10 @@ namespace SnAPI::AssetPipeline
           CookResult Result;
           if (!Cooker->Cook(Req, Result, *Context))
           {
-            LogError("Cook failed for asset: " + Req.LogicalName);
+            Output.Errors.push_back("Cook failed for asset: " + Req.LogicalName);
             continue;
           }
 
-          // Add to pack writer
           AssetPackEntry Entry;
           Entry.Id = Req.Id;
           Entry.AssetKind = Req.AssetKind;
@@ -322,12 +447,157 @@ namespace SnAPI::AssetPipeline
           Entry.Cooked = std::move(Result.Cooked);
           Entry.Bulk = std::move(Result.Bulk);
           Entry.AssetDependencies = std::move(Result.AssetDependencies);
+          ApplyCompressionPolicy(Config.CompressionPolicy, Entry);
+          Output.Entries.push_back(std::move(Entry));
+        }
+      }
 
-          Writer.AddAsset(std::move(Entry));
-          ++SuccessCount;
+      void CookSourceNoThrow(const SourceRef& Source, SourceBuildOutput& Output)
+      {
+        try
+        {
+          CookSource(Source, Output);
+        }
+        catch (const std::exception& E)
+        {
+          Output.Errors.push_back("Unhandled exception while processing source '" + Source.Uri + "': " + E.what());
+        }
+        catch (...)
+        {
+          Output.Errors.push_back("Unhandled unknown exception while processing source '" + Source.Uri + "'");
+        }
+      }
+
+      uint32_t ResolveParallelJobs(size_t WorkItems) const
+      {
+        uint32_t Jobs = Config.ParallelJobs;
+        if (Jobs == 0)
+        {
+          Jobs = std::max(1u, std::thread::hardware_concurrency());
+        }
+        return static_cast<uint32_t>(std::min<size_t>(Jobs, std::max<size_t>(WorkItems, 1)));
+      }
+
+      // Process sources through import/cook on up to ParallelJobs workers.
+      //
+      // Workers claim sources in order and may finish out of order; the calling thread
+      // commits each source's entries and diagnostics to Writer strictly in source order,
+      // so the resulting pack (and the error/warning lists) are identical to a serial
+      // build. Workers never run more than a bounded window ahead of the commit cursor,
+      // which keeps the number of cooked-but-uncommitted results in memory bounded.
+      //
+      // Returns: number of assets successfully cooked per source (0 on failure)
+      std::vector<uint32_t> ProcessSources(const std::vector<SourceRef>& Sources, AssetPackWriter& Writer)
+      {
+        std::vector<uint32_t> Counts(Sources.size(), 0);
+
+        auto Commit = [&](size_t Index, SourceBuildOutput& Output) {
+          for (auto& Msg : Output.Errors)
+          {
+            LogError(Msg);
+          }
+          for (auto& Msg : Output.Warnings)
+          {
+            LogWarning(Msg);
+          }
+          Counts[Index] = static_cast<uint32_t>(Output.Entries.size());
+          for (auto& Entry : Output.Entries)
+          {
+            Writer.AddAsset(std::move(Entry));
+          }
+        };
+
+        const uint32_t Jobs = ResolveParallelJobs(Sources.size());
+        if (Jobs <= 1)
+        {
+          for (size_t I = 0; I < Sources.size(); ++I)
+          {
+            SourceBuildOutput Output;
+            CookSourceNoThrow(Sources[I], Output);
+            Commit(I, Output);
+          }
+          return Counts;
+        }
+
+        const size_t Window = static_cast<size_t>(Jobs) * 4;
+
+        std::vector<std::optional<SourceBuildOutput>> Slots(Sources.size());
+        std::mutex SlotMutex;
+        std::condition_variable SlotReady;
+        std::condition_variable WindowOpen;
+        size_t NextSource = 0;
+        size_t CommitCursor = 0;
+        bool bAbort = false;
+
+        auto Worker = [&]() {
+          while (true)
+          {
+            size_t Index = 0;
+            {
+              std::unique_lock Lock(SlotMutex);
+              WindowOpen.wait(Lock, [&] { return bAbort || NextSource >= Sources.size() || NextSource < CommitCursor + Window; });
+              if (bAbort || NextSource >= Sources.size())
+              {
+                return;
+              }
+              Index = NextSource++;
+            }
+
+            SourceBuildOutput Output;
+            CookSourceNoThrow(Sources[Index], Output);
+
+            {
+              std::lock_guard Lock(SlotMutex);
+              Slots[Index] = std::move(Output);
+            }
+            SlotReady.notify_all();
+          }
+        };
+
+        // Joins the workers on every exit path; if Commit throws, workers waiting for the window
+        // to open are released instead of blocking the unwind forever
+        struct WorkerGroup
+        {
+            std::vector<std::thread> Threads;
+            std::mutex& Mutex;
+            std::condition_variable& WindowOpen;
+            bool& bAbort;
+
+            ~WorkerGroup()
+            {
+              {
+                std::lock_guard Lock(Mutex);
+                bAbort = true;
+              }
+              WindowOpen.notify_all();
+              for (auto& Thread : Threads)
+              {
+                Thread.join();
+              }
+            }
+        } Group{{}, SlotMutex, WindowOpen, bAbort};
+
+        Group.Threads.reserve(Jobs);
+        for (uint32_t J = 0; J < Jobs; ++J)
+        {
+          Group.Threads.emplace_back(Worker);
+        }
+
+        for (size_t I = 0; I < Sources.size(); ++I)
+        {
+          SourceBuildOutput Output;
+          {
+            std::unique_lock Lock(SlotMutex);
+            SlotReady.wait(Lock, [&] { return Slots[I].has_value(); });
+            Output = std::move(*Slots[I]);
+            Slots[I].reset();
+            CommitCursor = I + 1;
+          }
+          WindowOpen.notify_all();
+          Commit(I, Output);
         }
 
-        return SuccessCount;
+        return Counts;
       }
 
       // Scan source roots for all files
@@ -835,11 +1105,14 @@ namespace SnAPI::AssetPipeline
     AssetPackWriter Writer;
 
     ApplyCompressionOptions(m_Impl->Config, Writer);
+    m_Impl->BeginStreaming(Writer, m_Impl->Config.OutputPackPath);
 
     // Process each source
-    for (const auto& Source : Sources)
+    const std::vector<uint32_t> Counts = m_Impl->ProcessSources(Sources, Writer);
+    for (size_t I = 0; I < Sources.size(); ++I)
     {
-      uint32_t Count = m_Impl->ProcessSource(Source, Writer);
+      const auto& Source = Sources[I];
+      uint32_t Count = Counts[I];
       if (Count > 0)
       {
         Result.AssetsBuilt += Count;
@@ -859,6 +1132,7 @@ namespace SnAPI::AssetPipeline
       m_Impl->LogError("Failed to write pack: " + WriteResult.error());
       Result.bSuccess = false;
     }
+    Result.CompressionStats = Writer.GetCompressionStats();
 
     // Save cache
     m_Impl->Cache->Save();
@@ -916,6 +1190,10 @@ namespace SnAPI::AssetPipeline
 
     AssetPackWriter Writer;
     ApplyCompressionOptions(m_Impl->Config, Writer);
+    if (!bAppend)
+    {
+      m_Impl->BeginStreaming(Writer, m_Impl->Config.OutputPackPath);
+    }
 
     // If appending, load existing pack first
     if (bAppend)
@@ -945,9 +1223,11 @@ namespace SnAPI::AssetPipeline
     }
 
     // Process changed sources
-    for (const auto& Source : ChangedSources)
+    const std::vector<uint32_t> Counts = m_Impl->ProcessSources(ChangedSources, Writer);
+    for (size_t I = 0; I < ChangedSources.size(); ++I)
     {
-      uint32_t Count = m_Impl->ProcessSource(Source, Writer);
+      const auto& Source = ChangedSources[I];
+      uint32_t Count = Counts[I];
       if (Count > 0)
       {
         Result.AssetsBuilt += Count;
@@ -967,6 +1247,11 @@ namespace SnAPI::AssetPipeline
       m_Impl->LogError("Failed to write pack: " + WriteResult.error());
       Result.bSuccess = false;
     }
+    else if (bAppend)
+    {
+      Result.CompactedBytes = m_Impl->AutoCompact(Writer, m_Impl->Config.OutputPackPath);
+    }
+    Result.CompressionStats = Writer.GetCompressionStats();
 
     // Save cache
     m_Impl->Cache->Save();
@@ -1040,10 +1325,18 @@ namespace SnAPI::AssetPipeline
     AssetPackWriter Writer;
     ApplyCompressionOptions(m_Impl->Config, Writer);
 
+    const bool bAppendToExisting = bAppend && std::filesystem::exists(PackPath);
+    if (!bAppendToExisting)
+    {
+      m_Impl->BeginStreaming(Writer, PackPath);
+    }
+
     // Process each source
-    for (const auto& Source : Sources)
+    const std::vector<uint32_t> Counts = m_Impl->ProcessSources(Sources, Writer);
+    for (size_t I = 0; I < Sources.size(); ++I)
     {
-      uint32_t Count = m_Impl->ProcessSource(Source, Writer);
+      const auto& Source = Sources[I];
+      uint32_t Count = Counts[I];
       if (Count > 0)
       {
         Result.AssetsBuilt += Count;
@@ -1057,7 +1350,7 @@ namespace SnAPI::AssetPipeline
 
     // Write or append to pack
     std::expected<void, std::string> WriteResult;
-    if (bAppend && std::filesystem::exists(PackPath))
+    if (bAppendToExisting)
     {
       WriteResult = Writer.AppendUpdate(PackPath);
     }
@@ -1071,6 +1364,11 @@ namespace SnAPI::AssetPipeline
       m_Impl->LogError("Failed to write pack: " + WriteResult.error());
       Result.bSuccess = false;
     }
+    else if (bAppendToExisting)
+    {
+      Result.CompactedBytes = m_Impl->AutoCompact(Writer, PackPath);
+    }
+    Result.CompressionStats = Writer.GetCompressionStats();
 
     // Save cache
     m_Impl->Cache->Save();
@@ -1248,6 +1546,7 @@ namespace SnAPI::AssetPipeline
       Entry.Cooked = Asset.Cooked;
       Entry.Bulk = Asset.Bulk;
       Entry.AssetDependencies = Asset.AssetDependencies;
+      ApplyCompressionPolicy(m_Impl->Config.CompressionPolicy, Entry);
 
       Writer.AddAsset(std::move(Entry));
     }
@@ -1257,6 +1556,10 @@ namespace SnAPI::AssetPipeline
     if (std::filesystem::exists(m_Impl->Config.OutputPackPath))
     {
       WriteResult = Writer.AppendUpdate(m_Impl->Config.OutputPackPath);
+      if (WriteResult.has_value())
+      {
+        m_Impl->AutoCompact(Writer, m_Impl->Config.OutputPackPath);
+      }
     }
     else
     {
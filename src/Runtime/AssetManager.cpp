@@ -4,10 +4,14 @@
 #include "Runtime/SourceAssetResolver.h"
 #include "Runtime/AutoMountScanner.h"
 
+#define XXH_INLINE_ALL
+#include <xxhash.h>
+
 #include <algorithm>
 #include <chrono>
 #include <cstdio>
 #include <filesystem>
+#include <list>
 #include <queue>
 #include <mutex>
 #include <stdexcept>
@@ -79,6 +83,7 @@ namespace SnAPI::AssetPipeline
       PackMountOptions Options;
       std::unique_ptr<AssetPackReader> Reader;
       std::filesystem::file_time_type LastModified;
+      uint64_t MountSerial = 0; // breaks priority ties: earlier mounts win
   };
 
   struct AssetManager::Impl
@@ -91,8 +96,23 @@ namespace SnAPI::AssetPipeline
       // Async loader (created lazily)
       std::unique_ptr<AsyncLoader> Loader;
 
-      // Mounted pack readers (sorted by priority, highest first)
-      std::vector<MountedPack> Packs;
+      // Mounted pack readers (sorted by priority, highest first). A list so the unified index
+      // below can point at packs while others are mounted and unmounted.
+      std::list<MountedPack> Packs;
+      uint64_t NextMountSerial = 0;
+
+      // Unified index over all mounted packs: the winning (highest priority) pack and entry for
+      // every AssetId and for every mounted name (mount point + name in pack), by name hash.
+      // Kept up to date on mount, unmount and hot reload so lookups are one probe instead of a
+      // scan over every pack. Names whose hashes collide resolve through the pack scan.
+      struct AssetLocation
+      {
+          const MountedPack* Pack = nullptr;
+          uint32_t Index = 0;
+      };
+      std::unordered_map<AssetId, AssetLocation, UuidHash> AssetsById;
+      std::unordered_map<uint64_t, AssetLocation> AssetsByNameHash;
+      bool bNameHashCollision = false; // set once two different names shared a hash
 
       // Factories by runtime type. One runtime type may support multiple cooked payload shapes.
       std::unordered_map<std::type_index, std::vector<std::unique_ptr<IAssetFactory>>> FactoriesByRuntimeType;
@@ -124,52 +144,214 @@ namespace SnAPI::AssetPipeline
       // Parent pointer for async loader
       AssetManager* Parent = nullptr;
 
+      static AssetPackReadOptions MakeReadOptions(const PackMountOptions& Options)
+      {
+        AssetPackReadOptions ReadOptions = Options.ReadOptions;
+        ReadOptions.bResident = ReadOptions.bResident || Options.bLoadToMemory;
+        return ReadOptions;
+      }
+
+      // True when lookups should resolve to A rather than B
+      static bool Outranks(const MountedPack& A, const MountedPack& B)
+      {
+        return A.Options.Priority != B.Options.Priority ? A.Options.Priority > B.Options.Priority : A.MountSerial < B.MountSerial;
+      }
+
       // Sort packs by priority (highest first)
       void SortPacks()
       {
-        std::sort(Packs.begin(), Packs.end(), [](const MountedPack& A, const MountedPack& B) { return A.Options.Priority > B.Options.Priority; });
+        Packs.sort(Outranks);
       }
 
-      // Find which pack contains an asset by ID (respects priority order)
-      std::pair<AssetPackReader*, const MountedPack*> FindPackForAsset(AssetId Id) const
+      static uint64_t HashName(const std::string_view Name)
       {
-        for (const auto& Pack : Packs)
+        return XXH3_64bits(Name.data(), Name.size());
+      }
+
+      // Hash of MountPoint + Name; Scratch holds the concatenation when there is a mount point
+      static uint64_t HashMountedName(const std::string_view MountPoint, const std::string_view Name, std::string& Scratch)
+      {
+        if (MountPoint.empty())
         {
-          auto Result = Pack.Reader->FindAsset(Id);
-          if (Result.has_value())
+          return HashName(Name);
+        }
+        Scratch.assign(MountPoint).append(Name);
+        return HashName(Scratch);
+      }
+
+      // A1 + A2 == B1 + B2
+      static bool ConcatEquals(std::string_view A1, std::string_view A2, std::string_view B1, std::string_view B2)
+      {
+        if (A1.size() + A2.size() != B1.size() + B2.size())
+        {
+          return false;
+        }
+        if (A1.size() > B1.size())
+        {
+          std::swap(A1, B1);
+          std::swap(A2, B2);
+        }
+        const std::string_view Middle = B1.substr(A1.size());
+        return B1.starts_with(A1) && A2.starts_with(Middle) && A2.substr(Middle.size()) == B2;
+      }
+
+      // Record Location for Key unless a higher-ranked pack already holds it. Within one pack the
+      // first entry wins, as in the pack's own lookups.
+      template <typename MapType, typename KeyType>
+      static void OfferLocation(MapType& Map, const KeyType& Key, const AssetLocation Location)
+      {
+        const auto [It, bAdded] = Map.try_emplace(Key, Location);
+        if (!bAdded && It->second.Pack != Location.Pack && Outranks(*Location.Pack, *It->second.Pack))
+        {
+          It->second = Location;
+        }
+      }
+
+      // Add the assets of a newly mounted (or reloaded) pack to the unified index
+      void IndexPack(const MountedPack& Pack)
+      {
+        const AssetPackReader& Reader = *Pack.Reader;
+        const uint32_t Count = Reader.GetAssetCount();
+        std::string Scratch;
+        for (uint32_t Index = 0; Index < Count; ++Index)
+        {
+          OfferLocation(AssetsById, Reader.GetAssetId(Index), AssetLocation{&Pack, Index});
+
+          const std::string_view Name = Reader.GetAssetName(Index);
+          const uint64_t NameHash = HashMountedName(Pack.Options.MountPoint, Name, Scratch);
+          if (!bNameHashCollision)
           {
-            return {Pack.Reader.get(), &Pack};
+            // Detect a different name already holding the hash before it may be replaced
+            if (const auto It = AssetsByNameHash.find(NameHash); It != AssetsByNameHash.end())
+            {
+              const MountedPack& Holder = *It->second.Pack;
+              bNameHashCollision =
+                  !ConcatEquals(Pack.Options.MountPoint, Name, Holder.Options.MountPoint, Holder.Reader->GetAssetName(It->second.Index));
+            }
           }
+          OfferLocation(AssetsByNameHash, NameHash, AssetLocation{&Pack, Index});
         }
-        return {nullptr, nullptr};
       }
 
-      // Find which pack contains an asset by name (respects priority order)
-      std::tuple<AssetPackReader*, AssetInfo, const MountedPack*> FindPackForAssetByName(const std::string& Name) const
+      // Remove the assets of Pack from the unified index, handing each one it won to the
+      // next-ranked pack that has it. Pack may still be in Packs; it is skipped.
+      void UnindexPack(const MountedPack& Pack)
       {
-        for (const auto& Pack : Packs)
+        const AssetPackReader& Reader = *Pack.Reader;
+        std::string MountedName;
+        for (uint32_t Index = 0; Index < Reader.GetAssetCount(); ++Index)
         {
-          // Apply mount point prefix if needed
-          std::string LookupName = Name;
-          if (!Pack.Options.MountPoint.empty())
+          const AssetId Id = Reader.GetAssetId(Index);
+          if (const auto It = AssetsById.find(Id); It != AssetsById.end() && It->second.Pack == &Pack)
           {
-            if (Name.find(Pack.Options.MountPoint) == 0)
+            AssetsById.erase(It);
+            for (const MountedPack& Other : Packs)
             {
-              LookupName = Name.substr(Pack.Options.MountPoint.length());
+              if (&Other == &Pack)
+              {
+                continue;
+              }
+              if (const auto OtherIndex = Other.Reader->FindAssetIndex(Id))
+              {
+                AssetsById.emplace(Id, AssetLocation{&Other, *OtherIndex});
+                break;
+              }
             }
-            else
+          }
+
+          const std::string_view Name = Reader.GetAssetName(Index);
+          MountedName.assign(Pack.Options.MountPoint).append(Name);
+          const uint64_t NameHash = HashName(MountedName);
+          if (const auto It = AssetsByNameHash.find(NameHash); It != AssetsByNameHash.end() && It->second.Pack == &Pack)
+          {
+            AssetsByNameHash.erase(It);
+            for (const MountedPack& Other : Packs)
             {
-              continue; // Name doesn't match this pack's mount point
+              if (&Other == &Pack || !MountedName.starts_with(Other.Options.MountPoint))
+              {
+                continue;
+              }
+              if (const auto OtherIndex = Other.Reader->FindAssetIndexByName(std::string_view(MountedName).substr(Other.Options.MountPoint.size())))
+              {
+                AssetsByNameHash.emplace(NameHash, AssetLocation{&Other, *OtherIndex});
+                break;
+              }
             }
           }
+        }
+      }
+
+      // Find which pack contains an asset by ID (respects priority order)
+      std::pair<AssetPackReader*, const MountedPack*> FindPackForAsset(AssetId Id) const
+      {
+        const auto It = AssetsById.find(Id);
+        if (It == AssetsById.end())
+        {
+          return {nullptr, nullptr};
+        }
+        return {It->second.Pack->Reader.get(), It->second.Pack};
+      }
 
-          auto Results = Pack.Reader->FindAssetsByName(LookupName);
-          if (!Results.empty())
+      // True when lookups by Id resolve to entry Index of Pack, i.e. the entry is not shadowed by
+      // a higher-ranked pack or an earlier entry of the same pack
+      bool IsResolvedLocation(const MountedPack& Pack, const uint32_t Index, const AssetId Id) const
+      {
+        const auto It = AssetsById.find(Id);
+        return It != AssetsById.end() && It->second.Pack == &Pack && It->second.Index == Index;
+      }
+
+      // Find which pack entry an asset name resolves to (respects priority order) without
+      // materializing anything
+      std::optional<AssetLocation> FindPackLocationByName(const std::string_view Name) const
+      {
+        const auto It = AssetsByNameHash.find(HashName(Name));
+        if (It == AssetsByNameHash.end())
+        {
+          // A colliding name may have lost its slot when the pack holding it was unmounted
+          return bNameHashCollision ? ScanPacksForLocationByName(Name) : std::nullopt;
+        }
+
+        const MountedPack& Pack = *It->second.Pack;
+        const std::string& MountPoint = Pack.Options.MountPoint;
+        if (Name.starts_with(MountPoint) && Name.substr(MountPoint.size()) == Pack.Reader->GetAssetName(It->second.Index))
+        {
+          return It->second;
+        }
+        // Another name with the same hash holds the slot
+        return ScanPacksForLocationByName(Name);
+      }
+
+      std::optional<AssetLocation> ScanPacksForLocationByName(const std::string_view Name) const
+      {
+        for (const auto& Pack : Packs)
+        {
+          // Strip the mount point; names outside it are not in this pack
+          if (!Name.starts_with(Pack.Options.MountPoint))
           {
-            return {Pack.Reader.get(), Results[0], &Pack};
+            continue;
+          }
+          if (const auto Index = Pack.Reader->FindAssetIndexByName(Name.substr(Pack.Options.MountPoint.size())))
+          {
+            return AssetLocation{&Pack, *Index};
           }
         }
-        return {nullptr, {}, nullptr};
+        return std::nullopt;
+      }
+
+      // Find which pack contains an asset by name (respects priority order)
+      std::tuple<AssetPackReader*, AssetInfo, const MountedPack*> FindPackForAssetByName(const std::string_view Name) const
+      {
+        const auto Location = FindPackLocationByName(Name);
+        if (!Location.has_value())
+        {
+          return {nullptr, {}, nullptr};
+        }
+        auto Info = Location->Pack->Reader->GetAssetInfo(Location->Index);
+        if (!Info.has_value())
+        {
+          return {nullptr, {}, nullptr};
+        }
+        return {Location->Pack->Reader.get(), std::move(*Info), Location->Pack};
       }
 
       bool TryFindRuntimeAssetById(const AssetId Id, CookedAsset& OutAsset) const
@@ -273,7 +455,7 @@ namespace SnAPI::AssetPipeline
     }
 
     auto Reader = std::make_unique<AssetPackReader>();
-    auto Result = Reader->Open(Path, Options.ReadOptions);
+    auto Result = Reader->Open(Path, Impl::MakeReadOptions(Options));
     if (!Result.has_value())
     {
       return std::unexpected(Result.error());
@@ -283,6 +465,7 @@ namespace SnAPI::AssetPipeline
     Pack.Path = Path;
     Pack.Options = Options;
     Pack.Reader = std::move(Reader);
+    Pack.MountSerial = m_Impl->NextMountSerial++;
 
     // Track modification time for hot reload
     try
@@ -294,8 +477,9 @@ namespace SnAPI::AssetPipeline
       // Ignore errors getting mod time
     }
 
-    m_Impl->Packs.push_back(std::move(Pack));
+    const MountedPack& Mounted = m_Impl->Packs.emplace_back(std::move(Pack));
     m_Impl->SortPacks();
+    m_Impl->IndexPack(Mounted);
 
     return {};
   }
@@ -306,12 +490,16 @@ namespace SnAPI::AssetPipeline
 
     if (It != m_Impl->Packs.end())
     {
+      m_Impl->UnindexPack(*It);
       m_Impl->Packs.erase(It);
     }
   }
 
   void AssetManager::UnmountAll()
   {
+    m_Impl->AssetsById.clear();
+    m_Impl->AssetsByNameHash.clear();
+    m_Impl->bNameHashCollision = false;
     m_Impl->Packs.clear();
   }
 
@@ -409,26 +597,18 @@ namespace SnAPI::AssetPipeline
 
     for (const auto& Pack : m_Impl->Packs)
     {
-      std::string LookupName = Name;
-      if (!Pack.Options.MountPoint.empty())
+      if (!Name.starts_with(Pack.Options.MountPoint))
       {
-        if (Name.find(Pack.Options.MountPoint) == 0)
-        {
-          LookupName = Name.substr(Pack.Options.MountPoint.length());
-        }
-        else
-        {
-          continue;
-        }
+        continue;
       }
 
-      auto Variants = Pack.Reader->FindAssetsByName(LookupName);
-      for (const auto& Variant : Variants)
+      auto Variants = Pack.Reader->FindAssetsByName(std::string_view(Name).substr(Pack.Options.MountPoint.size()));
+      for (auto& Variant : Variants)
       {
         if (std::find_if(AllVariants.begin(), AllVariants.end(), [&Variant](const AssetInfo& Existing) { return Existing.Id == Variant.Id; }) ==
             AllVariants.end())
         {
-          AllVariants.push_back(Variant);
+          AllVariants.push_back(std::move(Variant));
         }
       }
     }
@@ -439,27 +619,32 @@ namespace SnAPI::AssetPipeline
   std::vector<AssetInfo> AssetManager::ListAssets() const
   {
     std::vector<AssetInfo> AllAssets;
-    std::unordered_set<AssetId, UuidHash> SeenIds;
+    std::unordered_set<AssetId, UuidHash> RuntimeIds;
 
     {
       std::lock_guard Lock(m_Impl->RuntimeAssetsMutex);
       AllAssets.reserve(m_Impl->RuntimeAssetsById.size());
       for (const auto& [Id, Asset] : m_Impl->RuntimeAssetsById)
       {
-        SeenIds.insert(Id);
+        RuntimeIds.insert(Id);
         AllAssets.push_back(ToAssetInfo(Asset));
       }
     }
 
+    // Shadowed pack entries are skipped through the unified index before anything is copied
     for (const auto& Pack : m_Impl->Packs)
     {
       for (uint32_t I = 0; I < Pack.Reader->GetAssetCount(); ++I)
       {
+        const AssetId Id = Pack.Reader->GetAssetId(I);
+        if (RuntimeIds.contains(Id) || !m_Impl->IsResolvedLocation(Pack, I, Id))
+        {
+          continue;
+        }
         auto Info = Pack.Reader->GetAssetInfo(I);
-        if (Info.has_value() && !SeenIds.contains(Info->Id))
+        if (Info.has_value())
         {
-          SeenIds.insert(Info->Id);
-          AllAssets.push_back(*Info);
+          AllAssets.push_back(std::move(*Info));
         }
       }
     }
@@ -470,14 +655,14 @@ namespace SnAPI::AssetPipeline
   std::vector<AssetCatalogEntry> AssetManager::ListAssetCatalog() const
   {
     std::vector<AssetCatalogEntry> Entries;
-    std::unordered_set<AssetId, UuidHash> SeenIds;
+    std::unordered_set<AssetId, UuidHash> RuntimeIds;
 
     {
       std::lock_guard Lock(m_Impl->RuntimeAssetsMutex);
       Entries.reserve(m_Impl->RuntimeAssetsById.size() + m_Impl->Packs.size() * 8u);
       for (const auto& [Id, Asset] : m_Impl->RuntimeAssetsById)
       {
-        SeenIds.insert(Id);
+        RuntimeIds.insert(Id);
         AssetCatalogEntry Entry{};
         Entry.Info = ToAssetInfo(Asset);
         Entry.Origin = EAssetOrigin::RuntimeMemory;
@@ -491,15 +676,19 @@ namespace SnAPI::AssetPipeline
     {
       for (uint32_t I = 0; I < Pack.Reader->GetAssetCount(); ++I)
       {
+        const AssetId Id = Pack.Reader->GetAssetId(I);
+        if (RuntimeIds.contains(Id) || !m_Impl->IsResolvedLocation(Pack, I, Id))
+        {
+          continue;
+        }
         auto Info = Pack.Reader->GetAssetInfo(I);
-        if (!Info.has_value() || SeenIds.contains(Info->Id))
+        if (!Info.has_value())
         {
           continue;
         }
 
-        SeenIds.insert(Info->Id);
         AssetCatalogEntry Entry{};
-        Entry.Info = *Info;
+        Entry.Info = std::move(*Info);
         Entry.Origin = EAssetOrigin::Pack;
         Entry.Dirty = false;
         Entry.CanSave = true;
@@ -511,6 +700,29 @@ namespace SnAPI::AssetPipeline
     return Entries;
   }
 
+  void AssetManager::ForEachPackAsset(const PackAssetVisitor& Visit) const
+  {
+    for (const auto& Pack : m_Impl->Packs)
+    {
+      for (uint32_t I = 0; I < Pack.Reader->GetAssetCount(); ++I)
+      {
+        const auto Info = Pack.Reader->GetAssetInfoView(I);
+        if (!Info.has_value() || !m_Impl->IsResolvedLocation(Pack, I, Info->Id))
+        {
+          continue;
+        }
+        {
+          std::lock_guard Lock(m_Impl->RuntimeAssetsMutex);
+          if (m_Impl->RuntimeAssetsById.contains(Info->Id))
+          {
+            continue;
+          }
+        }
+        Visit(*Info, Pack.Path);
+      }
+    }
+  }
+
   std::expected<AssetCatalogEntry, std::string> AssetManager::FindAssetCatalog(const std::string& Name) const
   {
     CookedAsset RuntimeAsset{};
@@ -632,6 +844,13 @@ namespace SnAPI::AssetPipeline
     AssetLoadContext Context{.Cooked = CookedPayload,
                              .Info = Info,
                              .LoadBulk = [Reader, Id = Info.Id](uint32_t Index) { return Reader->LoadBulkChunk(Id, Index); },
+                             .LoadBulkView = [Reader, Id = Info.Id](uint32_t Index) { return Reader->LoadBulkChunkView(Id, Index); },
+                             .LoadBulkInto = [Reader, Id = Info.Id](uint32_t Index, std::span<uint8_t> Output) {
+                               return Reader->LoadBulkChunk(Id, Index, Output);
+                             },
+                             .LoadBulkViews = [Reader, Id = Info.Id](std::span<const uint32_t> Indices, uint32_t MaxThreads) {
+                               return Reader->LoadBulkChunks(Id, Indices, MaxThreads);
+                             },
                              .GetBulkInfo = [Reader, Id = Info.Id](uint32_t Index) { return Reader->GetBulkChunkInfo(Id, Index); },
                              .Registry = m_Impl->Engine->GetRegistry(),
                              .Manager = this,
@@ -691,6 +910,13 @@ namespace SnAPI::AssetPipeline
     AssetLoadContext Context{.Cooked = CookedPayload,
                              .Info = Info,
                              .LoadBulk = [Reader, Id](uint32_t Index) { return Reader->LoadBulkChunk(Id, Index); },
+                             .LoadBulkView = [Reader, Id](uint32_t Index) { return Reader->LoadBulkChunkView(Id, Index); },
+                             .LoadBulkInto = [Reader, Id](uint32_t Index, std::span<uint8_t> Output) {
+                               return Reader->LoadBulkChunk(Id, Index, Output);
+                             },
+                             .LoadBulkViews = [Reader, Id](std::span<const uint32_t> Indices, uint32_t MaxThreads) {
+                               return Reader->LoadBulkChunks(Id, Indices, MaxThreads);
+                             },
                              .GetBulkInfo = [Reader, Id](uint32_t Index) { return Reader->GetBulkChunkInfo(Id, Index); },
                              .Registry = m_Impl->Engine->GetRegistry(),
                              .Manager = this,
@@ -700,6 +926,63 @@ namespace SnAPI::AssetPipeline
     return InvokeFactoryLoad(*Factory, Context, Info);
   }
 
+  AssetManager::PackReadPlan AssetManager::GetPackReadPlan(const std::string& Name) const
+  {
+    {
+      std::lock_guard Lock(m_Impl->RuntimeAssetsMutex);
+      if (m_Impl->RuntimeAssetNameToId.contains(Name))
+      {
+        return {};
+      }
+    }
+
+    const auto Location = m_Impl->FindPackLocationByName(Name);
+    if (!Location.has_value())
+    {
+      return {};
+    }
+
+    const AssetPackReader& Reader = *Location->Pack->Reader;
+    auto Ranges = Reader.GetAssetFileRanges(Reader.GetAssetId(Location->Index), true);
+    if (!Ranges.has_value())
+    {
+      return {};
+    }
+    if (Ranges->empty())
+    {
+      return {Location->Pack->Path};
+    }
+    return {Location->Pack->Path, std::move(*Ranges), Reader.DuplicateFileDescriptor(), Reader.GetOpenSerial()};
+  }
+
+  AssetManager::PackReadPlan AssetManager::GetPackReadPlan(AssetId Id) const
+  {
+    {
+      std::lock_guard Lock(m_Impl->RuntimeAssetsMutex);
+      if (m_Impl->RuntimeAssetsById.contains(Id))
+      {
+        return {};
+      }
+    }
+
+    auto [Reader, Pack] = m_Impl->FindPackForAsset(Id);
+    if (!Reader)
+    {
+      return {};
+    }
+
+    auto Ranges = Reader->GetAssetFileRanges(Id, true);
+    if (!Ranges.has_value())
+    {
+      return {};
+    }
+    if (Ranges->empty())
+    {
+      return {Pack->Path};
+    }
+    return {Pack->Path, std::move(*Ranges), Reader->DuplicateFileDescriptor(), Reader->GetOpenSerial()};
+  }
+
   std::expected<AssetId, std::string> AssetManager::ResolveAssetId(const std::string& Name, std::type_index RuntimeType)
   {
     auto Result = FindAsset(Name);
@@ -766,15 +1049,18 @@ namespace SnAPI::AssetPipeline
   {
     (void)RuntimeType;
 
-    CookedAsset RuntimeAsset{};
-    if (m_Impl->TryFindRuntimeAssetById(Id, RuntimeAsset))
     {
-      size_t TotalSize = RuntimeAsset.Cooked.Bytes.size();
-      for (const auto& Chunk : RuntimeAsset.Bulk)
+      // Measure runtime assets in place rather than copying their bytes out
+      std::lock_guard Lock(m_Impl->RuntimeAssetsMutex);
+      if (const auto It = m_Impl->RuntimeAssetsById.find(Id); It != m_Impl->RuntimeAssetsById.end())
       {
-        TotalSize += Chunk.Bytes.size();
+        size_t TotalSize = It->second.Cooked.Bytes.size();
+        for (const auto& Chunk : It->second.Bulk)
+        {
+          TotalSize += Chunk.Bytes.size();
+        }
+        return TotalSize > 0 ? TotalSize : 1024;
       }
-      return TotalSize > 0 ? TotalSize : 1024;
     }
 
     // Try to get size from asset info
@@ -784,7 +1070,7 @@ namespace SnAPI::AssetPipeline
       return 0;
     }
 
-    auto Info = Reader->FindAsset(Id);
+    const auto Info = Reader->FindAssetView(Id);
     if (!Info.has_value())
     {
       return 0;
@@ -862,7 +1148,7 @@ namespace SnAPI::AssetPipeline
   {
     if (!m_Impl->Loader)
     {
-      m_Impl->Loader = std::make_unique<AsyncLoader>(*this, m_Impl->Config.AsyncLoaderThreads);
+      m_Impl->Loader = std::make_unique<AsyncLoader>(*this, m_Impl->Config.AsyncLoaderThreads, m_Impl->Config.AsyncLoaderIoQueueDepth);
     }
     return *m_Impl->Loader;
   }
@@ -897,7 +1183,7 @@ namespace SnAPI::AssetPipeline
         {
           // Pack file changed - reload it
           auto NewReader = std::make_unique<AssetPackReader>();
-          auto Result = NewReader->Open(Pack.Path);
+          auto Result = NewReader->Open(Pack.Path, Impl::MakeReadOptions(Pack.Options));
           if (Result.has_value())
           {
             // Collect asset IDs that were in this pack
@@ -914,8 +1200,10 @@ namespace SnAPI::AssetPipeline
               }
             }
 
+            m_Impl->UnindexPack(Pack);
             Pack.Reader = std::move(NewReader);
             Pack.LastModified = CurrentModTime;
+            m_Impl->IndexPack(Pack);
             ReloadedPacks.push_back(Pack.Path);
           }
         }
@@ -1,7 +1,11 @@
 #include "AsyncLoader.h"
 #include "AssetManager.h"
+#include "Pack/IoUring.h"
 
 #include <algorithm>
+#include <array>
+#include <deque>
+#include <optional>
 
 namespace SnAPI::AssetPipeline
 {
@@ -61,7 +65,340 @@ namespace SnAPI::AssetPipeline
     return Linked;
   }
 
-  AsyncLoader::AsyncLoader(AssetManager& Manager, uint32_t NumThreads) : m_Manager(Manager)
+  // Reads the pack chunks of queued loads through io_uring before handing the requests to the
+  // workers. Every planned range is read into its own buffer; the buffers travel with the request
+  // (LoadRequest::StagedReads) and the worker decodes from them instead of faulting the mapping in.
+  // Reads go through a duplicate of the mounted reader's descriptor, so they hit the file that
+  // reader maps even if the path has been replaced, and the descriptor is closed with the request.
+  // Reads are submitted from the thread calling LoadAsync; one completion thread reaps them and
+  // dispatches each request once all of its reads have finished. A range whose read fails is
+  // dropped and loaded through the mapping as usual, which reports any real error.
+  struct AsyncLoader::IoStage
+  {
+      static constexpr uint32_t kMaxReadSize = 1u << 20;
+      // Staged bytes not yet released by their loads; further loads skip the stage beyond this
+      static constexpr uint64_t kMaxStagedBytes = 256ull << 20;
+      // Completion user data is (request id << kReadIndexBits) | read index
+      static constexpr uint32_t kReadIndexBits = 24;
+      static constexpr uint64_t kWakeUserData = ~0ull;
+
+      struct StagedRead
+      {
+          uint64_t Offset = 0;
+          uint32_t Size = 0;
+          uint8_t* Target = nullptr;
+          uint32_t Range = 0; // index into StagedRequest::Staged->Ranges
+      };
+
+      struct StagedRequest
+      {
+          LoadRequest Request;
+          std::shared_ptr<const int> File;
+          std::shared_ptr<PackStagedReads> Staged;
+          std::vector<StagedRead> Reads;
+          std::vector<bool> FailedRanges;
+          size_t NextRead = 0;
+          uint32_t InFlight = 0;
+      };
+
+      AsyncLoader& Loader;
+      // Descriptors and buffers of requests released while their reads were in flight; declared
+      // before Queue so they outlive the ring
+      std::vector<std::pair<std::shared_ptr<const int>, std::shared_ptr<PackStagedReads>>> Abandoned;
+      std::unique_ptr<Pack::IoUringQueue> Queue;
+      uint32_t MaxInFlight = 0;
+      // Shared with the buffer deleters, which may run after the stage is gone (views keep buffers alive)
+      std::shared_ptr<std::atomic<uint64_t>> StagedBytes = std::make_shared<std::atomic<uint64_t>>(0);
+
+      mutable std::mutex Mutex;
+      std::unordered_map<uint64_t, StagedRequest> Staged;
+      std::deque<uint64_t> Backlog; // staged requests with reads not yet queued
+      std::vector<uint64_t> Finished; // staged requests ready for dispatch
+      uint32_t InFlight = 0;
+      bool bStopping = false;
+      bool bFailed = false;
+      std::thread CompletionThread;
+
+      IoStage(AsyncLoader& InLoader, std::unique_ptr<Pack::IoUringQueue> InQueue) : Loader(InLoader), Queue(std::move(InQueue))
+      {
+        // Keep one submission slot free for the shutdown wake-up
+        MaxInFlight = std::max(1u, Queue->GetQueueDepth() - 1);
+        CompletionThread = std::thread(&IoStage::CompletionLoop, this);
+      }
+
+      // Buffer for one staged range; its size is counted against kMaxStagedBytes until released
+      std::shared_ptr<uint8_t[]> AllocateBuffer(const uint64_t Size) const
+      {
+        StagedBytes->fetch_add(Size, std::memory_order_relaxed);
+        auto Buffer = std::make_unique_for_overwrite<uint8_t[]>(static_cast<size_t>(Size));
+        return std::shared_ptr<uint8_t[]>(Buffer.release(), [Counter = StagedBytes, Size](const uint8_t* Bytes) {
+          delete[] Bytes;
+          Counter->fetch_sub(Size, std::memory_order_relaxed);
+        });
+      }
+
+      // Returns false when the request should go straight to the workers
+      bool Stage(LoadRequest& Req, AssetManager::PackReadPlan& Plan)
+      {
+        if (!Plan.File)
+        {
+          return false;
+        }
+
+        uint64_t PlanBytes = 0;
+        for (const auto& Range : Plan.Ranges)
+        {
+          PlanBytes += Range.Size;
+        }
+        if (PlanBytes == 0 || PlanBytes > kMaxStagedBytes - std::min(kMaxStagedBytes, StagedBytes->load(std::memory_order_relaxed)))
+        {
+          return false;
+        }
+
+        StagedRequest Entry;
+        Entry.File = std::move(Plan.File);
+        Entry.Staged = std::make_shared<PackStagedReads>();
+        Entry.Staged->ReaderSerial = Plan.ReaderSerial;
+        for (const auto& Range : Plan.Ranges)
+        {
+          auto Buffer = AllocateBuffer(Range.Size);
+          const auto RangeIndex = static_cast<uint32_t>(Entry.Staged->Ranges.size());
+          for (uint64_t Offset = 0; Offset < Range.Size; Offset += kMaxReadSize)
+          {
+            Entry.Reads.push_back({Range.Offset + Offset, static_cast<uint32_t>(std::min<uint64_t>(kMaxReadSize, Range.Size - Offset)),
+                                   Buffer.get() + Offset, RangeIndex});
+          }
+          Entry.Staged->Ranges.push_back({Range.Offset, Range.Size, std::move(Buffer)});
+        }
+        if (Entry.Reads.size() >= (1ull << kReadIndexBits))
+        {
+          return false;
+        }
+        Entry.FailedRanges.assign(Entry.Staged->Ranges.size(), false);
+
+        std::vector<LoadRequest> Ready;
+        {
+          std::lock_guard Lock(Mutex);
+          if (bStopping || bFailed)
+          {
+            return false;
+          }
+
+          const uint64_t Id = Req.Id;
+          Entry.Request = std::move(Req);
+          Staged.emplace(Id, std::move(Entry));
+          Backlog.push_back(Id);
+          QueueReads();
+          bFailed = !Queue->Submit().has_value();
+          if (bFailed)
+          {
+            ReleaseAll(Ready);
+          }
+          CollectFinished(Ready);
+        }
+
+        for (auto& ReadyReq : Ready)
+        {
+          Loader.DispatchToWorkers(std::move(ReadyReq));
+        }
+        return true;
+      }
+
+      // Caller holds Mutex
+      void QueueReads()
+      {
+        while (!Backlog.empty() && InFlight < MaxInFlight)
+        {
+          const uint64_t Id = Backlog.front();
+          StagedRequest& Entry = Staged.at(Id);
+          if (Entry.Request.Token.IsCancelled())
+          {
+            // Skip the remaining reads; the request is dispatched once queued reads finish
+            Entry.NextRead = Entry.Reads.size();
+          }
+          else
+          {
+            const StagedRead& Read = Entry.Reads[Entry.NextRead];
+            if (!Queue->QueueRead(*Entry.File, Read.Offset, Read.Target, Read.Size, (Id << kReadIndexBits) | Entry.NextRead))
+            {
+              return;
+            }
+            ++Entry.NextRead;
+            ++Entry.InFlight;
+            ++InFlight;
+          }
+
+          if (Entry.NextRead == Entry.Reads.size())
+          {
+            Backlog.pop_front();
+            if (Entry.InFlight == 0)
+            {
+              // Cancelled before its first read
+              Finished.push_back(Id);
+            }
+          }
+        }
+      }
+
+      // Caller holds Mutex. Moves requests whose reads are complete out of the stage.
+      void CollectFinished(std::vector<LoadRequest>& Out)
+      {
+        for (const uint64_t Id : Finished)
+        {
+          auto It = Staged.find(Id);
+          StagedRequest& Entry = It->second;
+          if (Entry.NextRead == Entry.Reads.size() && !Entry.Request.Token.IsCancelled())
+          {
+            // Failed ranges are loaded through the mapping instead
+            auto& Ranges = Entry.Staged->Ranges;
+            for (size_t Range = Ranges.size(); Range-- > 0;)
+            {
+              if (Entry.FailedRanges[Range])
+              {
+                Ranges.erase(Ranges.begin() + static_cast<std::ptrdiff_t>(Range));
+              }
+            }
+            if (!Ranges.empty())
+            {
+              Entry.Request.StagedReads = std::move(Entry.Staged);
+            }
+          }
+          Out.push_back(std::move(Entry.Request));
+          Staged.erase(It);
+        }
+        Finished.clear();
+      }
+
+      // Caller holds Mutex. Hands every staged request to the workers without waiting for reads
+      // (and without its staged bytes, which may still be incomplete); used once the ring has
+      // failed and no further completions can be relied on.
+      void ReleaseAll(std::vector<LoadRequest>& Out)
+      {
+        for (auto& [Id, Entry] : Staged)
+        {
+          Out.push_back(std::move(Entry.Request));
+          if (Entry.InFlight > 0)
+          {
+            Abandoned.emplace_back(std::move(Entry.File), std::move(Entry.Staged));
+          }
+        }
+        Staged.clear();
+        Backlog.clear();
+        Finished.clear();
+      }
+
+      void CompletionLoop()
+      {
+        std::array<Pack::IoUringQueue::Completion, 64> Completions{};
+        while (true)
+        {
+          const bool bWaitFailed = !Queue->WaitForCompletion().has_value();
+
+          std::vector<LoadRequest> Ready;
+          bool bExit = false;
+          {
+            std::lock_guard Lock(Mutex);
+            const size_t Count = Queue->ReapCompletions(Completions);
+            for (size_t I = 0; I < Count; ++I)
+            {
+              const uint64_t UserData = Completions[I].UserData;
+              if (UserData == kWakeUserData)
+              {
+                continue;
+              }
+              const uint64_t Id = UserData >> kReadIndexBits;
+              const auto It = Staged.find(Id);
+              if (It == Staged.end())
+              {
+                continue;
+              }
+              StagedRequest& Entry = It->second;
+              const StagedRead& Read = Entry.Reads[static_cast<size_t>(UserData & ((1ull << kReadIndexBits) - 1))];
+              if (Completions[I].Result != static_cast<int32_t>(Read.Size))
+              {
+                Entry.FailedRanges[Read.Range] = true;
+              }
+              --InFlight;
+              if (--Entry.InFlight == 0 && Entry.NextRead == Entry.Reads.size())
+              {
+                Finished.push_back(Id);
+              }
+            }
+
+            bFailed = bFailed || bWaitFailed;
+            if (!bFailed)
+            {
+              QueueReads();
+              bFailed = !Queue->Submit().has_value();
+            }
+
+            if (bFailed)
+            {
+              ReleaseAll(Ready);
+              bExit = true;
+            }
+            else if (bStopping)
+            {
+              // Queue nothing further; release everything that is not waiting on a read
+              for (const uint64_t Id : Backlog)
+              {
+                StagedRequest& Entry = Staged.at(Id);
+                Entry.NextRead = Entry.Reads.size();
+                if (Entry.InFlight == 0)
+                {
+                  Finished.push_back(Id);
+                }
+              }
+              Backlog.clear();
+              bExit = InFlight == 0;
+            }
+            CollectFinished(Ready);
+          }
+
+          for (auto& Req : Ready)
+          {
+            Loader.DispatchToWorkers(std::move(Req));
+          }
+          if (bExit)
+          {
+            return;
+          }
+        }
+      }
+
+      void Stop()
+      {
+        {
+          std::lock_guard Lock(Mutex);
+          bStopping = true;
+          if (Queue->QueueNop(kWakeUserData))
+          {
+            bFailed = !Queue->Submit().has_value() || bFailed;
+          }
+        }
+        if (CompletionThread.joinable())
+        {
+          CompletionThread.join();
+        }
+      }
+
+      uint32_t GetStagedCount() const
+      {
+        std::lock_guard Lock(Mutex);
+        return static_cast<uint32_t>(Staged.size());
+      }
+
+      void CancelAll()
+      {
+        std::lock_guard Lock(Mutex);
+        for (auto& [Id, Entry] : Staged)
+        {
+          Entry.Request.Token.Cancel();
+        }
+      }
+  };
+
+  AsyncLoader::AsyncLoader(AssetManager& Manager, uint32_t NumThreads, const uint32_t IoQueueDepth) : m_Manager(Manager)
   {
     if (NumThreads == 0)
     {
@@ -73,6 +410,16 @@ namespace SnAPI::AssetPipeline
     {
       m_Workers.emplace_back(&AsyncLoader::WorkerThread, this);
     }
+
+    if (IoQueueDepth > 0)
+    {
+      // Without io_uring (other platforms, old kernels, sandboxed processes) loads read through mmap
+      auto Queue = Pack::IoUringQueue::Create(std::max(2u, IoQueueDepth));
+      if (Queue.has_value())
+      {
+        m_IoStage = std::make_unique<IoStage>(*this, std::move(*Queue));
+      }
+    }
   }
 
   AsyncLoader::~AsyncLoader()
@@ -115,9 +462,14 @@ namespace SnAPI::AssetPipeline
         continue;
       }
 
-      // Perform the load
+      // Perform the load, decoding the chunks the read stage fetched from its buffers
       void* ResultPtr = nullptr;
       std::string Error;
+      std::optional<ScopedPackStagedReads> StagedScope;
+      if (Req.StagedReads)
+      {
+        StagedScope.emplace(*Req.StagedReads);
+      }
 
       try
       {
@@ -191,6 +543,28 @@ namespace SnAPI::AssetPipeline
     return m_NextRequestId.fetch_add(1);
   }
 
+  void AsyncLoader::Enqueue(LoadRequest Req)
+  {
+    if (m_IoStage && !Req.Token.IsCancelled())
+    {
+      auto Plan = Req.Name.empty() ? m_Manager.GetPackReadPlan(Req.TargetAssetId) : m_Manager.GetPackReadPlan(Req.Name);
+      if (!Plan.Ranges.empty() && m_IoStage->Stage(Req, Plan))
+      {
+        return;
+      }
+    }
+    DispatchToWorkers(std::move(Req));
+  }
+
+  void AsyncLoader::DispatchToWorkers(LoadRequest Req)
+  {
+    {
+      std::lock_guard Lock(m_QueueMutex);
+      m_Queue.push(std::move(Req));
+    }
+    m_QueueCV.notify_one();
+  }
+
   void AsyncLoader::Wait(const AsyncLoadHandle& Handle)
   {
     if (!Handle.IsValid())
@@ -237,6 +611,12 @@ namespace SnAPI::AssetPipeline
 
   void AsyncLoader::CancelAll()
   {
+    if (m_IoStage)
+    {
+      // Staged loads skip their remaining reads and complete as cancelled on a worker
+      m_IoStage->CancelAll();
+    }
+
     std::lock_guard Lock(m_QueueMutex);
 
     // Cancel all queued requests
@@ -255,8 +635,9 @@ namespace SnAPI::AssetPipeline
 
   uint32_t AsyncLoader::GetPendingCount() const
   {
+    const uint32_t Staged = m_IoStage ? m_IoStage->GetStagedCount() : 0;
     std::lock_guard Lock(m_QueueMutex);
-    return static_cast<uint32_t>(m_Queue.size());
+    return static_cast<uint32_t>(m_Queue.size()) + Staged;
   }
 
   uint32_t AsyncLoader::GetCompletedCount() const
@@ -264,6 +645,11 @@ namespace SnAPI::AssetPipeline
     return m_CompletedCount.load();
   }
 
+  bool AsyncLoader::IsUsingIoUring() const
+  {
+    return m_IoStage != nullptr;
+  }
+
   uint32_t AsyncLoader::ProcessCompletedCallbacks()
   {
     std::vector<CompletedCallback> Callbacks;
@@ -283,6 +669,12 @@ namespace SnAPI::AssetPipeline
 
   void AsyncLoader::Shutdown()
   {
+    // Drain the read stage first so every staged request reaches the workers
+    if (m_IoStage)
+    {
+      m_IoStage->Stop();
+    }
+
     m_Shutdown.store(true);
     m_QueueCV.notify_all();
 
@@ -0,0 +1,259 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "AssetPackReader.h"
+#include "AssetPackWriter.h"
+#include "Uuid.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace SnAPI::AssetPipeline;
+
+// Pack benchmarks are hidden from the default test run. Run them explicitly with
+//   SnAPI.AssetPipeline.Tests "[benchmark]"
+// SNAPI_BENCH_PACK_MB controls the amount of payload data generated (default: 2048).
+
+namespace
+{
+    size_t GetBenchmarkPackBytes()
+    {
+        size_t Megabytes = 2048;
+        if (const char* Value = std::getenv("SNAPI_BENCH_PACK_MB"))
+        {
+            Megabytes = std::max<size_t>(1, std::strtoull(Value, nullptr, 10));
+        }
+        return Megabytes * 1024 * 1024;
+    }
+
+    std::filesystem::path MakeBenchmarkTempDir()
+    {
+        const auto Stamp = std::chrono::steady_clock::now().time_since_epoch().count();
+        const auto Dir = std::filesystem::temp_directory_path() / ("snapi_assetpipeline_bench_" + std::to_string(Stamp));
+        std::filesystem::create_directories(Dir);
+        return Dir;
+    }
+
+    // Texture-like bulk data: smooth gradients with noise, compresses roughly 2-3x with Zstd
+    std::vector<uint8_t> MakeBenchmarkBytes(std::mt19937& Rng, const size_t Size)
+    {
+        std::vector<uint8_t> Bytes(Size);
+        uint8_t Value = static_cast<uint8_t>(Rng());
+        for (size_t I = 0; I < Size; ++I)
+        {
+            if (I % 16 == 0)
+            {
+                Value = static_cast<uint8_t>(Value + (Rng() % 5) - 2);
+            }
+            Bytes[I] = static_cast<uint8_t>(Value + ((Rng() & 0x7) == 0 ? Rng() % 8 : 0));
+        }
+        return Bytes;
+    }
+
+    void AddBenchmarkAssets(const AssetPackWriter& Writer, const size_t TotalBytes)
+    {
+        const TypeId AssetKind = SNAPI_UUID(0xbe, 0x01, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01);
+        const TypeId PayloadType = SNAPI_UUID(0xbe, 0x01, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x02);
+
+        std::mt19937 Rng(20240601);
+        size_t Generated = 0;
+        uint32_t AssetIndex = 0;
+        while (Generated < TotalBytes)
+        {
+            AssetPackEntry Entry{};
+            Entry.Id = Uuid::GenerateV5(AssetKind, "Bench/" + std::to_string(AssetIndex));
+            Entry.AssetKind = AssetKind;
+            Entry.Name = "Bench/" + std::to_string(AssetIndex);
+            Entry.Cooked = TypedPayload(PayloadType, 1, MakeBenchmarkBytes(Rng, 512));
+
+            // 4 MiB mip chain
+            for (uint32_t Mip = 0, Size = 3 * 1024 * 1024; Mip < 6; ++Mip, Size /= 4)
+            {
+                BulkChunk Chunk(EBulkSemantic::Reserved_Level, Mip);
+                Chunk.Bytes = MakeBenchmarkBytes(Rng, Size);
+                Generated += Chunk.Bytes.size();
+                Entry.Bulk.push_back(std::move(Chunk));
+            }
+
+            Writer.AddAsset(std::move(Entry));
+            ++AssetIndex;
+        }
+    }
+
+    double SecondsSince(const std::chrono::steady_clock::time_point Start)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+    }
+}
+
+TEST_CASE("Benchmark: parallel chunk compression in AssetPackWriter::Write", "[.][benchmark]")
+{
+    const auto TempDir = MakeBenchmarkTempDir();
+    const size_t TotalBytes = GetBenchmarkPackBytes();
+    const uint32_t HardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    AssetPackWriter Writer;
+    Writer.SetCompression(EPackCompression::Zstd);
+    Writer.SetCompressionLevel(EPackCompressionLevel::High);
+    AddBenchmarkAssets(Writer, TotalBytes);
+
+    std::vector<uint32_t> ThreadCounts{1u};
+    if (HardwareThreads > 1)
+    {
+        ThreadCounts.push_back(HardwareThreads);
+    }
+
+    double SerialSeconds = 0.0;
+    for (const uint32_t Threads : ThreadCounts)
+    {
+        const auto PackPath = TempDir / ("Bench_" + std::to_string(Threads) + ".snpak");
+        Writer.SetCompressionThreads(Threads);
+
+        const auto Start = std::chrono::steady_clock::now();
+        REQUIRE(Writer.Write(PackPath.string()).has_value());
+        const double Seconds = SecondsSince(Start);
+        if (Threads == 1)
+        {
+            SerialSeconds = Seconds;
+        }
+
+        std::printf("Write %zu MiB Zstd/High, %2u thread(s): %7.2f s, %7.1f MiB/s, pack %llu MiB, speedup %.2fx\n",
+                    TotalBytes >> 20, Threads, Seconds, static_cast<double>(TotalBytes >> 20) / Seconds,
+                    static_cast<unsigned long long>(std::filesystem::file_size(PackPath) >> 20), SerialSeconds / Seconds);
+        std::filesystem::remove(PackPath);
+    }
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Benchmark: per-kind Zstd dictionaries for small payloads", "[.][benchmark]")
+{
+    const auto TempDir = MakeBenchmarkTempDir();
+    const TypeId AssetKind = SNAPI_UUID(0xbe, 0x02, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01);
+    const TypeId PayloadType = SNAPI_UUID(0xbe, 0x02, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x02);
+
+    // Serialized-component-like records of 0.5-2 KiB sharing field names and layout; the data
+    // budget is scaled down since only small payloads are of interest here
+    const size_t TotalBytes = std::max<size_t>(1024 * 1024, GetBenchmarkPackBytes() / 32);
+    std::mt19937 Rng(20240615);
+    std::vector<AssetId> Ids;
+    std::vector<std::vector<uint8_t>> Payloads;
+    size_t Generated = 0;
+    while (Generated < TotalBytes)
+    {
+        std::string Text = "{\"entity\":" + std::to_string(Payloads.size()) + ",\"components\":[";
+        const uint32_t ComponentCount = 4 + Rng() % 12;
+        for (uint32_t Component = 0; Component < ComponentCount; ++Component)
+        {
+            static constexpr const char* kComponents[] = {"Transform", "MeshRenderer", "RigidBody", "Collider", "AudioSource", "Light"};
+            Text += "{\"type\":\"";
+            Text += kComponents[Rng() % 6];
+            Text += "\",\"enabled\":true,\"position\":[" + std::to_string(Rng() % 2048) + "," + std::to_string(Rng() % 2048) + "," +
+                    std::to_string(Rng() % 2048) + "],\"layer\":\"Default\"},";
+        }
+        Text += "]}";
+        Generated += Text.size();
+        Ids.push_back(Uuid::GenerateV5(AssetKind, "Bench/Record/" + std::to_string(Payloads.size())));
+        Payloads.emplace_back(Text.begin(), Text.end());
+    }
+
+    for (const bool bDictionaries : {false, true})
+    {
+        const auto PackPath = TempDir / (bDictionaries ? "Dict.snpak" : "Plain.snpak");
+        AssetPackWriter Writer;
+        Writer.SetCompression(EPackCompression::Zstd);
+        PackDictionarySettings Settings;
+        Settings.bEnabled = bDictionaries;
+        Writer.SetDictionaryTraining(Settings);
+        for (size_t Index = 0; Index < Payloads.size(); ++Index)
+        {
+            AssetPackEntry Entry{};
+            Entry.Id = Ids[Index];
+            Entry.AssetKind = AssetKind;
+            Entry.Name = "Bench/Record/" + std::to_string(Index);
+            Entry.Cooked = TypedPayload(PayloadType, 1, Payloads[Index]);
+            Writer.AddAsset(std::move(Entry));
+        }
+        REQUIRE(Writer.Write(PackPath.string()).has_value());
+
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(PackPath.string()).has_value());
+        const auto Start = std::chrono::steady_clock::now();
+        for (const AssetId& Id : Ids)
+        {
+            REQUIRE(Reader.LoadCookedPayload(Id).has_value());
+        }
+        const double Seconds = SecondsSince(Start);
+
+        std::printf("%zu records, %zu KiB, dictionaries %-3s: pack %7llu KiB, decode %7.1f MiB/s, %9.0f payloads/s\n", Payloads.size(),
+                    Generated >> 10, bDictionaries ? "on" : "off",
+                    static_cast<unsigned long long>(std::filesystem::file_size(PackPath) >> 10),
+                    static_cast<double>(Generated) / (1024.0 * 1024.0) / Seconds, static_cast<double>(Payloads.size()) / Seconds);
+    }
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Benchmark: solid blocks for tiny payloads", "[.][benchmark]")
+{
+    const auto TempDir = MakeBenchmarkTempDir();
+    const TypeId AssetKind = SNAPI_UUID(0xbe, 0x03, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01);
+    const TypeId PayloadType = SNAPI_UUID(0xbe, 0x03, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x02);
+
+    // Tag/settings-like data assets of 40-120 bytes, loaded in index order
+    const size_t AssetCount = std::max<size_t>(10000, GetBenchmarkPackBytes() / 8192);
+    std::mt19937 Rng(20240622);
+    std::vector<AssetId> Ids;
+    std::vector<std::vector<uint8_t>> Payloads;
+    size_t Generated = 0;
+    for (size_t Index = 0; Index < AssetCount; ++Index)
+    {
+        std::string Text = "{\"id\":" + std::to_string(Index) + ",\"group\":\"Props/" + std::to_string(Rng() % 64) + "\",\"weight\":" +
+                           std::to_string(Rng() % 1000);
+        Text += Rng() % 2 ? ",\"tags\":[\"static\",\"lod\"]}" : "}";
+        Generated += Text.size();
+        Ids.push_back(Uuid::GenerateV5(AssetKind, "Bench/Tiny/" + std::to_string(Index)));
+        Payloads.emplace_back(Text.begin(), Text.end());
+    }
+
+    for (const bool bSolid : {false, true})
+    {
+        const auto PackPath = TempDir / (bSolid ? "Solid.snpak" : "Plain.snpak");
+        AssetPackWriter Writer;
+        Writer.SetCompression(EPackCompression::Zstd);
+        PackSolidBlockSettings Settings;
+        Settings.MaxAssetSize = bSolid ? 4096 : 0;
+        Writer.SetSolidBlocks(Settings);
+        for (size_t Index = 0; Index < Payloads.size(); ++Index)
+        {
+            AssetPackEntry Entry{};
+            Entry.Id = Ids[Index];
+            Entry.AssetKind = AssetKind;
+            Entry.Name = "Bench/Tiny/" + std::to_string(Index);
+            Entry.Cooked = TypedPayload(PayloadType, 1, Payloads[Index]);
+            Writer.AddAsset(std::move(Entry));
+        }
+        REQUIRE(Writer.Write(PackPath.string()).has_value());
+
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(PackPath.string()).has_value());
+        const auto Start = std::chrono::steady_clock::now();
+        for (const AssetId& Id : Ids)
+        {
+            REQUIRE(Reader.LoadCookedPayload(Id).has_value());
+        }
+        const double Seconds = SecondsSince(Start);
+
+        std::printf("%zu assets, %zu KiB, solid blocks %-3s: pack %7llu KiB, %9.0f payloads/s\n", Payloads.size(), Generated >> 10,
+                    bSolid ? "on" : "off", static_cast<unsigned long long>(std::filesystem::file_size(PackPath) >> 10),
+                    static_cast<double>(Payloads.size()) / Seconds);
+    }
+
+    std::filesystem::remove_all(TempDir);
+}
@@ -171,3 +171,25 @@ TEST_CASE("SnPakIndexHeaderV1 dependency count helpers round-trip", "[pack]")
     REQUIRE(GetDependencyOwnerCount(Header) == 12);
     REQUIRE(GetDependencyEntryCount(Header) == 34);
 }
+
+TEST_CASE("Decompress into a caller buffer round-trips every mode", "[pack]")
+{
+    std::vector<uint8_t> Source(10000);
+    for (size_t I = 0; I < Source.size(); ++I)
+    {
+        Source[I] = static_cast<uint8_t>((I / 5) & 0xFF);
+    }
+
+    for (const auto Mode : {ESnPakCompression::None, ESnPakCompression::LZ4, ESnPakCompression::LZ4HC, ESnPakCompression::Zstd,
+                            ESnPakCompression::ZstdFast})
+    {
+        const auto Compressed = Compress(Source.data(), Source.size(), Mode);
+
+        std::vector<uint8_t> Output(Source.size(), 0xCD);
+        Decompress(Compressed.data(), Compressed.size(), std::span<uint8_t>(Output), Mode);
+        REQUIRE(Output == Source);
+
+        std::vector<uint8_t> TooSmall(Source.size() - 1);
+        REQUIRE_THROWS(Decompress(Compressed.data(), Compressed.size(), std::span<uint8_t>(TooSmall), Mode));
+    }
+}
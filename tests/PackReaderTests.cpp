@@ -0,0 +1,1384 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "AssetPackReader.h"
+#include "AssetPackWriter.h"
+#include "Pack/SnPakFormat.h"
+#include "Uuid.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+
+using namespace SnAPI::AssetPipeline;
+
+namespace
+{
+    std::filesystem::path MakeUniqueTempDir()
+    {
+        const auto Base = std::filesystem::temp_directory_path();
+        const auto Stamp = std::chrono::steady_clock::now().time_since_epoch().count();
+        const auto Dir = Base / ("snapi_assetpipeline_packreader_" + std::to_string(Stamp));
+        std::filesystem::create_directories(Dir);
+        return Dir;
+    }
+
+    AssetId MakeTestId(const uint8_t Seed)
+    {
+        AssetId Id{};
+        for (uint8_t Byte = 0; Byte < 16; ++Byte)
+        {
+            Id.Bytes[Byte] = static_cast<uint8_t>(Seed + Byte);
+        }
+        return Id;
+    }
+
+    std::vector<uint8_t> MakePatternBytes(const size_t Size, const uint8_t Salt)
+    {
+        std::vector<uint8_t> Bytes(Size);
+        for (size_t I = 0; I < Size; ++I)
+        {
+            Bytes[I] = static_cast<uint8_t>((I / 3) ^ Salt);
+        }
+        return Bytes;
+    }
+
+    const TypeId kTestAssetKind = SNAPI_UUID(0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7,
+                                             0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf);
+    const TypeId kTestPayloadType = SNAPI_UUID(0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+                                               0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf);
+
+    // One uncompressed asset (payload override + bCompress=false bulk, like pre-compressed BCn mips)
+    // and one Zstd asset, each with a payload and two bulk chunks
+    void WriteMixedPack(const std::filesystem::path& PackPath)
+    {
+        AssetPackWriter Writer;
+        Writer.SetCompression(EPackCompression::Zstd);
+
+        for (uint8_t AssetIndex = 0; AssetIndex < 2; ++AssetIndex)
+        {
+            AssetPackEntry Entry{};
+            Entry.Id = MakeTestId(AssetIndex * 32);
+            Entry.AssetKind = kTestAssetKind;
+            Entry.Name = AssetIndex == 0 ? "Raw" : "Packed";
+            Entry.Cooked = TypedPayload(kTestPayloadType, 3, MakePatternBytes(4096, AssetIndex));
+            for (uint32_t Mip = 0; Mip < 2; ++Mip)
+            {
+                BulkChunk Chunk(EBulkSemantic::Reserved_Level, Mip, AssetIndex != 0);
+                Chunk.Bytes = MakePatternBytes(16384 >> Mip, static_cast<uint8_t>(AssetIndex + Mip + 1));
+                Entry.Bulk.push_back(std::move(Chunk));
+            }
+            if (AssetIndex == 0)
+            {
+                Entry.CompressionOverride = EPackCompression::None;
+            }
+            Writer.AddAsset(std::move(Entry));
+        }
+
+        auto WriteResult = Writer.Write(PackPath.string());
+        REQUIRE(WriteResult.has_value());
+    }
+}
+
+TEST_CASE("Payload and bulk views match the owning load APIs", "[pack][reader]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto PackPath = TempDir / "views.snpak";
+    WriteMixedPack(PackPath);
+
+    AssetPackReadOptions Options;
+    Options.bVerifyChunkHash = true;
+    Options.bValidateChunkIdentity = true;
+    Options.bValidateChunkSizes = true;
+
+    AssetPackReader Reader;
+    REQUIRE(Reader.Open(PackPath.string(), Options).has_value());
+
+    for (uint8_t AssetIndex = 0; AssetIndex < 2; ++AssetIndex)
+    {
+        const AssetId Id = MakeTestId(AssetIndex * 32);
+        const bool bExpectZeroCopy = AssetIndex == 0;
+
+        auto Payload = Reader.LoadCookedPayload(Id);
+        auto PayloadView = Reader.LoadCookedPayloadView(Id);
+        REQUIRE(Payload.has_value());
+        REQUIRE(PayloadView.has_value());
+        CHECK(PayloadView->PayloadType == Payload->PayloadType);
+        CHECK(PayloadView->SchemaVersion == 3);
+        CHECK(PayloadView->Bytes.IsZeroCopy() == bExpectZeroCopy);
+        CHECK(PayloadView->Bytes.ToVector() == Payload->Bytes);
+
+        for (uint32_t Mip = 0; Mip < 2; ++Mip)
+        {
+            auto Bulk = Reader.LoadBulkChunk(Id, Mip);
+            auto BulkView = Reader.LoadBulkChunkView(Id, Mip);
+            REQUIRE(Bulk.has_value());
+            REQUIRE(BulkView.has_value());
+            CHECK(BulkView->IsZeroCopy() == bExpectZeroCopy);
+            CHECK(BulkView->ToVector() == *Bulk);
+        }
+    }
+
+    CHECK_FALSE(Reader.LoadBulkChunkView(MakeTestId(0), 2).has_value());
+    CHECK_FALSE(Reader.LoadCookedPayloadView(MakeTestId(200)).has_value());
+
+    Reader.Close();
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Zero-copy views outlive the reader that produced them", "[pack][reader]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto PackPath = TempDir / "lifetime.snpak";
+    WriteMixedPack(PackPath);
+
+    AssetDataView RawView;
+    AssetDataView DecodedView;
+    {
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(PackPath.string()).has_value());
+
+        auto Raw = Reader.LoadBulkChunkView(MakeTestId(0), 0);
+        auto Decoded = Reader.LoadBulkChunkView(MakeTestId(32), 0);
+        REQUIRE(Raw.has_value());
+        REQUIRE(Decoded.has_value());
+        RawView = std::move(*Raw);
+        DecodedView = std::move(*Decoded);
+
+        Reader.Close();
+    }
+
+    REQUIRE(RawView.IsZeroCopy());
+    CHECK(RawView.ToVector() == MakePatternBytes(16384, 1));
+    CHECK(DecodedView.ToVector() == MakePatternBytes(16384, 2));
+
+    RawView.Reset();
+    CHECK(RawView.IsEmpty());
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Bulk chunks decode into caller-provided buffers", "[pack][reader]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto PackPath = TempDir / "into.snpak";
+    WriteMixedPack(PackPath);
+
+    AssetPackReadOptions Options;
+    Options.bVerifyChunkHash = true;
+
+    AssetPackReader Reader;
+    REQUIRE(Reader.Open(PackPath.string(), Options).has_value());
+
+    std::vector<uint8_t> Staging(32768, 0xAB);
+    for (uint8_t AssetIndex = 0; AssetIndex < 2; ++AssetIndex)
+    {
+        const AssetId Id = MakeTestId(AssetIndex * 32);
+        for (uint32_t Mip = 0; Mip < 2; ++Mip)
+        {
+            auto Expected = Reader.LoadBulkChunk(Id, Mip);
+            REQUIRE(Expected.has_value());
+
+            auto Written = Reader.LoadBulkChunk(Id, Mip, Staging);
+            REQUIRE(Written.has_value());
+            REQUIRE(*Written == Expected->size());
+            CHECK(std::vector<uint8_t>(Staging.begin(), Staging.begin() + static_cast<std::ptrdiff_t>(*Written)) == *Expected);
+        }
+    }
+
+    std::vector<uint8_t> TooSmall(100);
+    auto SmallResult = Reader.LoadBulkChunk(MakeTestId(32), 0, TooSmall);
+    CHECK_FALSE(SmallResult.has_value());
+
+    Reader.Close();
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Decoded views recycle their buffers once released", "[pack][reader]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto PackPath = TempDir / "pool.snpak";
+    WriteMixedPack(PackPath);
+
+    AssetPackReader Reader;
+    REQUIRE(Reader.Open(PackPath.string()).has_value());
+    const AssetId Id = MakeTestId(32);
+
+    auto First = Reader.LoadBulkChunkView(Id, 0);
+    REQUIRE(First.has_value());
+    REQUIRE_FALSE(First->IsZeroCopy());
+    const uint8_t* FirstData = First->GetData();
+
+    // A live view must never have its buffer handed out again
+    auto Second = Reader.LoadBulkChunkView(Id, 0);
+    REQUIRE(Second.has_value());
+    const uint8_t* SecondData = Second->GetData();
+    CHECK(SecondData != FirstData);
+    CHECK(Second->ToVector() == First->ToVector());
+
+    First->Reset();
+    Second->Reset();
+
+    // Once released, one of the two buffers is reused for the next decode of the same size
+    auto Third = Reader.LoadBulkChunkView(Id, 0);
+    REQUIRE(Third.has_value());
+    CHECK((Third->GetData() == FirstData || Third->GetData() == SecondData));
+    CHECK(Third->ToVector() == MakePatternBytes(16384, 2));
+
+    Reader.Close();
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Batched bulk loads match single-chunk loads", "[pack][reader]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto PackPath = TempDir / "batched.snpak";
+    WriteMixedPack(PackPath);
+
+    AssetPackReadOptions Options;
+    Options.bVerifyChunkHash = true;
+    Options.bValidateChunkIdentity = true;
+    Options.bValidateChunkSizes = true;
+
+    AssetPackReader Reader;
+    REQUIRE(Reader.Open(PackPath.string(), Options).has_value());
+
+    // Out of order, with a repeat
+    const std::vector<uint32_t> Indices = {1, 0, 1};
+    for (const uint32_t MaxThreads : {1u, 4u})
+    {
+        for (uint8_t AssetIndex = 0; AssetIndex < 2; ++AssetIndex)
+        {
+            const AssetId Id = MakeTestId(AssetIndex * 32);
+            auto Views = Reader.LoadBulkChunks(Id, Indices, MaxThreads);
+            REQUIRE(Views.has_value());
+            REQUIRE(Views->size() == Indices.size());
+            for (size_t I = 0; I < Indices.size(); ++I)
+            {
+                auto Expected = Reader.LoadBulkChunk(Id, Indices[I]);
+                REQUIRE(Expected.has_value());
+                CHECK((*Views)[I].ToVector() == *Expected);
+                CHECK((*Views)[I].IsZeroCopy() == (AssetIndex == 0));
+            }
+            CHECK((*Views)[0].GetData() == (*Views)[2].GetData());
+        }
+    }
+
+    const std::vector<uint32_t> BadIndices = {0, 2};
+    CHECK_FALSE(Reader.LoadBulkChunks(MakeTestId(32), BadIndices).has_value());
+    CHECK(Reader.LoadBulkChunks(MakeTestId(32), {}).value().empty());
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Asset file ranges cover the payload and bulk chunks", "[pack][reader]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto PackPath = TempDir / "ranges.snpak";
+    WriteMixedPack(PackPath);
+    const uint64_t FileSize = std::filesystem::file_size(PackPath);
+
+    AssetPackReader Reader;
+    REQUIRE(Reader.Open(PackPath.string()).has_value());
+
+    std::vector<AssetPackReader::FileRange> AllRanges;
+    for (uint8_t AssetIndex = 0; AssetIndex < 2; ++AssetIndex)
+    {
+        auto Ranges = Reader.GetAssetFileRanges(MakeTestId(AssetIndex * 32));
+        REQUIRE(Ranges.has_value());
+        REQUIRE_FALSE(Ranges->empty());
+
+        uint64_t Covered = 0;
+        for (size_t I = 0; I < Ranges->size(); ++I)
+        {
+            const auto& Range = (*Ranges)[I];
+            CHECK(Range.Size > 0);
+            CHECK(Range.Offset + Range.Size <= FileSize);
+            if (I > 0)
+            {
+                // Sorted and merged: a gap separates consecutive runs
+                CHECK((*Ranges)[I - 1].Offset + (*Ranges)[I - 1].Size < Range.Offset);
+            }
+            Covered += Range.Size;
+        }
+        // Payload chunk plus two bulk chunks, each with its header
+        CHECK(Covered > 3 * sizeof(Pack::SnPakChunkHeaderV1));
+        AllRanges.insert(AllRanges.end(), Ranges->begin(), Ranges->end());
+    }
+
+    // Different assets never share bytes
+    for (size_t A = 0; A < AllRanges.size(); ++A)
+    {
+        for (size_t B = A + 1; B < AllRanges.size(); ++B)
+        {
+            const bool bDisjoint = AllRanges[A].Offset + AllRanges[A].Size <= AllRanges[B].Offset ||
+                                   AllRanges[B].Offset + AllRanges[B].Size <= AllRanges[A].Offset;
+            CHECK(bDisjoint);
+        }
+    }
+
+#if !defined(_WIN32)
+    // The pack was just written, so its pages are in the page cache
+    auto ColdRanges = Reader.GetAssetFileRanges(MakeTestId(0), true);
+    REQUIRE(ColdRanges.has_value());
+    CHECK(ColdRanges->empty());
+#endif
+
+    CHECK_FALSE(Reader.GetAssetFileRanges(MakeTestId(99)).has_value());
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Staged reads serve chunks of the open they belong to", "[pack][reader]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto PackPath = TempDir / "staged.snpak";
+    WriteMixedPack(PackPath);
+
+    AssetPackReader Reader;
+    REQUIRE(Reader.Open(PackPath.string()).has_value());
+    REQUIRE(Reader.GetOpenSerial() != 0);
+
+    const AssetId Id = MakeTestId(0);
+    const auto Expected = Reader.LoadCookedPayload(Id);
+    REQUIRE(Expected.has_value());
+
+    auto Ranges = Reader.GetAssetFileRanges(Id);
+    REQUIRE(Ranges.has_value());
+
+    // Copy the asset's ranges out of the file, as the loader's I/O stage would
+    std::ifstream File(PackPath, std::ios::binary);
+    REQUIRE(File.good());
+    auto Staged = std::make_shared<PackStagedReads>();
+    Staged->ReaderSerial = Reader.GetOpenSerial();
+    for (const auto& Range : *Ranges)
+    {
+        auto Bytes = std::make_shared<uint8_t[]>(Range.Size);
+        File.seekg(static_cast<std::streamoff>(Range.Offset));
+        File.read(reinterpret_cast<char*>(Bytes.get()), static_cast<std::streamsize>(Range.Size));
+        REQUIRE(File.good());
+        Staged->Ranges.push_back({Range.Offset, Range.Size, std::move(Bytes)});
+    }
+
+    const auto IsStaged = [&Staged](const uint8_t* Data)
+    {
+        return std::ranges::any_of(Staged->Ranges,
+                                   [Data](const PackStagedRange& Range)
+                                   {
+                                       return Data >= Range.Bytes.get() && Data < Range.Bytes.get() + Range.Size;
+                                   });
+    };
+
+    std::optional<TypedPayloadView> StagedView;
+    {
+        ScopedPackStagedReads Scope(*Staged);
+        auto View = Reader.LoadCookedPayloadView(Id);
+        REQUIRE(View.has_value());
+        CHECK(View->Bytes.IsZeroCopy());
+        CHECK(IsStaged(View->Bytes.GetData()));
+        StagedView = std::move(*View);
+    }
+    // The view shares the staged buffer, so it stays valid once the scope and the plan are gone
+    Staged.reset();
+    CHECK(StagedView->Bytes.ToVector() == Expected->Bytes);
+
+    // Staged bytes of another open are ignored
+    PackStagedReads Stale;
+    Stale.ReaderSerial = Reader.GetOpenSerial() + 1;
+    Stale.Ranges.push_back({0, std::filesystem::file_size(PackPath), std::make_shared<uint8_t[]>(std::filesystem::file_size(PackPath))});
+    {
+        ScopedPackStagedReads Scope(Stale);
+        auto View = Reader.LoadCookedPayloadView(Id);
+        REQUIRE(View.has_value());
+        CHECK(View->Bytes.ToVector() == Expected->Bytes);
+    }
+
+    auto Descriptor = Reader.DuplicateFileDescriptor();
+#if !defined(_WIN32)
+    REQUIRE(Descriptor);
+    CHECK(*Descriptor >= 0);
+#endif
+
+    Reader.Close();
+    CHECK(Reader.GetOpenSerial() == 0);
+    CHECK_FALSE(Reader.DuplicateFileDescriptor());
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Direct bulk reads match mapped reads", "[pack][reader]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto PackPath = TempDir / "direct.snpak";
+    const auto UnalignedPath = TempDir / "unaligned.snpak";
+    for (const auto& [Path, Alignment] : {std::pair{PackPath, 4096u}, std::pair{UnalignedPath, 1u}})
+    {
+        AssetPackWriter Writer;
+        Writer.SetCompression(EPackCompression::Zstd);
+        Writer.SetChunkAlignment(Alignment);
+        for (uint8_t AssetIndex = 0; AssetIndex < 3; ++AssetIndex)
+        {
+            AssetPackEntry Entry{};
+            Entry.Id = MakeTestId(AssetIndex * 32);
+            Entry.AssetKind = kTestAssetKind;
+            Entry.Name = "Direct" + std::to_string(AssetIndex);
+            Entry.Cooked = TypedPayload(kTestPayloadType, 1, MakePatternBytes(1000, AssetIndex));
+            for (uint32_t Mip = 0; Mip < 3; ++Mip)
+            {
+                // Odd sizes so chunk data rarely ends on a block boundary
+                BulkChunk Chunk(EBulkSemantic::Reserved_Level, Mip, Mip != 0);
+                Chunk.Bytes = MakePatternBytes((300000 >> Mip) + AssetIndex * 7 + 3, static_cast<uint8_t>(AssetIndex * 5 + Mip));
+                Entry.Bulk.push_back(std::move(Chunk));
+            }
+            Writer.AddAsset(std::move(Entry));
+        }
+        REQUIRE(Writer.Write(Path.string()).has_value());
+    }
+
+    AssetPackReadOptions Options;
+    Options.bVerifyChunkHash = true;
+    Options.bValidateChunkIdentity = true;
+    Options.bValidateChunkSizes = true;
+
+    AssetPackReader Mapped;
+    REQUIRE(Mapped.Open(PackPath.string(), Options).has_value());
+    CHECK_FALSE(Mapped.IsUsingDirectIo());
+
+    Options.bDirectIo = true;
+    Options.DirectIoMinSize = 0;
+    AssetPackReader Direct;
+    REQUIRE(Direct.Open(PackPath.string(), Options).has_value());
+    // Filesystems without unbuffered I/O (e.g. tmpfs) fall back to the mapping; results must match either way
+
+    for (uint8_t AssetIndex = 0; AssetIndex < 3; ++AssetIndex)
+    {
+        const AssetId Id = MakeTestId(AssetIndex * 32);
+        for (uint32_t Mip = 0; Mip < 3; ++Mip)
+        {
+            const auto Expected = Mapped.LoadBulkChunk(Id, Mip);
+            REQUIRE(Expected.has_value());
+
+            auto Loaded = Direct.LoadBulkChunk(Id, Mip);
+            REQUIRE(Loaded.has_value());
+            CHECK(*Loaded == *Expected);
+
+            std::vector<uint8_t> Output(Expected->size() + 16, 0xAB);
+            auto Written = Direct.LoadBulkChunk(Id, Mip, Output);
+            REQUIRE(Written.has_value());
+            REQUIRE(*Written == Expected->size());
+            CHECK(std::equal(Expected->begin(), Expected->end(), Output.begin()));
+            CHECK(Output.back() == 0xAB);
+        }
+    }
+
+    if (Direct.IsUsingDirectIo())
+    {
+        // Bulk chunks read with unbuffered I/O bypass the page cache, so prefetch plans leave them out
+        for (uint8_t AssetIndex = 0; AssetIndex < 3; ++AssetIndex)
+        {
+            const AssetId Id = MakeTestId(AssetIndex * 32);
+            auto DirectRanges = Direct.GetAssetFileRanges(Id);
+            auto MappedRanges = Mapped.GetAssetFileRanges(Id);
+            REQUIRE(DirectRanges.has_value());
+            REQUIRE(MappedRanges.has_value());
+            const auto Total = [](const std::vector<AssetPackReader::FileRange>& Ranges)
+            {
+                uint64_t Size = 0;
+                for (const auto& Range : Ranges)
+                {
+                    Size += Range.Size;
+                }
+                return Size;
+            };
+            CHECK(Total(*DirectRanges) < Total(*MappedRanges));
+        }
+    }
+
+    // Direct reads need block-aligned chunk data
+    AssetPackReader Unaligned;
+    REQUIRE(Unaligned.Open(UnalignedPath.string(), Options).has_value());
+    CHECK_FALSE(Unaligned.IsUsingDirectIo());
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Resident packs are faulted in at open", "[pack][reader]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto PackPath = TempDir / "resident.snpak";
+    {
+        AssetPackWriter Writer;
+        Writer.SetCompression(EPackCompression::LZ4);
+        Writer.SetChunkAlignment(4096);
+        for (uint8_t AssetIndex = 0; AssetIndex < 4; ++AssetIndex)
+        {
+            AssetPackEntry Entry{};
+            Entry.Id = MakeTestId(AssetIndex);
+            Entry.AssetKind = kTestAssetKind;
+            Entry.Name = "Ui/Panel" + std::to_string(AssetIndex);
+            Entry.Cooked = TypedPayload(kTestPayloadType, 1, MakePatternBytes(2000, AssetIndex));
+            BulkChunk Chunk(EBulkSemantic::Reserved_Level, 0, AssetIndex % 2 == 0);
+            Chunk.Bytes = MakePatternBytes(20000 + AssetIndex, static_cast<uint8_t>(AssetIndex * 3));
+            Entry.Bulk.push_back(std::move(Chunk));
+            Writer.AddAsset(std::move(Entry));
+        }
+        REQUIRE(Writer.Write(PackPath.string()).has_value());
+    }
+
+    AssetPackReader Mapped;
+    REQUIRE(Mapped.Open(PackPath.string()).has_value());
+    CHECK_FALSE(Mapped.IsMemoryLocked());
+
+    AssetPackReadOptions Options;
+    Options.bResident = true;
+    Options.bDirectIo = true;
+    Options.DirectIoMinSize = 0;
+    AssetPackReader Resident;
+    REQUIRE(Resident.Open(PackPath.string(), Options).has_value());
+    CHECK_FALSE(Resident.IsUsingDirectIo());
+    CHECK_FALSE(Resident.IsMemoryLocked());
+
+    // Locking may be refused by the memlock limit; the pack is resident and readable either way
+    Options.bLockResident = true;
+    AssetPackReader Locked;
+    REQUIRE(Locked.Open(PackPath.string(), Options).has_value());
+
+    for (uint8_t AssetIndex = 0; AssetIndex < 4; ++AssetIndex)
+    {
+        const AssetId Id = MakeTestId(AssetIndex);
+        for (const AssetPackReader* Reader : {&Resident, &Locked})
+        {
+            CHECK(Reader->LoadCookedPayload(Id).value().Bytes == Mapped.LoadCookedPayload(Id).value().Bytes);
+            CHECK(Reader->LoadBulkChunk(Id, 0).value() == Mapped.LoadBulkChunk(Id, 0).value());
+#if !defined(_WIN32)
+            auto ColdRanges = Reader->GetAssetFileRanges(Id, true);
+            REQUIRE(ColdRanges.has_value());
+            CHECK(ColdRanges->empty());
+#endif
+        }
+    }
+
+    Locked.Close();
+    CHECK_FALSE(Locked.IsMemoryLocked());
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Mapping hints do not change what is read", "[pack][reader]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto PackPath = TempDir / "hints.snpak";
+    std::vector<std::vector<uint8_t>> Sources;
+    {
+        AssetPackWriter Writer;
+        Writer.SetCompression(EPackCompression::LZ4);
+        Writer.SetChunkAlignment(4096);
+        for (uint8_t AssetIndex = 0; AssetIndex < 3; ++AssetIndex)
+        {
+            AssetPackEntry Entry{};
+            Entry.Id = MakeTestId(AssetIndex);
+            Entry.AssetKind = kTestAssetKind;
+            Entry.Name = "Stream/" + std::to_string(AssetIndex);
+            Entry.Cooked = TypedPayload(kTestPayloadType, 1, MakePatternBytes(500, AssetIndex));
+            for (uint32_t Mip = 0; Mip < 2; ++Mip)
+            {
+                BulkChunk Chunk(EBulkSemantic::Reserved_Level, Mip, Mip == 0);
+                Chunk.Bytes = MakePatternBytes(3 * 4096 + 123 * (AssetIndex + 1), static_cast<uint8_t>(AssetIndex * 2 + Mip));
+                Sources.push_back(Chunk.Bytes);
+                Entry.Bulk.push_back(std::move(Chunk));
+            }
+            Writer.AddAsset(std::move(Entry));
+        }
+        REQUIRE(Writer.Write(PackPath.string()).has_value());
+    }
+
+    for (const auto Pattern : {EMapAccessPattern::Normal, EMapAccessPattern::Sequential, EMapAccessPattern::Random})
+    {
+        AssetPackReadOptions Options;
+        Options.AccessPattern = Pattern;
+        Options.bHugePages = true;
+        Options.bReleaseDecodedBulk = true;
+        Options.bVerifyChunkHash = true;
+
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(PackPath.string(), Options).has_value());
+        REQUIRE(Reader.FindAssetIndexByName("Stream/2").has_value());
+
+        // Released chunks fault back in when they are read again, through copies or views
+        for (int Pass = 0; Pass < 2; ++Pass)
+        {
+            for (uint8_t AssetIndex = 0; AssetIndex < 3; ++AssetIndex)
+            {
+                const AssetId Id = MakeTestId(AssetIndex);
+                for (uint32_t Mip = 0; Mip < 2; ++Mip)
+                {
+                    const auto& Expected = Sources[AssetIndex * 2 + Mip];
+                    CHECK(Reader.LoadBulkChunk(Id, Mip).value() == Expected);
+
+                    std::vector<uint8_t> Output(Expected.size());
+                    REQUIRE(Reader.LoadBulkChunk(Id, Mip, Output).value() == Output.size());
+                    CHECK(Output == Expected);
+                    CHECK(Reader.LoadBulkChunkView(Id, Mip).value().ToVector() == Expected);
+                }
+                CHECK(Reader.LoadCookedPayload(Id).value().Bytes == MakePatternBytes(500, AssetIndex));
+            }
+        }
+    }
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Bulk chunk ranges decode only the frames they touch", "[pack][reader]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto PackPath = TempDir / "framed.snpak";
+    constexpr uint32_t kFrameSize = 64 * 1024;
+
+    // Framed Zstd and LZ4 chunks, a single-block chunk below the threshold and a raw chunk
+    const std::vector<std::pair<std::optional<EPackCompression>, size_t>> Chunks = {
+        {std::nullopt, 10 * kFrameSize + 123},
+        {EPackCompression::LZ4, 4 * kFrameSize},
+        {std::nullopt, 3 * kFrameSize},
+        {EPackCompression::None, 5 * kFrameSize + 7},
+    };
+    std::vector<std::vector<uint8_t>> Sources;
+    {
+        AssetPackWriter Writer;
+        Writer.SetCompression(EPackCompression::Zstd);
+        Writer.SetBulkFraming(4 * kFrameSize - 1, kFrameSize);
+
+        AssetPackEntry Entry{};
+        Entry.Id = MakeTestId(7);
+        Entry.AssetKind = kTestAssetKind;
+        Entry.Name = "Blob";
+        Entry.Cooked = TypedPayload(kTestPayloadType, 1, MakePatternBytes(256, 1));
+        for (size_t Index = 0; Index < Chunks.size(); ++Index)
+        {
+            BulkChunk Chunk(EBulkSemantic::Reserved_Level, static_cast<uint32_t>(Index), true);
+            Chunk.CompressionOverride = Chunks[Index].first;
+            Chunk.Bytes = MakePatternBytes(Chunks[Index].second, static_cast<uint8_t>(Index * 17 + 3));
+            // Break up the pattern so frames do not all compress alike
+            for (size_t Byte = 0; Byte < Chunk.Bytes.size(); Byte += 4099)
+            {
+                Chunk.Bytes[Byte] = static_cast<uint8_t>(Byte * 31);
+            }
+            Sources.push_back(Chunk.Bytes);
+            Entry.Bulk.push_back(std::move(Chunk));
+        }
+        Writer.AddAsset(std::move(Entry));
+        REQUIRE(Writer.Write(PackPath.string()).has_value());
+    }
+
+    AssetPackReadOptions Options;
+    Options.bVerifyChunkHash = true;
+    Options.bValidateChunkSizes = true;
+    Options.bValidateChunkIdentity = true;
+
+    {
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(PackPath.string(), Options).has_value());
+        const AssetId Id = MakeTestId(7);
+
+        for (uint32_t Index = 0; Index < Sources.size(); ++Index)
+        {
+            const auto& Source = Sources[Index];
+            REQUIRE(Reader.LoadBulkChunk(Id, Index).value() == Source);
+
+            const std::vector<std::pair<uint64_t, uint64_t>> Ranges = {
+                {0, 100},
+                {kFrameSize - 10, 20},
+                {kFrameSize, kFrameSize},
+                {kFrameSize / 2, 2 * kFrameSize},
+                {Source.size() - 50, 1000},
+                {Source.size(), 10},
+                {0, Source.size()},
+            };
+            for (const auto& [Offset, Length] : Ranges)
+            {
+                auto Range = Reader.LoadBulkChunkRange(Id, Index, Offset, Length);
+                REQUIRE(Range.has_value());
+                const size_t Expected = std::min<size_t>(Length, Source.size() - Offset);
+                REQUIRE(Range->size() == Expected);
+                CHECK(std::equal(Range->begin(), Range->end(), Source.begin() + static_cast<ptrdiff_t>(Offset)));
+            }
+
+            std::vector<uint8_t> Output(3000, 0xEE);
+            auto Written = Reader.LoadBulkChunkRange(Id, Index, 12345, Output);
+            REQUIRE(Written.has_value());
+            CHECK(*Written == 3000);
+            CHECK(std::equal(Output.begin(), Output.end(), Source.begin() + 12345));
+
+            CHECK_FALSE(Reader.LoadBulkChunkRange(Id, Index, Source.size() + 1, 1).has_value());
+        }
+        CHECK_FALSE(Reader.LoadBulkChunkRange(Id, static_cast<uint32_t>(Sources.size()), 0, 1).has_value());
+    }
+
+    // Corrupt the last frame of a framed chunk: ranges in earlier frames still decode, while the
+    // whole chunk and ranges reaching the last frame fail verification
+    {
+        const auto CorruptPath = TempDir / "corrupt.snpak";
+        AssetPackWriter Writer;
+        Writer.SetCompression(EPackCompression::Zstd);
+        Writer.SetBulkFraming(kFrameSize, kFrameSize);
+
+        AssetPackEntry Entry{};
+        Entry.Id = MakeTestId(9);
+        Entry.AssetKind = kTestAssetKind;
+        Entry.Cooked = TypedPayload(kTestPayloadType, 1, MakePatternBytes(256, 2));
+        BulkChunk Chunk(EBulkSemantic::Reserved_Level, 0, true);
+        Chunk.Bytes = Sources[0];
+        Entry.Bulk.push_back(std::move(Chunk));
+        Writer.AddAsset(std::move(Entry));
+        REQUIRE(Writer.Write(CorruptPath.string()).has_value());
+
+        uint64_t ChunkEnd = 0;
+        {
+            AssetPackReader Reader;
+            REQUIRE(Reader.Open(CorruptPath.string()).has_value());
+            const auto FileRanges = Reader.GetAssetFileRanges(MakeTestId(9));
+            REQUIRE(FileRanges.has_value());
+            REQUIRE_FALSE(FileRanges->empty());
+            // The bulk chunk is written after the payload, so it ends the asset's last range
+            ChunkEnd = FileRanges->back().Offset + FileRanges->back().Size;
+        }
+        {
+            std::fstream File(CorruptPath, std::ios::binary | std::ios::in | std::ios::out);
+            File.seekg(static_cast<std::streamoff>(ChunkEnd - 2));
+            const char Byte = static_cast<char>(File.get());
+            File.seekp(static_cast<std::streamoff>(ChunkEnd - 2));
+            File.put(static_cast<char>(Byte ^ 0x5A));
+        }
+
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(CorruptPath.string(), Options).has_value());
+        const auto Head = Reader.LoadBulkChunkRange(MakeTestId(9), 0, 0, 3 * kFrameSize);
+        REQUIRE(Head.has_value());
+        CHECK(std::equal(Head->begin(), Head->end(), Sources[0].begin()));
+        CHECK_FALSE(Reader.LoadBulkChunkRange(MakeTestId(9), 0, Sources[0].size() - 10, 10).has_value());
+        CHECK_FALSE(Reader.LoadBulkChunk(MakeTestId(9), 0).has_value());
+    }
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Framed chunks decode the same on any number of threads", "[pack][reader]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto PackPath = TempDir / "parallel.snpak";
+    constexpr uint32_t kFrameSize = 64 * 1024;
+
+    std::vector<std::vector<uint8_t>> Sources;
+    {
+        AssetPackWriter Writer;
+        Writer.SetCompression(EPackCompression::Zstd);
+        Writer.SetBulkFraming(kFrameSize, kFrameSize);
+
+        AssetPackEntry Entry{};
+        Entry.Id = MakeTestId(11);
+        Entry.AssetKind = kTestAssetKind;
+        Entry.Cooked = TypedPayload(kTestPayloadType, 1, MakePatternBytes(64, 4));
+        for (uint32_t Mip = 0; Mip < 3; ++Mip)
+        {
+            BulkChunk Chunk(EBulkSemantic::Reserved_Level, Mip, true);
+            Chunk.CompressionOverride = Mip == 1 ? std::optional(EPackCompression::LZ4) : std::nullopt;
+            Chunk.Bytes = MakePatternBytes((40 * kFrameSize + 999) >> Mip, static_cast<uint8_t>(Mip + 20));
+            for (size_t Byte = 0; Byte < Chunk.Bytes.size(); Byte += 1021)
+            {
+                Chunk.Bytes[Byte] = static_cast<uint8_t>(Byte >> 4);
+            }
+            Sources.push_back(Chunk.Bytes);
+            Entry.Bulk.push_back(std::move(Chunk));
+        }
+        Writer.AddAsset(std::move(Entry));
+        REQUIRE(Writer.Write(PackPath.string()).has_value());
+    }
+
+    const AssetId Id = MakeTestId(11);
+    for (const uint32_t Threads : {1u, 0u, 3u, 64u})
+    {
+        AssetPackReadOptions Options;
+        Options.bVerifyChunkHash = true;
+        Options.FrameDecodeThreads = Threads;
+
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(PackPath.string(), Options).has_value());
+        for (uint32_t Mip = 0; Mip < Sources.size(); ++Mip)
+        {
+            CHECK(Reader.LoadBulkChunk(Id, Mip).value() == Sources[Mip]);
+
+            std::vector<uint8_t> Output(Sources[Mip].size());
+            REQUIRE(Reader.LoadBulkChunk(Id, Mip, Output).value() == Output.size());
+            CHECK(Output == Sources[Mip]);
+
+            CHECK(Reader.LoadBulkChunkView(Id, Mip).value().ToVector() == Sources[Mip]);
+
+            const uint64_t Offset = kFrameSize / 3;
+            const auto Range = Reader.LoadBulkChunkRange(Id, Mip, Offset, 7 * kFrameSize);
+            REQUIRE(Range.has_value());
+            CHECK(std::equal(Range->begin(), Range->end(), Sources[Mip].begin() + Offset));
+        }
+
+        const std::vector<uint32_t> Indices = {0, 1, 2};
+        const auto Views = Reader.LoadBulkChunks(Id, Indices, 2);
+        REQUIRE(Views.has_value());
+        for (uint32_t Mip = 0; Mip < Sources.size(); ++Mip)
+        {
+            CHECK((*Views)[Mip].ToVector() == Sources[Mip]);
+        }
+    }
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Names resolve lazily from the mapped string table", "[pack][reader]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto PackPath = TempDir / "names.snpak";
+    WriteMixedPack(PackPath);
+
+    AssetPackReader Reader;
+    REQUIRE(Reader.Open(PackPath.string()).has_value());
+    REQUIRE(Reader.GetAssetCount() == 2);
+
+    auto Packed = Reader.FindAssetsByName("Packed");
+    REQUIRE(Packed.size() == 1);
+    CHECK(Packed[0].Id == MakeTestId(32));
+    CHECK(Packed[0].VariantKey.empty());
+    CHECK(Reader.FindAssetsByName("Missing").empty());
+
+    // Re-opening resets all state that points into the previous mapping
+    REQUIRE(Reader.Open(PackPath.string()).has_value());
+    auto Raw = Reader.FindAsset(MakeTestId(0));
+    REQUIRE(Raw.has_value());
+    CHECK(Raw->Name == "Raw");
+
+    Reader.Close();
+    CHECK_FALSE(Reader.IsOpen());
+    CHECK(Reader.GetAssetCount() == 0);
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Unterminated string table fails to open", "[pack][reader]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto PackPath = TempDir / "unterminated.snpak";
+    WriteMixedPack(PackPath);
+
+    Pack::SnPakHeaderV1 Header{};
+    {
+        std::ifstream In(PackPath, std::ios::binary);
+        In.read(reinterpret_cast<char*>(&Header), sizeof(Header));
+        REQUIRE(In.good());
+    }
+    {
+        std::fstream File(PackPath, std::ios::binary | std::ios::in | std::ios::out);
+        File.seekp(static_cast<std::streamoff>(Header.StringTableOffset + Header.StringTableSize - 1));
+        File.put('X');
+    }
+
+    AssetPackReader Reader;
+    auto Result = Reader.Open(PackPath.string());
+    REQUIRE_FALSE(Result.has_value());
+    CHECK(Result.error().find("terminator") != std::string::npos);
+    CHECK_FALSE(Reader.IsOpen());
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Lookup tables resolve the same assets as the fallback maps", "[pack][reader]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+
+    auto WritePack = [&](const std::filesystem::path& PackPath, const bool bLookupTables) {
+        AssetPackWriter Writer;
+        Writer.SetCompression(EPackCompression::None);
+        Writer.SetWriteLookupTables(bLookupTables);
+        for (uint32_t I = 0; I < 300; ++I)
+        {
+            AssetPackEntry Entry{};
+            Entry.Id = MakeTestId(static_cast<uint8_t>(I));
+            Entry.Id.Bytes[15] = static_cast<uint8_t>(I >> 8);
+            Entry.AssetKind = kTestAssetKind;
+            // Every name is shared by three variants
+            Entry.Name = "Assets/" + std::to_string(I / 3);
+            Entry.VariantKey = "v" + std::to_string(I % 3);
+            Entry.Cooked = TypedPayload(kTestPayloadType, 1, MakePatternBytes(16, static_cast<uint8_t>(I)));
+            Writer.AddAsset(std::move(Entry));
+        }
+        REQUIRE(Writer.Write(PackPath.string()).has_value());
+    };
+
+    const auto WithTables = TempDir / "lookup.snpak";
+    const auto WithoutTables = TempDir / "maps.snpak";
+    WritePack(WithTables, true);
+    WritePack(WithoutTables, false);
+    REQUIRE(std::filesystem::file_size(WithTables) > std::filesystem::file_size(WithoutTables));
+
+    AssetPackReadOptions Options;
+    Options.bVerifyIndexEntriesHash = true;
+    Options.bVerifyIndexBlockHash = true;
+
+    AssetPackReader Fast;
+    AssetPackReader Slow;
+    REQUIRE(Fast.Open(WithTables.string(), Options).has_value());
+    REQUIRE(Slow.Open(WithoutTables.string(), Options).has_value());
+    REQUIRE(Fast.GetAssetCount() == Slow.GetAssetCount());
+
+    for (uint32_t I = 0; I < Fast.GetAssetCount(); ++I)
+    {
+        auto Info = Slow.GetAssetInfo(I);
+        REQUIRE(Info.has_value());
+
+        auto FastFound = Fast.FindAsset(Info->Id);
+        REQUIRE(FastFound.has_value());
+        CHECK(FastFound->Name == Info->Name);
+        CHECK(FastFound->VariantKey == Info->VariantKey);
+
+        auto FastByName = Fast.FindAssetsByName(Info->Name);
+        auto SlowByName = Slow.FindAssetsByName(Info->Name);
+        REQUIRE(FastByName.size() == 3);
+        REQUIRE(FastByName.size() == SlowByName.size());
+        for (size_t Match = 0; Match < FastByName.size(); ++Match)
+        {
+            CHECK(FastByName[Match].Id == SlowByName[Match].Id);
+        }
+    }
+
+    AssetId Missing = MakeTestId(7);
+    Missing.Bytes[15] = 0xEE;
+    CHECK_FALSE(Fast.FindAsset(Missing).has_value());
+    CHECK(Fast.FindAssetsByName("Assets/none").empty());
+
+    Fast.Close();
+    Slow.Close();
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Asset info views match the materialized asset info", "[pack][reader]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+
+    for (const bool bLookupTables : {true, false})
+    {
+        const auto PackPath = TempDir / (bLookupTables ? "views_lookup.snpak" : "views_maps.snpak");
+        {
+            AssetPackWriter Writer;
+            Writer.SetCompression(EPackCompression::None);
+            Writer.SetWriteLookupTables(bLookupTables);
+            for (uint32_t I = 0; I < 12; ++I)
+            {
+                AssetPackEntry Entry{};
+                Entry.Id = MakeTestId(static_cast<uint8_t>(I));
+                Entry.AssetKind = kTestAssetKind;
+                Entry.Name = "Views/" + std::to_string(I / 2);
+                if (I % 2 == 1)
+                {
+                    Entry.VariantKey = "high";
+                }
+                Entry.Cooked = TypedPayload(kTestPayloadType, 3, MakePatternBytes(32, static_cast<uint8_t>(I)));
+                for (uint32_t Mip = 0; Mip < I % 3; ++Mip)
+                {
+                    BulkChunk Chunk(EBulkSemantic::Reserved_Level, Mip, false);
+                    Chunk.Bytes = MakePatternBytes(64, static_cast<uint8_t>(Mip));
+                    Entry.Bulk.push_back(std::move(Chunk));
+                }
+                for (uint32_t Dependency = 0; Dependency < I % 4; ++Dependency)
+                {
+                    Entry.AssetDependencies.push_back(AssetDependencyRef{MakeTestId(static_cast<uint8_t>(100 + Dependency)),
+                                                                         Dependency % 2 == 0 ? "Views/Dep" + std::to_string(Dependency) : "",
+                                                                         EAssetDependencyKind::Optional});
+                }
+                Writer.AddAsset(std::move(Entry));
+            }
+            REQUIRE(Writer.Write(PackPath.string()).has_value());
+        }
+
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(PackPath.string()).has_value());
+
+        for (uint32_t I = 0; I < Reader.GetAssetCount(); ++I)
+        {
+            const auto Info = Reader.GetAssetInfo(I);
+            const auto View = Reader.GetAssetInfoView(I);
+            REQUIRE(Info.has_value());
+            REQUIRE(View.has_value());
+            CHECK(View->Index == I);
+            CHECK(View->Id == Info->Id);
+            CHECK(View->AssetKind == Info->AssetKind);
+            CHECK(View->CookedPayloadType == Info->CookedPayloadType);
+            CHECK(View->SchemaVersion == Info->SchemaVersion);
+            CHECK(View->Name == Info->Name);
+            CHECK(View->VariantKey == Info->VariantKey);
+            CHECK(View->BulkChunkCount == Info->BulkChunkCount);
+            REQUIRE(View->DependencyCount == Info->AssetDependencies.size());
+            for (uint32_t Dependency = 0; Dependency < View->DependencyCount; ++Dependency)
+            {
+                const auto DependencyView = Reader.GetAssetDependency(I, Dependency);
+                REQUIRE(DependencyView.has_value());
+                CHECK(DependencyView->Id == Info->AssetDependencies[Dependency].Id);
+                CHECK(DependencyView->LogicalName == Info->AssetDependencies[Dependency].LogicalName);
+                CHECK(DependencyView->Kind == Info->AssetDependencies[Dependency].Kind);
+            }
+            CHECK_FALSE(Reader.GetAssetDependency(I, View->DependencyCount).has_value());
+
+            const auto ById = Reader.FindAssetView(Info->Id);
+            REQUIRE(ById.has_value());
+            CHECK(ById->Index == I);
+
+            // Lookups by name take a string_view, so a slice of a larger buffer works as-is
+            const std::string Padded = "[" + Info->Name + "]";
+            const std::string_view Name = std::string_view(Padded).substr(1, Info->Name.size());
+            const auto ByName = Reader.FindAssetViewByName(Name);
+            REQUIRE(ByName.has_value());
+            CHECK(ByName->Index == I / 2 * 2);
+            CHECK(ByName->Name.data() != Name.data());
+            CHECK(Reader.FindAssetsByName(Name).size() == 2);
+        }
+
+        CHECK_FALSE(Reader.GetAssetInfoView(Reader.GetAssetCount()).has_value());
+        CHECK_FALSE(Reader.FindAssetView(MakeTestId(200)).has_value());
+        CHECK_FALSE(Reader.FindAssetViewByName("Views/").has_value());
+    }
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Compressed index arrays read the same as a plain index", "[pack][reader]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+
+    auto MakeEntry = [](const uint32_t I) {
+        AssetPackEntry Entry{};
+        Entry.Id = MakeTestId(static_cast<uint8_t>(I));
+        Entry.Id.Bytes[15] = static_cast<uint8_t>(I >> 8);
+        Entry.AssetKind = kTestAssetKind;
+        Entry.Name = "Index/" + std::to_string(I);
+        Entry.Cooked = TypedPayload(kTestPayloadType, 2, MakePatternBytes(48, static_cast<uint8_t>(I)));
+        for (uint32_t Mip = 0; Mip < I % 3; ++Mip)
+        {
+            BulkChunk Chunk(EBulkSemantic::Reserved_Level, Mip, false);
+            Chunk.Bytes = MakePatternBytes(96, static_cast<uint8_t>(I + Mip));
+            Entry.Bulk.push_back(std::move(Chunk));
+        }
+        if (I % 5 == 0)
+        {
+            Entry.AssetDependencies.push_back(AssetDependencyRef{MakeTestId(static_cast<uint8_t>(I + 1)), "", EAssetDependencyKind::Optional});
+        }
+        return Entry;
+    };
+
+    auto ReadIndexHeaders = [](const std::filesystem::path& PackPath) {
+        Pack::SnPakHeaderV1 Header{};
+        Pack::SnPakIndexHeaderV1 IndexHeader{};
+        std::ifstream In(PackPath, std::ios::binary);
+        In.read(reinterpret_cast<char*>(&Header), sizeof(Header));
+        In.seekg(static_cast<std::streamoff>(Header.IndexOffset));
+        In.read(reinterpret_cast<char*>(&IndexHeader), sizeof(IndexHeader));
+        REQUIRE(In.good());
+        return std::make_pair(Header, IndexHeader);
+    };
+
+    AssetPackReadOptions Options;
+    Options.bVerifyIndexEntriesHash = true;
+    Options.bVerifyIndexBlockHash = true;
+
+    // Every asset of Compressed must match Plain, including bulk chunks and dependencies
+    auto CheckSameAssets = [&](const AssetPackReader& Plain, const AssetPackReader& Compressed) {
+        REQUIRE(Compressed.GetAssetCount() == Plain.GetAssetCount());
+        for (uint32_t I = 0; I < Plain.GetAssetCount(); ++I)
+        {
+            const auto Expected = Plain.GetAssetInfo(I);
+            REQUIRE(Expected.has_value());
+            const auto View = Compressed.FindAssetViewByName(Expected->Name);
+            REQUIRE(View.has_value());
+            CHECK(View->Id == Expected->Id);
+            CHECK(View->AssetKind == Expected->AssetKind);
+            CHECK(View->CookedPayloadType == Expected->CookedPayloadType);
+            REQUIRE(View->BulkChunkCount == Expected->BulkChunkCount);
+            REQUIRE(View->DependencyCount == Expected->AssetDependencies.size());
+            for (uint32_t Dependency = 0; Dependency < View->DependencyCount; ++Dependency)
+            {
+                const auto DependencyView = Compressed.GetAssetDependency(View->Index, Dependency);
+                REQUIRE(DependencyView.has_value());
+                CHECK(DependencyView->Id == Expected->AssetDependencies[Dependency].Id);
+            }
+
+            const auto Payload = Compressed.LoadCookedPayload(Expected->Id);
+            REQUIRE(Payload.has_value());
+            CHECK(Payload->Bytes == Plain.LoadCookedPayload(Expected->Id)->Bytes);
+            for (uint32_t Mip = 0; Mip < View->BulkChunkCount; ++Mip)
+            {
+                const auto Bulk = Compressed.LoadBulkChunk(Expected->Id, Mip);
+                REQUIRE(Bulk.has_value());
+                CHECK(*Bulk == *Plain.LoadBulkChunk(Expected->Id, Mip));
+            }
+        }
+    };
+
+    for (const bool bLookupTables : {true, false})
+    {
+        const std::string Suffix = bLookupTables ? "_lookup.snpak" : "_maps.snpak";
+        const auto PlainPath = TempDir / ("plain" + Suffix);
+        const auto CompressedPath = TempDir / ("compressed" + Suffix);
+        for (const bool bCompressIndex : {false, true})
+        {
+            AssetPackWriter Writer;
+            Writer.SetCompression(EPackCompression::None);
+            Writer.SetWriteLookupTables(bLookupTables);
+            Writer.SetCompressIndex(bCompressIndex);
+            for (uint32_t I = 0; I < 600; ++I)
+            {
+                Writer.AddAsset(MakeEntry(I));
+            }
+            REQUIRE(Writer.Write((bCompressIndex ? CompressedPath : PlainPath).string()).has_value());
+        }
+
+        const auto [PlainHeader, PlainIndex] = ReadIndexHeaders(PlainPath);
+        const auto [CompressedHeader, CompressedIndex] = ReadIndexHeaders(CompressedPath);
+        CHECK((Pack::GetIndexFlags(PlainIndex) & Pack::IndexFlag_CompressedArrays) == 0);
+        CHECK((Pack::GetIndexFlags(CompressedIndex) & Pack::IndexFlag_CompressedArrays) != 0);
+        CHECK(CompressedIndex.EntriesHashHi == PlainIndex.EntriesHashHi);
+        CHECK(CompressedIndex.EntriesHashLo == PlainIndex.EntriesHashLo);
+        CHECK(CompressedHeader.IndexSize * 4 < PlainHeader.IndexSize);
+
+        AssetPackReader Plain;
+        AssetPackReader Compressed;
+        REQUIRE(Plain.Open(PlainPath.string(), Options).has_value());
+        REQUIRE(Compressed.Open(CompressedPath.string(), Options).has_value());
+        CHECK_FALSE(Plain.IsIndexCompressed());
+        CHECK(Compressed.IsIndexCompressed());
+        CheckSameAssets(Plain, Compressed);
+        Compressed.Close();
+
+        // Updates and compaction keep the index compressed without the writer asking for it
+        {
+            AssetPackWriter Writer;
+            Writer.SetCompression(EPackCompression::None);
+            Writer.SetWriteLookupTables(bLookupTables);
+            Writer.AddAsset(MakeEntry(7));
+            REQUIRE(Writer.AppendUpdate(CompressedPath.string()).has_value());
+            REQUIRE(Writer.Compact(CompressedPath.string()).has_value());
+        }
+        REQUIRE(Compressed.Open(CompressedPath.string(), Options).has_value());
+        CHECK(Compressed.IsIndexCompressed());
+        CheckSameAssets(Plain, Compressed);
+
+        Plain.Close();
+        Compressed.Close();
+    }
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("An empty compressed index still reports its encoding", "[pack][reader]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto PackPath = TempDir / "emptyindex.snpak";
+    {
+        AssetPackWriter Writer;
+        Writer.SetCompressIndex(true);
+        REQUIRE(Writer.Write(PackPath.string()).has_value());
+    }
+
+    AssetPackReader Reader;
+    REQUIRE(Reader.Open(PackPath.string()).has_value());
+    CHECK(Reader.GetAssetCount() == 0);
+    CHECK(Reader.IsIndexCompressed());
+    Reader.Close();
+    CHECK_FALSE(Reader.IsIndexCompressed());
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Compressed index keeps only a bounded set of decoded blocks resident", "[pack][reader]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto PlainPath = TempDir / "plain.snpak";
+    const auto CompressedPath = TempDir / "compressed.snpak";
+    constexpr uint32_t kAssetCount = 2000;
+    auto MakeEntry = [](const uint32_t I) {
+        AssetPackEntry Entry{};
+        Entry.Id = MakeTestId(static_cast<uint8_t>(I));
+        Entry.Id.Bytes[15] = static_cast<uint8_t>(I >> 8);
+        Entry.AssetKind = kTestAssetKind;
+        Entry.Name = "Resident/" + std::to_string(I);
+        Entry.Cooked = TypedPayload(kTestPayloadType, 1, MakePatternBytes(16, static_cast<uint8_t>(I)));
+        BulkChunk Chunk(EBulkSemantic::Reserved_Level, 0, false);
+        Chunk.Bytes = MakePatternBytes(32, static_cast<uint8_t>(I + 1));
+        Entry.Bulk.push_back(std::move(Chunk));
+        Entry.AssetDependencies.push_back(AssetDependencyRef{MakeTestId(static_cast<uint8_t>(I + 1)), "", EAssetDependencyKind::Required});
+        return Entry;
+    };
+    for (const bool bCompressIndex : {false, true})
+    {
+        AssetPackWriter Writer;
+        Writer.SetCompression(EPackCompression::None);
+        Writer.SetCompressIndex(bCompressIndex);
+        for (uint32_t I = 0; I < kAssetCount; ++I)
+        {
+            Writer.AddAsset(MakeEntry(I));
+        }
+        REQUIRE(Writer.Write((bCompressIndex ? CompressedPath : PlainPath).string()).has_value());
+    }
+
+    AssetPackReadOptions Options;
+    Options.bVerifyIndexEntriesHash = true;
+    Options.IndexBlockCacheSize = 64 * 1024;
+    constexpr uint64_t kRawArraysSize = kAssetCount * (sizeof(Pack::SnPakIndexEntryV1) + sizeof(Pack::SnPakBulkEntryV1) +
+                                                       sizeof(Pack::SnPakDependencyOwnerV1) + sizeof(Pack::SnPakDependencyEntryV1));
+    static_assert(kRawArraysSize > 4 * 64 * 1024);
+
+    AssetPackReader Plain;
+    REQUIRE(Plain.Open(PlainPath.string(), Options).has_value());
+    CHECK(Plain.GetIndexMemoryUsage() == 0);
+
+    AssetPackReader Compressed;
+    REQUIRE(Compressed.Open(CompressedPath.string(), Options).has_value());
+    REQUIRE(Compressed.IsIndexCompressed());
+    CHECK(Compressed.GetIndexMemoryUsage() < kRawArraysSize);
+
+    // Touching every record cycles blocks through the cache without exceeding its budget
+    for (uint32_t I = 0; I < kAssetCount; ++I)
+    {
+        const auto Expected = MakeEntry(I);
+        const auto View = Compressed.FindAssetViewByName(Expected.Name);
+        REQUIRE(View.has_value());
+        CHECK(View->Id == Expected.Id);
+        REQUIRE(View->DependencyCount == 1);
+        const auto Dependency = Compressed.GetAssetDependency(View->Index, 0);
+        REQUIRE(Dependency.has_value());
+        CHECK(Dependency->Id == Expected.AssetDependencies[0].Id);
+        const auto Bulk = Compressed.LoadBulkChunk(Expected.Id, 0);
+        REQUIRE(Bulk.has_value());
+        CHECK(*Bulk == Expected.Bulk[0].Bytes);
+        CHECK(Compressed.GetIndexMemoryUsage() <= Options.IndexBlockCacheSize);
+    }
+    CHECK(Compressed.GetIndexMemoryUsage() > 0);
+    CHECK(Plain.GetIndexMemoryUsage() == 0);
+
+    Compressed.Close();
+    CHECK(Compressed.GetIndexMemoryUsage() == 0);
+    Plain.Close();
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Corrupted compressed index fails to open", "[pack][reader]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto PackPath = TempDir / "badindex.snpak";
+    {
+        AssetPackWriter Writer;
+        Writer.SetCompressIndex(true);
+        for (uint32_t I = 0; I < 32; ++I)
+        {
+            AssetPackEntry Entry{};
+            Entry.Id = MakeTestId(static_cast<uint8_t>(I));
+            Entry.AssetKind = kTestAssetKind;
+            Entry.Name = "Broken/" + std::to_string(I);
+            Entry.Cooked = TypedPayload(kTestPayloadType, 1, MakePatternBytes(16, static_cast<uint8_t>(I)));
+            Writer.AddAsset(std::move(Entry));
+        }
+        REQUIRE(Writer.Write(PackPath.string()).has_value());
+    }
+
+    Pack::SnPakHeaderV1 Header{};
+    {
+        std::ifstream In(PackPath, std::ios::binary);
+        In.read(reinterpret_cast<char*>(&Header), sizeof(Header));
+        REQUIRE(In.good());
+    }
+    {
+        std::fstream File(PackPath, std::ios::binary | std::ios::in | std::ios::out);
+        File.seekp(static_cast<std::streamoff>(Header.IndexOffset + sizeof(Pack::SnPakIndexHeaderV1) + 8));
+        File.put('X');
+        File.put('X');
+    }
+
+    AssetPackReader Reader;
+    CHECK_FALSE(Reader.Open(PackPath.string()).has_value());
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Compressed index with inflated counts is rejected before decoding", "[pack][reader]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto PackPath = TempDir / "inflated.snpak";
+    {
+        AssetPackWriter Writer;
+        Writer.SetCompressIndex(true);
+        AssetPackEntry Entry{};
+        Entry.Id = MakeTestId(1);
+        Entry.AssetKind = kTestAssetKind;
+        Entry.Name = "Inflated";
+        Entry.Cooked = TypedPayload(kTestPayloadType, 1, MakePatternBytes(16, 1));
+        Writer.AddAsset(std::move(Entry));
+        REQUIRE(Writer.Write(PackPath.string()).has_value());
+    }
+
+    Pack::SnPakHeaderV1 Header{};
+    Pack::SnPakIndexHeaderV1 IndexHeader{};
+    {
+        std::ifstream In(PackPath, std::ios::binary);
+        In.read(reinterpret_cast<char*>(&Header), sizeof(Header));
+        In.seekg(static_cast<std::streamoff>(Header.IndexOffset));
+        In.read(reinterpret_cast<char*>(&IndexHeader), sizeof(IndexHeader));
+        REQUIRE(In.good());
+    }
+    // Within the reader's sanity limits, but the arrays they imply would take gigabytes
+    IndexHeader.BulkEntryCount += 50'000'000;
+    {
+        std::fstream File(PackPath, std::ios::binary | std::ios::in | std::ios::out);
+        File.seekp(static_cast<std::streamoff>(Header.IndexOffset));
+        File.write(reinterpret_cast<const char*>(&IndexHeader), sizeof(IndexHeader));
+    }
+
+    AssetPackReader Reader;
+    auto Opened = Reader.Open(PackPath.string());
+    REQUIRE_FALSE(Opened.has_value());
+    CHECK(Opened.error().find("Compressed index size") != std::string::npos);
+
+    AssetPackWriter Writer;
+    AssetPackEntry Update{};
+    Update.Id = MakeTestId(2);
+    Update.AssetKind = kTestAssetKind;
+    Update.Name = "Update";
+    Update.Cooked = TypedPayload(kTestPayloadType, 1, MakePatternBytes(16, 2));
+    Writer.AddAsset(std::move(Update));
+    auto Appended = Writer.AppendUpdate(PackPath.string());
+    REQUIRE_FALSE(Appended.has_value());
+    CHECK(Appended.error().find("Compressed index size") != std::string::npos);
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Corrupted lookup block fails to open", "[pack][reader]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto PackPath = TempDir / "badlookup.snpak";
+    WriteMixedPack(PackPath);
+
+    Pack::SnPakHeaderV1 Header{};
+    Pack::SnPakIndexHeaderV1 IndexHeader{};
+    {
+        std::ifstream In(PackPath, std::ios::binary);
+        In.read(reinterpret_cast<char*>(&Header), sizeof(Header));
+        In.seekg(static_cast<std::streamoff>(Header.IndexOffset));
+        In.read(reinterpret_cast<char*>(&IndexHeader), sizeof(IndexHeader));
+        REQUIRE(In.good());
+    }
+    REQUIRE((Pack::GetIndexFlags(IndexHeader) & Pack::IndexFlag_HasLookupBlock) != 0);
+    {
+        std::fstream File(PackPath, std::ios::binary | std::ios::in | std::ios::out);
+        File.seekp(static_cast<std::streamoff>(Pack::GetLookupBlockOffset(IndexHeader)));
+        File.put('X');
+    }
+
+    AssetPackReader Reader;
+    auto Result = Reader.Open(PackPath.string());
+    REQUIRE_FALSE(Result.has_value());
+    CHECK(Result.error().find("lookup") != std::string::npos);
+
+    std::filesystem::remove_all(TempDir);
+}
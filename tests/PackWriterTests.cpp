@@ -0,0 +1,1311 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "AssetPackReader.h"
+#include "AssetPackWriter.h"
+#include "Pack/SnPakFormat.h"
+#include "Uuid.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <thread>
+
+using namespace SnAPI::AssetPipeline;
+
+namespace
+{
+    std::filesystem::path MakeUniqueTempDir()
+    {
+        const auto Base = std::filesystem::temp_directory_path();
+        const auto Stamp = std::chrono::steady_clock::now().time_since_epoch().count();
+        const auto Dir = Base / ("snapi_assetpipeline_packwriter_" + std::to_string(Stamp));
+        std::filesystem::create_directories(Dir);
+        return Dir;
+    }
+
+    std::vector<uint8_t> ReadFileBytes(const std::filesystem::path& Path)
+    {
+        std::ifstream File(Path, std::ios::binary);
+        return std::vector<uint8_t>(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>());
+    }
+
+    AssetId MakeTestId(const uint32_t Seed)
+    {
+        AssetId Id{};
+        for (uint32_t Byte = 0; Byte < 16; ++Byte)
+        {
+            Id.Bytes[Byte] = static_cast<uint8_t>(Seed * 31u + Byte * 7u + 1u);
+        }
+        return Id;
+    }
+
+    // Semi-compressible bytes: a repeating ramp with sparse noise
+    std::vector<uint8_t> MakeTestBytes(std::mt19937& Rng, const size_t Size)
+    {
+        std::vector<uint8_t> Bytes(Size);
+        for (size_t I = 0; I < Size; ++I)
+        {
+            Bytes[I] = (I % 7 == 0) ? static_cast<uint8_t>(Rng()) : static_cast<uint8_t>(I / 13);
+        }
+        return Bytes;
+    }
+
+    const TypeId kTestAssetKind = SNAPI_UUID(0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7,
+                                             0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef);
+    const TypeId kTestPayloadType = SNAPI_UUID(0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+                                               0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff);
+
+    void AddTestAssets(const AssetPackWriter& Writer, const uint32_t First, const uint32_t Count, const uint32_t Seed)
+    {
+        std::mt19937 Rng(Seed);
+        for (uint32_t I = First; I < First + Count; ++I)
+        {
+            AssetPackEntry Entry{};
+            Entry.Id = MakeTestId(I);
+            Entry.AssetKind = kTestAssetKind;
+            Entry.Name = "Assets/" + std::to_string(I);
+            Entry.Cooked = TypedPayload(kTestPayloadType, 1, MakeTestBytes(Rng, 64 + Rng() % 8192));
+            if (I % 3 == 0)
+            {
+                for (uint32_t Mip = 0; Mip < 4; ++Mip)
+                {
+                    BulkChunk Chunk(EBulkSemantic::Reserved_Level, Mip, Mip != 3);
+                    Chunk.Bytes = MakeTestBytes(Rng, 1024 + Rng() % 65536);
+                    Entry.Bulk.push_back(std::move(Chunk));
+                }
+            }
+            if (I % 5 == 0)
+            {
+                Entry.CompressionOverride = EPackCompression::LZ4HC;
+            }
+            Writer.AddAsset(std::move(Entry));
+        }
+    }
+}
+
+TEST_CASE("Parallel chunk compression produces identical packs", "[pack]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+
+    auto BuildPack = [&](const std::string& FileName, const uint32_t Threads) {
+        const auto PackPath = TempDir / FileName;
+        {
+            AssetPackWriter Writer;
+            Writer.SetCompression(EPackCompression::Zstd);
+            Writer.SetCompressionThreads(Threads);
+            AddTestAssets(Writer, 0, 96, 1234);
+            REQUIRE(Writer.Write(PackPath.string()).has_value());
+        }
+        {
+            AssetPackWriter Writer;
+            Writer.SetCompression(EPackCompression::LZ4);
+            Writer.SetCompressionThreads(Threads);
+            AddTestAssets(Writer, 80, 32, 5678);
+            REQUIRE(Writer.AppendUpdate(PackPath.string()).has_value());
+        }
+        return PackPath;
+    };
+
+    const auto SerialPack = BuildPack("Serial.snpak", 1);
+    const auto ParallelPack = BuildPack("Parallel.snpak", 8);
+    REQUIRE(ReadFileBytes(SerialPack) == ReadFileBytes(ParallelPack));
+
+    AssetPackReader Reader;
+    REQUIRE(Reader.Open(ParallelPack.string()).has_value());
+    REQUIRE(Reader.GetAssetCount() == 112);
+    for (uint32_t I = 0; I < Reader.GetAssetCount(); ++I)
+    {
+        auto Info = Reader.GetAssetInfo(I);
+        REQUIRE(Info.has_value());
+        REQUIRE(Reader.LoadCookedPayload(Info->Id).has_value());
+        for (uint32_t Bulk = 0; Bulk < Info->BulkChunkCount; ++Bulk)
+        {
+            REQUIRE(Reader.LoadBulkChunk(Info->Id, Bulk).has_value());
+        }
+    }
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Streaming write produces a pack with the same contents as a buffered write", "[pack]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto BufferedPath = TempDir / "Buffered.snpak";
+    const auto StreamedPath = TempDir / "Streamed.snpak";
+
+    {
+        AssetPackWriter Writer;
+        AddTestAssets(Writer, 0, 64, 42);
+        REQUIRE(Writer.Write(BufferedPath.string()).has_value());
+    }
+    {
+        AssetPackWriter Writer;
+        Writer.SetStreamingBudget(128 * 1024);
+        REQUIRE(Writer.BeginStreamingWrite(StreamedPath.string()).has_value());
+        REQUIRE(Writer.IsStreaming());
+        AddTestAssets(Writer, 0, 64, 42);
+        REQUIRE(Writer.GetPendingAssetCount() == 64);
+        REQUIRE(std::filesystem::file_size(StreamedPath.string() + ".tmp") > 128 * 1024);
+        REQUIRE_FALSE(Writer.AppendUpdate(StreamedPath.string()).has_value());
+        REQUIRE(Writer.Write(StreamedPath.string()).has_value());
+        REQUIRE_FALSE(Writer.IsStreaming());
+    }
+
+    AssetPackReader Buffered;
+    AssetPackReader Streamed;
+    REQUIRE(Buffered.Open(BufferedPath.string()).has_value());
+    REQUIRE(Streamed.Open(StreamedPath.string()).has_value());
+    REQUIRE(Streamed.GetAssetCount() == Buffered.GetAssetCount());
+
+    for (uint32_t I = 0; I < Buffered.GetAssetCount(); ++I)
+    {
+        auto Expected = Buffered.GetAssetInfo(I);
+        auto Actual = Streamed.GetAssetInfo(I);
+        REQUIRE(Expected.has_value());
+        REQUIRE(Actual.has_value());
+        REQUIRE(Actual->Id == Expected->Id);
+        REQUIRE(Actual->Name == Expected->Name);
+        REQUIRE(Actual->BulkChunkCount == Expected->BulkChunkCount);
+        REQUIRE(Streamed.LoadCookedPayload(Actual->Id)->Bytes == Buffered.LoadCookedPayload(Expected->Id)->Bytes);
+        for (uint32_t Bulk = 0; Bulk < Expected->BulkChunkCount; ++Bulk)
+        {
+            REQUIRE(*Streamed.LoadBulkChunk(Actual->Id, Bulk) == *Buffered.LoadBulkChunk(Expected->Id, Bulk));
+        }
+    }
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Clearing a streaming write removes its temp file", "[pack]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto PackPath = TempDir / "Abandoned.snpak";
+
+    AssetPackWriter Writer;
+    Writer.SetStreamingBudget(1);
+    REQUIRE(Writer.BeginStreamingWrite(PackPath.string()).has_value());
+    AddTestAssets(Writer, 0, 4, 7);
+    REQUIRE(std::filesystem::exists(PackPath.string() + ".tmp"));
+
+    Writer.Clear();
+    REQUIRE_FALSE(Writer.IsStreaming());
+    REQUIRE(Writer.GetPendingAssetCount() == 0);
+    REQUIRE_FALSE(std::filesystem::exists(PackPath.string() + ".tmp"));
+    REQUIRE_FALSE(std::filesystem::exists(PackPath));
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Identical chunks are written once and shared by every entry", "[pack]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    std::mt19937 Rng(99);
+    const std::vector<uint8_t> SharedPayload = MakeTestBytes(Rng, 32 * 1024);
+    const std::vector<uint8_t> SharedMip = MakeTestBytes(Rng, 128 * 1024);
+
+    auto AddSharedAssets = [&](const AssetPackWriter& Writer, const uint32_t First, const uint32_t Count) {
+        for (uint32_t I = First; I < First + Count; ++I)
+        {
+            AssetPackEntry Entry{};
+            Entry.Id = MakeTestId(I);
+            Entry.AssetKind = kTestAssetKind;
+            Entry.Name = "Shared/" + std::to_string(I);
+            Entry.Cooked = TypedPayload(kTestPayloadType, 1, SharedPayload);
+            for (uint32_t Mip = 0; Mip < 2; ++Mip)
+            {
+                BulkChunk Chunk(EBulkSemantic::Reserved_Level, Mip, true);
+                Chunk.Bytes = SharedMip;
+                Entry.Bulk.push_back(std::move(Chunk));
+            }
+            Writer.AddAsset(std::move(Entry));
+        }
+    };
+
+    auto BuildPack = [&](const std::string& FileName, const bool bDeduplicate) {
+        const auto PackPath = TempDir / FileName;
+        AssetPackWriter Writer;
+        Writer.SetDeduplicateChunks(bDeduplicate);
+        AddSharedAssets(Writer, 0, 8);
+        REQUIRE(Writer.Write(PackPath.string()).has_value());
+        return PackPath;
+    };
+
+    const auto DedupPath = BuildPack("Dedup.snpak", true);
+    const auto PlainPath = BuildPack("Plain.snpak", false);
+    const auto DedupSize = std::filesystem::file_size(DedupPath);
+    const auto PlainSize = std::filesystem::file_size(PlainPath);
+    // 8 payloads + 16 mips collapse into one payload chunk and one bulk chunk
+    REQUIRE(DedupSize * 4 < PlainSize);
+
+    // Appending the same content again reuses the chunks already in the pack
+    {
+        AssetPackWriter Writer;
+        AddSharedAssets(Writer, 8, 4);
+        REQUIRE(Writer.AppendUpdate(DedupPath.string()).has_value());
+    }
+    REQUIRE(std::filesystem::file_size(DedupPath) < DedupSize + 8 * 1024);
+
+    AssetPackReadOptions Options;
+    Options.bVerifyChunkHash = true;
+    Options.bValidateChunkBounds = true;
+    Options.bValidateChunkSizes = true;
+    Options.bValidateChunkIdentity = true;
+
+    AssetPackReader Reader;
+    REQUIRE(Reader.Open(DedupPath.string(), Options).has_value());
+    REQUIRE(Reader.GetAssetCount() == 12);
+    for (uint32_t I = 0; I < Reader.GetAssetCount(); ++I)
+    {
+        auto Info = Reader.GetAssetInfo(I);
+        REQUIRE(Info.has_value());
+        auto Payload = Reader.LoadCookedPayload(Info->Id);
+        REQUIRE(Payload.has_value());
+        REQUIRE(Payload->Bytes == SharedPayload);
+        REQUIRE(Info->BulkChunkCount == 2);
+        for (uint32_t Bulk = 0; Bulk < Info->BulkChunkCount; ++Bulk)
+        {
+            auto Mip = Reader.LoadBulkChunk(Info->Id, Bulk);
+            REQUIRE(Mip.has_value());
+            REQUIRE(*Mip == SharedMip);
+        }
+    }
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Chunk alignment puts chunk data on the requested boundary", "[pack]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto AlignedPath = TempDir / "Aligned.snpak";
+    const auto PlainPath = TempDir / "Plain.snpak";
+
+    for (const auto& [PackPath, Alignment] : {std::pair{AlignedPath, 4096u}, std::pair{PlainPath, 1u}})
+    {
+        AssetPackWriter Writer;
+        Writer.SetChunkAlignment(Alignment);
+        AddTestAssets(Writer, 0, 24, 4321);
+        REQUIRE(Writer.Write(PackPath.string()).has_value());
+    }
+    // Appending with a writer that was not asked for alignment keeps the pack aligned
+    for (const auto& PackPath : {AlignedPath, PlainPath})
+    {
+        AssetPackWriter Writer;
+        AddTestAssets(Writer, 24, 9, 8765);
+        REQUIRE(Writer.AppendUpdate(PackPath.string()).has_value());
+    }
+
+    AssetPackReadOptions Options;
+    Options.bVerifyChunkHash = true;
+    Options.bValidateChunkBounds = true;
+    Options.bValidateChunkSizes = true;
+    Options.bValidateChunkIdentity = true;
+
+    AssetPackReader Aligned;
+    AssetPackReader Plain;
+    REQUIRE(Aligned.Open(AlignedPath.string(), Options).has_value());
+    REQUIRE(Plain.Open(PlainPath.string(), Options).has_value());
+    REQUIRE(Aligned.GetChunkAlignment() == 4096);
+    REQUIRE(Plain.GetChunkAlignment() == 1);
+    REQUIRE(Aligned.GetAssetCount() == 33);
+
+    uint32_t ZeroCopyViews = 0;
+    for (uint32_t I = 0; I < Aligned.GetAssetCount(); ++I)
+    {
+        auto Info = Aligned.GetAssetInfo(I);
+        REQUIRE(Info.has_value());
+        REQUIRE(Aligned.LoadCookedPayload(Info->Id).value().Bytes == Plain.LoadCookedPayload(Info->Id).value().Bytes);
+        for (uint32_t Bulk = 0; Bulk < Info->BulkChunkCount; ++Bulk)
+        {
+            auto View = Aligned.LoadBulkChunkView(Info->Id, Bulk);
+            REQUIRE(View.has_value());
+            REQUIRE(View->ToVector() == Plain.LoadBulkChunk(Info->Id, Bulk).value());
+            if (View->IsZeroCopy())
+            {
+                CHECK(reinterpret_cast<uintptr_t>(View->GetData()) % 4096 == 0);
+                ++ZeroCopyViews;
+            }
+        }
+    }
+    // Every asset with bulk stores its last mip uncompressed
+    CHECK(ZeroCopyViews == 11);
+
+    // Requested alignments are rounded up to a power of two
+    {
+        const auto RoundedPath = TempDir / "Rounded.snpak";
+        AssetPackWriter Writer;
+        Writer.SetChunkAlignment(24);
+        AddTestAssets(Writer, 0, 4, 1);
+        REQUIRE(Writer.Write(RoundedPath.string()).has_value());
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(RoundedPath.string()).has_value());
+        CHECK(Reader.GetChunkAlignment() == 32);
+    }
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Auto compression picks a codec per chunk", "[pack]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    std::mt19937 Rng(2024);
+
+    // Noise does not compress; the ramp-with-noise bytes do
+    std::vector<uint8_t> Noise(96 * 1024);
+    for (auto& Byte : Noise)
+    {
+        Byte = static_cast<uint8_t>(Rng());
+    }
+    const std::vector<uint8_t> Compressible = MakeTestBytes(Rng, 48 * 1024);
+    const std::vector<uint8_t> LargeCompressible = MakeTestBytes(Rng, 300 * 1024);
+
+    auto AddAssets = [&](const AssetPackWriter& Writer) {
+        for (uint32_t I = 0; I < 2; ++I)
+        {
+            AssetPackEntry Entry{};
+            Entry.Id = MakeTestId(9000 + I);
+            Entry.AssetKind = kTestAssetKind;
+            Entry.Name = "Auto" + std::to_string(I);
+            // Both assets share identical payloads and bulk content
+            Entry.Cooked = TypedPayload(kTestPayloadType, 1, Compressible);
+
+            BulkChunk NoiseChunk(EBulkSemantic::Reserved_Level, 0, true);
+            NoiseChunk.Bytes = Noise;
+            Entry.Bulk.push_back(std::move(NoiseChunk));
+
+            BulkChunk LargeChunk(EBulkSemantic::Reserved_Level, 1, true);
+            LargeChunk.Bytes = LargeCompressible;
+            Entry.Bulk.push_back(std::move(LargeChunk));
+
+            // Explicitly raw chunks stay raw and do not count as Auto choices
+            BulkChunk RawChunk(EBulkSemantic::Reserved_Level, 2, false);
+            RawChunk.Bytes = std::vector<uint8_t>(1000 + I, 0x11);
+            Entry.Bulk.push_back(std::move(RawChunk));
+
+            Writer.AddAsset(std::move(Entry));
+        }
+    };
+
+    auto FindStats = [](const std::vector<PackCodecStats>& Stats, const EPackCompression Mode) -> const PackCodecStats* {
+        for (const auto& Entry : Stats)
+        {
+            if (Entry.Compression == Mode)
+            {
+                return &Entry;
+            }
+        }
+        return nullptr;
+    };
+
+    auto VerifyPack = [&](const std::filesystem::path& PackPath) {
+        AssetPackReadOptions Options;
+        Options.bVerifyChunkHash = true;
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(PackPath.string(), Options).has_value());
+        for (uint32_t I = 0; I < 2; ++I)
+        {
+            const AssetId Id = MakeTestId(9000 + I);
+            CHECK(Reader.LoadCookedPayload(Id).value().Bytes == Compressible);
+            CHECK(Reader.LoadBulkChunk(Id, 0).value() == Noise);
+            CHECK(Reader.LoadBulkChunk(Id, 1).value() == LargeCompressible);
+            CHECK(Reader.LoadBulkChunk(Id, 2).value() == std::vector<uint8_t>(1000 + I, 0x11));
+        }
+    };
+
+    SECTION("Default cost model compresses what compresses and stores the rest raw")
+    {
+        const auto PackPath = TempDir / "Auto.snpak";
+        AssetPackWriter Writer;
+        Writer.SetCompression(EPackCompression::Auto);
+        PackAutoCompressionSettings Settings;
+        Settings.SampleBytes = 64 * 1024; // the large chunk is scored on samples
+        Writer.SetAutoCompressionSettings(Settings);
+        AddAssets(Writer);
+        REQUIRE(Writer.Write(PackPath.string()).has_value());
+        VerifyPack(PackPath);
+
+        const auto Stats = Writer.GetCompressionStats();
+        const PackCodecStats* Raw = FindStats(Stats, EPackCompression::None);
+        REQUIRE(Raw != nullptr);
+        // Noise (once, deduplicated) plus the two explicitly raw chunks
+        CHECK(Raw->ChunkCount == 3);
+        CHECK(Raw->AutoChunkCount == 1);
+        CHECK(Raw->StoredBytes == Raw->UncompressedBytes);
+
+        uint32_t AutoCompressed = 0;
+        uint32_t TotalChunks = 0;
+        for (const auto& Entry : Stats)
+        {
+            TotalChunks += Entry.ChunkCount;
+            if (Entry.Compression != EPackCompression::None)
+            {
+                AutoCompressed += Entry.AutoChunkCount;
+                CHECK(Entry.StoredBytes < Entry.UncompressedBytes);
+            }
+        }
+        // Payload and large chunk, each stored once
+        CHECK(AutoCompressed == 2);
+        CHECK(TotalChunks == 5);
+    }
+
+    SECTION("A heavy decode cost weight keeps every chunk raw")
+    {
+        const auto PackPath = TempDir / "Raw.snpak";
+        AssetPackWriter Writer;
+        Writer.SetCompression(EPackCompression::Auto);
+        PackAutoCompressionSettings Settings;
+        Settings.DecodeCostWeight = 100.0;
+        Writer.SetAutoCompressionSettings(Settings);
+        AddAssets(Writer);
+        REQUIRE(Writer.Write(PackPath.string()).has_value());
+        VerifyPack(PackPath);
+
+        const auto Stats = Writer.GetCompressionStats();
+        REQUIRE(Stats.size() == 1);
+        CHECK(Stats[0].Compression == EPackCompression::None);
+        CHECK(Stats[0].AutoChunkCount == 3);
+    }
+
+    SECTION("Only the configured candidates are tried")
+    {
+        const auto PackPath = TempDir / "Lz4.snpak";
+        AssetPackWriter Writer;
+        Writer.SetCompression(EPackCompression::Auto);
+        PackAutoCompressionSettings Settings;
+        Settings.Candidates = {{EPackCompression::LZ4, EPackCompressionLevel::Default}};
+        Writer.SetAutoCompressionSettings(Settings);
+        AddAssets(Writer);
+        REQUIRE(Writer.Write(PackPath.string()).has_value());
+        VerifyPack(PackPath);
+
+        const auto Stats = Writer.GetCompressionStats();
+        REQUIRE(Stats.size() == 2);
+        const PackCodecStats* Lz4 = FindStats(Stats, EPackCompression::LZ4);
+        REQUIRE(Lz4 != nullptr);
+        CHECK(Lz4->AutoChunkCount == 2);
+
+        // Appending the same content reuses the stored chunks
+        AssetPackWriter Appender;
+        Appender.SetCompression(EPackCompression::Auto);
+        AssetPackEntry Copy{};
+        Copy.Id = MakeTestId(9100);
+        Copy.AssetKind = kTestAssetKind;
+        Copy.Name = "AutoCopy";
+        Copy.Cooked = TypedPayload(kTestPayloadType, 1, Compressible);
+        Appender.AddAsset(std::move(Copy));
+        REQUIRE(Appender.AppendUpdate(PackPath.string()).has_value());
+        CHECK(Appender.GetCompressionStats().empty());
+    }
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Dictionary training shrinks small payloads of one asset kind", "[pack]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+
+    // Small records that share field names and layout but little within a single record
+    auto MakeRecord = [](std::mt19937& Rng, const uint32_t Index) {
+        std::string Text = "{\"name\":\"Material_" + std::to_string(Index) + "\",\"shader\":\"Standard/Lit\",\"params\":{";
+        for (const char* Field : {"baseColor", "metallic", "roughness", "emissive", "normalScale", "occlusion"})
+        {
+            Text += "\"" + std::string(Field) + "\":" + std::to_string(Rng() % 1000) + ",";
+        }
+        Text += "\"textures\":[\"Textures/Albedo_" + std::to_string(Rng() % 64) + "\",\"Textures/Normal_" + std::to_string(Rng() % 64) + "\"]}}";
+        return std::vector<uint8_t>(Text.begin(), Text.end());
+    };
+
+    auto AddRecords = [&](const AssetPackWriter& Writer, const uint32_t First, const uint32_t Count, const TypeId& Kind) {
+        std::mt19937 Rng(First);
+        for (uint32_t I = First; I < First + Count; ++I)
+        {
+            AssetPackEntry Entry{};
+            Entry.Id = Uuid::GenerateV5(kTestAssetKind, "Records/" + std::to_string(I));
+            Entry.AssetKind = Kind;
+            Entry.Name = "Records/" + std::to_string(I);
+            Entry.Cooked = TypedPayload(kTestPayloadType, 1, MakeRecord(Rng, I));
+            Writer.AddAsset(std::move(Entry));
+        }
+    };
+
+    auto VerifyRecords = [&](const AssetPackReader& Reader, const uint32_t First, const uint32_t Count) {
+        std::mt19937 Rng(First);
+        for (uint32_t I = First; I < First + Count; ++I)
+        {
+            auto Payload = Reader.LoadCookedPayload(Uuid::GenerateV5(kTestAssetKind, "Records/" + std::to_string(I)));
+            REQUIRE(Payload.has_value());
+            CHECK(Payload->Bytes == MakeRecord(Rng, I));
+        }
+    };
+
+    auto CountDictionaryChunks = [](const AssetPackWriter& Writer) {
+        uint32_t Count = 0;
+        for (const auto& Stats : Writer.GetCompressionStats())
+        {
+            Count += Stats.DictionaryChunkCount;
+        }
+        return Count;
+    };
+
+    PackDictionarySettings Settings;
+    Settings.bEnabled = true;
+
+    const auto PlainPath = TempDir / "Plain.snpak";
+    const auto DictPath = TempDir / "Dict.snpak";
+    {
+        AssetPackWriter Writer;
+        AddRecords(Writer, 0, 400, kTestAssetKind);
+        REQUIRE(Writer.Write(PlainPath.string()).has_value());
+        CHECK(CountDictionaryChunks(Writer) == 0);
+    }
+    {
+        AssetPackWriter Writer;
+        Writer.SetDictionaryTraining(Settings);
+        AddRecords(Writer, 0, 400, kTestAssetKind);
+        REQUIRE(Writer.Write(DictPath.string()).has_value());
+        CHECK(CountDictionaryChunks(Writer) == 400);
+    }
+    CHECK(std::filesystem::file_size(DictPath) < std::filesystem::file_size(PlainPath));
+
+    AssetPackReadOptions Options;
+    Options.bVerifyChunkHash = true;
+    {
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(PlainPath.string(), Options).has_value());
+        CHECK(Reader.GetDictionaryCount() == 0);
+    }
+    {
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(DictPath.string(), Options).has_value());
+        CHECK(Reader.GetDictionaryCount() == 1);
+        VerifyRecords(Reader, 0, 400);
+    }
+
+    SECTION("Kinds with too few samples get no dictionary")
+    {
+        const auto PackPath = TempDir / "Few.snpak";
+        AssetPackWriter Writer;
+        Writer.SetDictionaryTraining(Settings);
+        AddRecords(Writer, 0, Settings.MinSamples - 1, kTestAssetKind);
+        REQUIRE(Writer.Write(PackPath.string()).has_value());
+        CHECK(CountDictionaryChunks(Writer) == 0);
+
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(PackPath.string(), Options).has_value());
+        CHECK(Reader.GetDictionaryCount() == 0);
+    }
+
+    SECTION("AppendUpdate reuses the pack's dictionaries and trains new kinds")
+    {
+        const TypeId OtherKind = SNAPI_UUID(0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7,
+                                            0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf);
+        {
+            AssetPackWriter Appender;
+            Appender.SetDictionaryTraining(Settings);
+            AddRecords(Appender, 1000, 10, kTestAssetKind);
+            REQUIRE(Appender.AppendUpdate(DictPath.string()).has_value());
+            CHECK(CountDictionaryChunks(Appender) == 10);
+        }
+        {
+            AssetPackReader Reader;
+            REQUIRE(Reader.Open(DictPath.string(), Options).has_value());
+            CHECK(Reader.GetDictionaryCount() == 1);
+        }
+        {
+            AssetPackWriter Appender;
+            Appender.SetDictionaryTraining(Settings);
+            AddRecords(Appender, 2000, 200, OtherKind);
+            REQUIRE(Appender.AppendUpdate(DictPath.string()).has_value());
+            CHECK(CountDictionaryChunks(Appender) == 200);
+        }
+
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(DictPath.string(), Options).has_value());
+        CHECK(Reader.GetDictionaryCount() == 2);
+        VerifyRecords(Reader, 0, 400);
+        VerifyRecords(Reader, 1000, 10);
+        VerifyRecords(Reader, 2000, 200);
+    }
+
+    SECTION("A corrupted dictionary block is rejected by readers and updates")
+    {
+        Pack::SnPakHeaderV1 Header{};
+        {
+            std::ifstream In(DictPath, std::ios::binary);
+            In.read(reinterpret_cast<char*>(&Header), sizeof(Header));
+            REQUIRE(In.good());
+        }
+        REQUIRE(Pack::GetDictionaryBlockSize(Header) > 0);
+        {
+            std::fstream File(DictPath, std::ios::binary | std::ios::in | std::ios::out);
+            File.seekp(static_cast<std::streamoff>(Pack::GetDictionaryBlockOffset(Header) + Pack::GetDictionaryBlockSize(Header) - 1));
+            File.put('X');
+        }
+
+        AssetPackReader Reader;
+        auto Opened = Reader.Open(DictPath.string(), Options);
+        REQUIRE_FALSE(Opened.has_value());
+        CHECK(Opened.error().find("Dictionary block hash mismatch") != std::string::npos);
+
+        AssetPackWriter Appender;
+        AddRecords(Appender, 1000, 1, kTestAssetKind);
+        auto Appended = Appender.AppendUpdate(DictPath.string());
+        REQUIRE_FALSE(Appended.has_value());
+        CHECK(Appended.error().find("Dictionary block hash mismatch") != std::string::npos);
+    }
+
+    std::filesystem::remove_all(TempDir);
+}
+
+
+TEST_CASE("Solid blocks pack tiny payloads together", "[pack]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+
+    auto MakeTiny = [](const uint32_t Index) {
+        const std::string Text = "{\"id\":" + std::to_string(Index) + ",\"tag\":\"Prop_" + std::to_string(Index % 17) + "\"}";
+        return std::vector<uint8_t>(Text.begin(), Text.end());
+    };
+
+    auto AddTiny = [&](const AssetPackWriter& Writer, const uint32_t First, const uint32_t Count) {
+        for (uint32_t I = First; I < First + Count; ++I)
+        {
+            AssetPackEntry Entry{};
+            Entry.Id = Uuid::GenerateV5(kTestAssetKind, "Tiny/" + std::to_string(I));
+            Entry.AssetKind = kTestAssetKind;
+            Entry.Name = "Tiny/" + std::to_string(I);
+            Entry.Cooked = TypedPayload(kTestPayloadType, 3, MakeTiny(I));
+            Writer.AddAsset(std::move(Entry));
+        }
+    };
+
+    auto VerifyTiny = [&](const AssetPackReader& Reader, const uint32_t First, const uint32_t Count, const bool bExpectZeroCopy) {
+        for (uint32_t I = First; I < First + Count; ++I)
+        {
+            const AssetId Id = Uuid::GenerateV5(kTestAssetKind, "Tiny/" + std::to_string(I));
+            auto Payload = Reader.LoadCookedPayload(Id);
+            REQUIRE(Payload.has_value());
+            CHECK(Payload->Bytes == MakeTiny(I));
+            CHECK(Payload->PayloadType == kTestPayloadType);
+            CHECK(Payload->SchemaVersion == 3);
+
+            auto View = Reader.LoadCookedPayloadView(Id);
+            REQUIRE(View.has_value());
+            CHECK(View->Bytes.ToVector() == MakeTiny(I));
+            CHECK(View->Bytes.IsZeroCopy() == bExpectZeroCopy);
+        }
+    };
+
+    auto CountSolidPayloads = [](const AssetPackWriter& Writer) {
+        uint32_t Count = 0;
+        for (const auto& Stats : Writer.GetCompressionStats())
+        {
+            Count += Stats.SolidPayloadCount;
+        }
+        return Count;
+    };
+
+    PackSolidBlockSettings Settings;
+    Settings.MaxAssetSize = 256;
+    Settings.BlockSize = 4096;
+
+    AssetPackReadOptions Options;
+    Options.bVerifyChunkHash = true;
+    Options.bValidateChunkIdentity = true;
+
+    const auto PlainPath = TempDir / "Plain.snpak";
+    const auto SolidPath = TempDir / "Solid.snpak";
+    {
+        AssetPackWriter Writer;
+        AddTiny(Writer, 0, 500);
+        REQUIRE(Writer.Write(PlainPath.string()).has_value());
+        CHECK(CountSolidPayloads(Writer) == 0);
+    }
+    {
+        AssetPackWriter Writer;
+        Writer.SetSolidBlocks(Settings);
+        AddTiny(Writer, 0, 500);
+        REQUIRE(Writer.Write(SolidPath.string()).has_value());
+        CHECK(CountSolidPayloads(Writer) == 500);
+    }
+    CHECK(std::filesystem::file_size(SolidPath) < std::filesystem::file_size(PlainPath));
+
+    {
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(SolidPath.string(), Options).has_value());
+        VerifyTiny(Reader, 0, 500, false);
+    }
+
+    SECTION("Concurrent loads of the same blocks agree")
+    {
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(SolidPath.string(), Options).has_value());
+
+        // Threads race to decode and cache the same blocks; Catch2 assertions stay on this thread
+        std::vector<uint32_t> Mismatches(4, 0);
+        std::vector<std::thread> Threads;
+        for (size_t ThreadIndex = 0; ThreadIndex < Mismatches.size(); ++ThreadIndex)
+        {
+            Threads.emplace_back([&, ThreadIndex]() {
+                for (uint32_t I = 0; I < 500; ++I)
+                {
+                    auto View = Reader.LoadCookedPayloadView(Uuid::GenerateV5(kTestAssetKind, "Tiny/" + std::to_string(I)));
+                    if (!View.has_value() || View->Bytes.ToVector() != MakeTiny(I))
+                    {
+                        ++Mismatches[ThreadIndex];
+                    }
+                }
+            });
+        }
+        for (auto& Thread : Threads)
+        {
+            Thread.join();
+        }
+        for (const uint32_t Count : Mismatches)
+        {
+            CHECK(Count == 0);
+        }
+        VerifyTiny(Reader, 0, 500, false);
+    }
+
+    SECTION("Without a block cache every load decodes its block")
+    {
+        AssetPackReadOptions Uncached = Options;
+        Uncached.SolidBlockCacheSize = 0;
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(SolidPath.string(), Uncached).has_value());
+        VerifyTiny(Reader, 0, 500, false);
+    }
+
+    SECTION("Uncompressed blocks are served as zero-copy views")
+    {
+        const auto RawPath = TempDir / "Raw.snpak";
+        AssetPackWriter Writer;
+        Writer.SetCompression(EPackCompression::None);
+        Writer.SetSolidBlocks(Settings);
+        AddTiny(Writer, 0, 100);
+        REQUIRE(Writer.Write(RawPath.string()).has_value());
+        CHECK(CountSolidPayloads(Writer) == 100);
+
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(RawPath.string(), Options).has_value());
+        VerifyTiny(Reader, 0, 100, true);
+    }
+
+    SECTION("Large payloads and bulk chunks keep their own chunks")
+    {
+        const auto MixedPath = TempDir / "Mixed.snpak";
+        AssetPackWriter Writer;
+        Writer.SetSolidBlocks(Settings);
+        AddTiny(Writer, 0, 50);
+        AddTestAssets(Writer, 0, 12, 99);
+        REQUIRE(Writer.Write(MixedPath.string()).has_value());
+        CHECK(CountSolidPayloads(Writer) == 50);
+
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(MixedPath.string(), Options).has_value());
+        VerifyTiny(Reader, 0, 50, false);
+        for (uint32_t I = 0; I < Reader.GetAssetCount(); ++I)
+        {
+            auto Info = Reader.GetAssetInfo(I);
+            REQUIRE(Info.has_value());
+            REQUIRE(Reader.LoadCookedPayload(Info->Id).has_value());
+            for (uint32_t Bulk = 0; Bulk < Info->BulkChunkCount; ++Bulk)
+            {
+                REQUIRE(Reader.LoadBulkChunk(Info->Id, Bulk).has_value());
+            }
+        }
+    }
+
+    SECTION("Duplicate payloads share one member")
+    {
+        const auto DupPath = TempDir / "Dup.snpak";
+        AssetPackWriter Writer;
+        Writer.SetSolidBlocks(Settings);
+        for (uint32_t I = 0; I < 40; ++I)
+        {
+            AssetPackEntry Entry{};
+            Entry.Id = Uuid::GenerateV5(kTestAssetKind, "Dup/" + std::to_string(I));
+            Entry.AssetKind = kTestAssetKind;
+            Entry.Name = "Dup/" + std::to_string(I);
+            Entry.Cooked = TypedPayload(kTestPayloadType, 3, MakeTiny(I % 4));
+            Writer.AddAsset(std::move(Entry));
+        }
+        REQUIRE(Writer.Write(DupPath.string()).has_value());
+
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(DupPath.string(), Options).has_value());
+        for (uint32_t I = 0; I < 40; ++I)
+        {
+            auto Payload = Reader.LoadCookedPayload(Uuid::GenerateV5(kTestAssetKind, "Dup/" + std::to_string(I)));
+            REQUIRE(Payload.has_value());
+            CHECK(Payload->Bytes == MakeTiny(I % 4));
+        }
+    }
+
+    SECTION("AppendUpdate keeps existing members and adds new blocks")
+    {
+        AssetPackWriter Appender;
+        Appender.SetSolidBlocks(Settings);
+        AddTiny(Appender, 400, 200);
+        REQUIRE(Appender.AppendUpdate(SolidPath.string()).has_value());
+
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(SolidPath.string(), Options).has_value());
+        CHECK(Reader.GetAssetCount() == 600);
+        VerifyTiny(Reader, 0, 600, false);
+    }
+
+    SECTION("Streaming writes group each flushed batch")
+    {
+        const auto StreamedPath = TempDir / "Streamed.snpak";
+        AssetPackWriter Writer;
+        Writer.SetSolidBlocks(Settings);
+        Writer.SetStreamingBudget(8 * 1024);
+        REQUIRE(Writer.BeginStreamingWrite(StreamedPath.string()).has_value());
+        AddTiny(Writer, 0, 500);
+        REQUIRE(Writer.Write(StreamedPath.string()).has_value());
+        CHECK(CountSolidPayloads(Writer) > 0);
+
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(StreamedPath.string(), Options).has_value());
+        VerifyTiny(Reader, 0, 500, false);
+    }
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Compaction drops data replaced by append-updates", "[pack]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto PackPath = TempDir / "Chain.snpak";
+
+    // Everything a reader can observe about the active assets, keyed by index order
+    struct AssetSnapshot
+    {
+        AssetId Id;
+        std::string Name;
+        std::string VariantKey;
+        std::vector<std::string> DependencyNames;
+        std::vector<uint8_t> Payload;
+        std::vector<std::vector<uint8_t>> Bulk;
+
+        bool operator==(const AssetSnapshot&) const = default;
+    };
+
+    AssetPackReadOptions Options;
+    Options.bVerifyChunkHash = true;
+    Options.bValidateChunkBounds = true;
+    Options.bValidateChunkSizes = true;
+    Options.bValidateChunkIdentity = true;
+
+    auto Snapshot = [&]() {
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(PackPath.string(), Options).has_value());
+        std::vector<AssetSnapshot> Assets;
+        for (uint32_t I = 0; I < Reader.GetAssetCount(); ++I)
+        {
+            auto Info = Reader.GetAssetInfo(I);
+            REQUIRE(Info.has_value());
+            AssetSnapshot& Asset = Assets.emplace_back();
+            Asset.Id = Info->Id;
+            Asset.Name = Info->Name;
+            Asset.VariantKey = Info->VariantKey;
+            for (const auto& Dependency : Info->AssetDependencies)
+            {
+                Asset.DependencyNames.push_back(Dependency.LogicalName);
+            }
+            Asset.Payload = Reader.LoadCookedPayload(Info->Id).value().Bytes;
+            for (uint32_t Bulk = 0; Bulk < Info->BulkChunkCount; ++Bulk)
+            {
+                Asset.Bulk.push_back(Reader.LoadBulkChunk(Info->Id, Bulk).value());
+            }
+        }
+        return Assets;
+    };
+
+    auto AddDependent = [](const AssetPackWriter& Writer, const uint32_t Revision) {
+        AssetPackEntry Entry{};
+        Entry.Id = Uuid::GenerateV5(kTestAssetKind, "Levels/Main");
+        Entry.AssetKind = kTestAssetKind;
+        Entry.Name = "Levels/Main";
+        Entry.VariantKey = "rev" + std::to_string(Revision);
+        Entry.Cooked = TypedPayload(kTestPayloadType, 1, std::vector<uint8_t>(512, static_cast<uint8_t>(Revision)));
+        Entry.AssetDependencies = {AssetDependencyRef{MakeTestId(1), "Deps/" + std::to_string(Revision), EAssetDependencyKind::Required}};
+        Writer.AddAsset(std::move(Entry));
+    };
+
+    {
+        AssetPackWriter Writer;
+        Writer.SetChunkAlignment(4096);
+        Writer.SetBulkFraming(16 * 1024, AssetPackWriter::kMinBulkFrameSize);
+        PackSolidBlockSettings Solid;
+        Solid.MaxAssetSize = 1024;
+        Writer.SetSolidBlocks(Solid);
+        PackDictionarySettings Dictionaries;
+        Dictionaries.bEnabled = true;
+        Dictionaries.MinSamples = 8;
+        Writer.SetDictionaryTraining(Dictionaries);
+        AddTestAssets(Writer, 0, 48, 11);
+        AddDependent(Writer, 0);
+        REQUIRE(Writer.Write(PackPath.string()).has_value());
+    }
+    for (uint32_t Revision = 1; Revision <= 3; ++Revision)
+    {
+        AssetPackWriter Writer;
+        AddTestAssets(Writer, 0, 30, 100 + Revision);
+        AddTestAssets(Writer, 48 + Revision, 1, 200 + Revision);
+        AddDependent(Writer, Revision);
+        REQUIRE(Writer.AppendUpdate(PackPath.string()).has_value());
+    }
+
+    const auto Before = Snapshot();
+    REQUIRE(Before.size() == 52);
+    const uint64_t SizeBefore = std::filesystem::file_size(PackPath);
+
+    AssetPackWriter Compactor;
+    {
+        // Below the threshold the pack is left alone but the savings are reported
+        auto Result = Compactor.Compact(PackPath.string(), 0.99);
+        REQUIRE(Result.has_value());
+        CHECK_FALSE(Result->bCompacted);
+        CHECK(Result->SizeBefore == SizeBefore);
+        CHECK(Result->SizeAfter < SizeBefore);
+        CHECK(std::filesystem::file_size(PackPath) == SizeBefore);
+    }
+
+    auto Result = Compactor.Compact(PackPath.string(), 0.25);
+    REQUIRE(Result.has_value());
+    CHECK(Result->bCompacted);
+    CHECK(Result->SizeBefore == SizeBefore);
+    CHECK(Result->SizeAfter * 2 < SizeBefore);
+    CHECK(std::filesystem::file_size(PackPath) == Result->SizeAfter);
+    CHECK_FALSE(std::filesystem::exists(PackPath.string() + ".tmp"));
+
+    CHECK(Snapshot() == Before);
+    {
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(PackPath.string(), Options).has_value());
+        CHECK(Reader.GetChunkAlignment() == 4096);
+        CHECK(Reader.GetDictionaryCount() == 1);
+        CHECK(Reader.FindAsset(Uuid::GenerateV5(kTestAssetKind, "Levels/Main"))->VariantKey == "rev3");
+        CHECK(Reader.LoadBulkChunkRange(MakeTestId(30), 0, 100, 5000).has_value());
+    }
+
+    // A compacted pack has nothing left to reclaim and stays appendable
+    auto Again = Compactor.Compact(PackPath.string());
+    REQUIRE(Again.has_value());
+    CHECK(Again->SizeAfter == Again->SizeBefore);
+    {
+        AssetPackWriter Writer;
+        AddTestAssets(Writer, 0, 2, 999);
+        REQUIRE(Writer.AppendUpdate(PackPath.string()).has_value());
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(PackPath.string(), Options).has_value());
+        CHECK(Reader.GetAssetCount() == 52);
+    }
+
+    CHECK_FALSE(Compactor.Compact((TempDir / "Missing.snpak").string()).has_value());
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Merging packs copies chunks and lets later packs win", "[pack]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto PathA = TempDir / "A.snpak";
+    const auto PathB = TempDir / "B.snpak";
+    const auto PathC = TempDir / "C.snpak";
+    const auto MergedPath = TempDir / "Merged.snpak";
+
+    struct AssetSnapshot
+    {
+        AssetId Id;
+        std::string Name;
+        std::vector<std::string> DependencyNames;
+        std::vector<uint8_t> Payload;
+        std::vector<std::vector<uint8_t>> Bulk;
+
+        bool operator==(const AssetSnapshot&) const = default;
+    };
+
+    AssetPackReadOptions Options;
+    Options.bVerifyChunkHash = true;
+    Options.bValidateChunkBounds = true;
+    Options.bValidateChunkSizes = true;
+    Options.bValidateChunkIdentity = true;
+
+    auto Snapshot = [&](const std::filesystem::path& Path) {
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(Path.string(), Options).has_value());
+        std::vector<AssetSnapshot> Assets;
+        for (uint32_t I = 0; I < Reader.GetAssetCount(); ++I)
+        {
+            auto Info = Reader.GetAssetInfo(I);
+            REQUIRE(Info.has_value());
+            AssetSnapshot& Asset = Assets.emplace_back();
+            Asset.Id = Info->Id;
+            Asset.Name = Info->Name;
+            for (const auto& Dependency : Info->AssetDependencies)
+            {
+                Asset.DependencyNames.push_back(Dependency.LogicalName);
+            }
+            Asset.Payload = Reader.LoadCookedPayload(Info->Id).value().Bytes;
+            for (uint32_t Bulk = 0; Bulk < Info->BulkChunkCount; ++Bulk)
+            {
+                Asset.Bulk.push_back(Reader.LoadBulkChunk(Info->Id, Bulk).value());
+            }
+        }
+        return Assets;
+    };
+
+    // The same payload under a different asset in A and B (LZ4HC keeps A's dictionary out of it)
+    auto AddCopy = [](const AssetPackWriter& Writer, const uint32_t Seed) {
+        AssetPackEntry Entry{};
+        Entry.Id = MakeTestId(Seed);
+        Entry.AssetKind = kTestAssetKind;
+        Entry.Name = "Copies/" + std::to_string(Seed);
+        std::mt19937 Rng(7);
+        Entry.Cooked = TypedPayload(kTestPayloadType, 1, MakeTestBytes(Rng, 6000));
+        Entry.AssetDependencies = {AssetDependencyRef{MakeTestId(1), "Assets/1", EAssetDependencyKind::Required}};
+        Entry.CompressionOverride = EPackCompression::LZ4HC;
+        Writer.AddAsset(std::move(Entry));
+    };
+
+    {
+        AssetPackWriter Writer;
+        Writer.SetChunkAlignment(512);
+        PackSolidBlockSettings Solid;
+        Solid.MaxAssetSize = 1024;
+        Writer.SetSolidBlocks(Solid);
+        PackDictionarySettings Dictionaries;
+        Dictionaries.bEnabled = true;
+        Dictionaries.MinSamples = 8;
+        Writer.SetDictionaryTraining(Dictionaries);
+        AddTestAssets(Writer, 0, 40, 11);
+        AddCopy(Writer, 1000);
+        REQUIRE(Writer.Write(PathA.string()).has_value());
+    }
+    {
+        AssetPackWriter Writer;
+        Writer.SetChunkAlignment(4096);
+        Writer.SetBulkFraming(16 * 1024, AssetPackWriter::kMinBulkFrameSize);
+        AddTestAssets(Writer, 20, 40, 22);
+        AddCopy(Writer, 1001);
+        REQUIRE(Writer.Write(PathB.string()).has_value());
+    }
+    {
+        AssetPackWriter Writer;
+        AddTestAssets(Writer, 50, 5, 33);
+        REQUIRE(Writer.Write(PathC.string()).has_value());
+        AssetPackWriter Update;
+        AddTestAssets(Update, 50, 2, 44);
+        REQUIRE(Update.AppendUpdate(PathC.string()).has_value());
+    }
+
+    // Expected contents: first-seen order, last input's data
+    std::vector<AssetSnapshot> Expected;
+    uint32_t ExpectedDictionaries = 0;
+    for (const auto& Path : {PathA, PathB, PathC})
+    {
+        for (AssetSnapshot& Asset : Snapshot(Path))
+        {
+            const auto Existing = std::ranges::find(Expected, Asset.Id, &AssetSnapshot::Id);
+            if (Existing == Expected.end())
+            {
+                Expected.push_back(std::move(Asset));
+            }
+            else
+            {
+                *Existing = std::move(Asset);
+            }
+        }
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(Path.string()).has_value());
+        ExpectedDictionaries += Reader.GetDictionaryCount();
+    }
+    REQUIRE(Expected.size() == 62);
+
+    const std::vector<std::string> Inputs = {PathA.string(), PathB.string(), PathC.string()};
+    AssetPackWriter Merger;
+    auto Result = Merger.Merge(Inputs, MergedPath.string());
+    REQUIRE(Result.has_value());
+    CHECK(Result->AssetCount == 62);
+    CHECK(Result->ReplacedAssetCount == 25);
+    CHECK(Result->FileSize == std::filesystem::file_size(MergedPath));
+    CHECK_FALSE(std::filesystem::exists(MergedPath.string() + ".tmp"));
+
+    CHECK(Snapshot(MergedPath) == Expected);
+    {
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(MergedPath.string(), Options).has_value());
+        CHECK(Reader.GetChunkAlignment() == 4096);
+        CHECK(Reader.GetDictionaryCount() == ExpectedDictionaries);
+        CHECK(Reader.LoadBulkChunkRange(MakeTestId(30), 0, 100, 5000).has_value());
+    }
+
+    // The payload both inputs carry is stored once
+    {
+        AssetPackWriter Copier;
+        Copier.SetDeduplicateChunks(false);
+        auto Copied = Copier.Merge(Inputs, (TempDir / "Undeduplicated.snpak").string());
+        REQUIRE(Copied.has_value());
+        CHECK(Copied->ChunkCount == Result->ChunkCount + 1);
+        CHECK(Snapshot(TempDir / "Undeduplicated.snpak") == Expected);
+    }
+
+    // The merged pack is an ordinary pack: it can be appended to and compacted
+    {
+        AssetPackWriter Writer;
+        AddTestAssets(Writer, 0, 2, 999);
+        REQUIRE(Writer.AppendUpdate(MergedPath.string()).has_value());
+        REQUIRE(Merger.Compact(MergedPath.string()).has_value());
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(MergedPath.string(), Options).has_value());
+        CHECK(Reader.GetAssetCount() == 62);
+    }
+
+    CHECK_FALSE(Merger.Merge({}, MergedPath.string()).has_value());
+    CHECK_FALSE(Merger.Merge({PathA.string(), (TempDir / "Missing.snpak").string()}, MergedPath.string()).has_value());
+
+    std::filesystem::remove_all(TempDir);
+}
+
+TEST_CASE("Access-order profile lays chunks out in load order", "[pack]")
+{
+    const auto TempDir = MakeUniqueTempDir();
+    const auto ProfiledPath = TempDir / "Profiled.snpak";
+    const auto PlainPath = TempDir / "Plain.snpak";
+
+    // Uncompressed so payload views point into the mapping, in file order
+    auto AddAssets = [](const AssetPackWriter& Writer, const std::vector<uint32_t>& Seeds) {
+        for (const uint32_t Seed : Seeds)
+        {
+            AssetPackEntry Entry{};
+            Entry.Id = MakeTestId(Seed);
+            Entry.AssetKind = kTestAssetKind;
+            Entry.Name = "Assets/" + std::to_string(Seed);
+            Entry.Cooked = TypedPayload(kTestPayloadType, 1, std::vector<uint8_t>(100 + Seed, static_cast<uint8_t>(Seed)));
+            if (Seed == 0)
+            {
+                Entry.AssetDependencies = {AssetDependencyRef{MakeTestId(8), "", EAssetDependencyKind::Required},
+                                           AssetDependencyRef{MakeTestId(9), "", EAssetDependencyKind::Required}};
+            }
+            if (Seed == 4)
+            {
+                Entry.AssetDependencies = {AssetDependencyRef{MakeTestId(2), "", EAssetDependencyKind::Required}};
+            }
+            if (Seed == 6)
+            {
+                BulkChunk Chunk(EBulkSemantic::Reserved_Level, 0, false);
+                Chunk.Bytes = std::vector<uint8_t>(300, 6);
+                Entry.Bulk.push_back(std::move(Chunk));
+            }
+            Writer.AddAsset(std::move(Entry));
+        }
+    };
+
+    const std::vector<AssetId> Profile = {MakeTestId(5), MakeTestId(0), MakeTestId(6), MakeTestId(4),
+                                          MakeTestId(2), MakeTestId(5), MakeTestId(1000)};
+    // Profiled assets in load order, 0 pulls its unprofiled dependencies 8 and 9 along, and the
+    // rest keep AddAsset order
+    const std::vector<uint32_t> ExpectedLayout = {5, 0, 8, 9, 6, 4, 2, 1, 3, 7};
+    const std::vector<uint32_t> AllSeeds = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    auto PayloadAddress = [](const AssetPackReader& Reader, const uint32_t Seed) {
+        auto View = Reader.LoadCookedPayloadView(MakeTestId(Seed));
+        REQUIRE(View.has_value());
+        REQUIRE(View->Bytes.IsZeroCopy());
+        return reinterpret_cast<uintptr_t>(View->Bytes.GetData());
+    };
+    auto CheckLayout = [&](const std::filesystem::path& Path, const std::vector<uint32_t>& Expected) {
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(Path.string()).has_value());
+        for (size_t Position = 1; Position < Expected.size(); ++Position)
+        {
+            CHECK(PayloadAddress(Reader, Expected[Position - 1]) < PayloadAddress(Reader, Expected[Position]));
+        }
+        // An asset's bulk chunks follow its payload
+        auto Bulk = Reader.LoadBulkChunkView(MakeTestId(6), 0);
+        REQUIRE(Bulk.has_value());
+        const auto Next = std::ranges::find(Expected, 6u) + 1;
+        CHECK(reinterpret_cast<uintptr_t>(Bulk->GetData()) > PayloadAddress(Reader, 6));
+        CHECK(reinterpret_cast<uintptr_t>(Bulk->GetData()) < PayloadAddress(Reader, *Next));
+    };
+
+    {
+        AssetPackWriter Writer;
+        Writer.SetCompression(EPackCompression::None);
+        Writer.SetAccessOrderProfile(Profile);
+        AddAssets(Writer, AllSeeds);
+        REQUIRE(Writer.Write(ProfiledPath.string()).has_value());
+    }
+    CheckLayout(ProfiledPath, ExpectedLayout);
+
+    AssetPackReadOptions Options;
+    Options.bVerifyChunkHash = true;
+    Options.bValidateChunkIdentity = true;
+    {
+        // The index keeps AddAsset order
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(ProfiledPath.string(), Options).has_value());
+        REQUIRE(Reader.GetAssetCount() == AllSeeds.size());
+        for (uint32_t I = 0; I < Reader.GetAssetCount(); ++I)
+        {
+            CHECK(Reader.GetAssetInfo(I)->Id == MakeTestId(I));
+            CHECK(Reader.LoadCookedPayload(MakeTestId(I)).value().Bytes == std::vector<uint8_t>(100 + I, static_cast<uint8_t>(I)));
+        }
+        CHECK(Reader.GetAssetInfo(0)->AssetDependencies.size() == 2);
+    }
+
+    // Streaming writes follow the profile within each flushed batch
+    {
+        const auto StreamedPath = TempDir / "Streamed.snpak";
+        AssetPackWriter Writer;
+        Writer.SetCompression(EPackCompression::None);
+        Writer.SetAccessOrderProfile(Profile);
+        REQUIRE(Writer.BeginStreamingWrite(StreamedPath.string()).has_value());
+        AddAssets(Writer, AllSeeds);
+        REQUIRE(Writer.Write(StreamedPath.string()).has_value());
+        CheckLayout(StreamedPath, ExpectedLayout);
+    }
+
+    // An existing pack can be laid out again by compacting it with a profile
+    {
+        AssetPackWriter Writer;
+        Writer.SetCompression(EPackCompression::None);
+        AddAssets(Writer, AllSeeds);
+        REQUIRE(Writer.Write(PlainPath.string()).has_value());
+    }
+    CheckLayout(PlainPath, AllSeeds);
+    {
+        AssetPackWriter Compactor;
+        Compactor.SetAccessOrderProfile(Profile);
+        auto Result = Compactor.Compact(PlainPath.string());
+        REQUIRE(Result.has_value());
+        REQUIRE(Result->bCompacted);
+        CheckLayout(PlainPath, ExpectedLayout);
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(PlainPath.string(), Options).has_value());
+        CHECK(Reader.GetAssetInfo(9)->Id == MakeTestId(9));
+    }
+
+    // AppendUpdate places the chunks it adds in profile order too
+    {
+        AssetPackWriter Writer;
+        Writer.SetCompression(EPackCompression::None);
+        Writer.SetAccessOrderProfile({MakeTestId(11), MakeTestId(12), MakeTestId(10)});
+        AddAssets(Writer, {10, 11, 12});
+        REQUIRE(Writer.AppendUpdate(ProfiledPath.string()).has_value());
+        AssetPackReader Reader;
+        REQUIRE(Reader.Open(ProfiledPath.string(), Options).has_value());
+        CHECK(PayloadAddress(Reader, 7) < PayloadAddress(Reader, 11));
+        CHECK(PayloadAddress(Reader, 11) < PayloadAddress(Reader, 12));
+        CHECK(PayloadAddress(Reader, 12) < PayloadAddress(Reader, 10));
+        CHECK(Reader.GetAssetInfo(10)->Id == MakeTestId(10));
+        CHECK(Reader.GetAssetInfo(12)->Id == MakeTestId(12));
+    }
+
+    std::filesystem::remove_all(TempDir);
+}
@@ -1,10 +1,19 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "AssetPipeline.h"
+#include "AssetPackReader.h"
 #include "PayloadRegistry.h"
 #include "TypedPayload.h"
 #include "IPayloadSerializer.h"
-
+#include "IAssetImporter.h"
+#include "IAssetCooker.h"
+#include "IPipelineContext.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <thread>
 #include <vector>
 #include <sstream>
 
@@ -183,9 +192,11 @@ TEST_CASE("PipelineBuildConfig defaults", "[pipeline]")
     REQUIRE(Config.OutputPackPath.empty());
     REQUIRE(Config.bDeterministicAssetIds == true);
     REQUIRE(Config.bEnableAppendUpdates == true);
+    REQUIRE(Config.AutoCompactDeadRatio == 0.0);
     REQUIRE(Config.Compression == EPackCompression::Zstd);
     REQUIRE(Config.CompressionLevel == EPackCompressionLevel::Default);
     REQUIRE(Config.ParallelJobs == 0);
+    REQUIRE(Config.AccessOrderProfile.empty());
     REQUIRE(Config.bVerbose == false);
 }
 
@@ -208,3 +219,232 @@ TEST_CASE("AssetPipelineEngine initialization fails with nonexistent source root
     auto Result = Engine.Initialize(Config);
     REQUIRE_FALSE(Result.has_value());
 }
+
+namespace
+{
+    const TypeId kParallelAssetKind = {0x50, 0x41, 0x52, 0x41, 0x4C, 0x4C, 0x45, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01};
+    const TypeId kParallelIntermediateType = {0x50, 0x41, 0x52, 0x41, 0x4C, 0x4C, 0x45, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02};
+    const TypeId kParallelCookedType = {0x50, 0x41, 0x52, 0x41, 0x4C, 0x4C, 0x45, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03};
+
+    struct ScopedTempDir
+    {
+        std::filesystem::path Path;
+
+        explicit ScopedTempDir(const std::string& Prefix)
+        {
+            Path = std::filesystem::temp_directory_path() /
+                   (Prefix + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+            std::filesystem::create_directories(Path);
+        }
+
+        ~ScopedTempDir()
+        {
+            std::error_code Ec;
+            std::filesystem::remove_all(Path, Ec);
+        }
+    };
+
+    // Importer whose work time varies per source so parallel workers finish out of order
+    class ParallelTestImporter : public IAssetImporter
+    {
+    public:
+        const char* GetName() const override { return "ParallelTestImporter"; }
+        bool CanImport(const SourceRef& Source) const override { return Source.Uri.ends_with(".ptest"); }
+
+        bool Import(const SourceRef& Source, std::vector<ImportedItem>& OutItems, IPipelineContext& Ctx) override
+        {
+            std::vector<uint8_t> Bytes;
+            if (!Ctx.ReadAllBytes(Source.Uri, Bytes))
+            {
+                return false;
+            }
+
+            std::this_thread::sleep_for(std::chrono::microseconds((Bytes.size() * 37) % 500));
+
+            ImportedItem Item;
+            Item.LogicalName = std::filesystem::path(Source.Uri).filename().string();
+            Item.Id = Ctx.MakeDeterministicAssetId(Item.LogicalName, "");
+            Item.AssetKind = kParallelAssetKind;
+            Item.Intermediate = TypedPayload(kParallelIntermediateType, 1, std::move(Bytes));
+            OutItems.push_back(std::move(Item));
+            return true;
+        }
+    };
+
+    class ParallelTestCooker : public IAssetCooker
+    {
+    public:
+        const char* GetName() const override { return "ParallelTestCooker"; }
+
+        bool CanCook(TypeId AssetKind, TypeId IntermediatePayloadType) const override
+        {
+            return AssetKind == kParallelAssetKind && IntermediatePayloadType == kParallelIntermediateType;
+        }
+
+        bool Cook(const CookRequest& Req, CookResult& Out, IPipelineContext&) override
+        {
+            Out.Cooked = TypedPayload(kParallelCookedType, 1, Req.Intermediate.Bytes);
+
+            BulkChunk Chunk(EBulkSemantic::Reserved_Level, 0);
+            Chunk.Bytes.assign(Req.Intermediate.Bytes.rbegin(), Req.Intermediate.Bytes.rend());
+            Out.Bulk.push_back(std::move(Chunk));
+            return true;
+        }
+    };
+
+    std::vector<uint8_t> ReadFileBytes(const std::filesystem::path& Path)
+    {
+        std::ifstream File(Path, std::ios::binary);
+        return std::vector<uint8_t>(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>());
+    }
+
+    BuildResult BuildWithJobs(const std::filesystem::path& SourceRoot, const std::filesystem::path& OutputPack, uint32_t Jobs)
+    {
+        AssetPipelineEngine Engine;
+
+        PipelineBuildConfig Config;
+        Config.SourceRoots = {SourceRoot.string()};
+        Config.OutputPackPath = OutputPack.string();
+        Config.ParallelJobs = Jobs;
+        REQUIRE(Engine.Initialize(Config).has_value());
+
+        Engine.RegisterImporter(std::make_unique<ParallelTestImporter>());
+        Engine.RegisterCooker(std::make_unique<ParallelTestCooker>());
+        return Engine.BuildAll();
+    }
+}
+
+TEST_CASE("Parallel BuildAll produces a pack identical to a serial build", "[pipeline]")
+{
+    ScopedTempDir SourceDir("snapi_parallel_src_");
+    ScopedTempDir OutputDir("snapi_parallel_out_");
+
+    for (int I = 0; I < 64; ++I)
+    {
+        std::ofstream File(SourceDir.Path / ("asset_" + std::to_string(I) + ".ptest"), std::ios::binary);
+        File << std::string(static_cast<size_t>(16 + I * 13), static_cast<char>('a' + I % 26));
+    }
+    // No importer handles this one; its warning must land in the same position either way
+    std::ofstream(SourceDir.Path / "ignored.txt") << "ignored";
+
+    const auto SerialPack = OutputDir.Path / "serial.snpak";
+    const auto ParallelPack = OutputDir.Path / "parallel.snpak";
+
+    BuildResult Serial = BuildWithJobs(SourceDir.Path, SerialPack, 1);
+    BuildResult Parallel = BuildWithJobs(SourceDir.Path, ParallelPack, 8);
+
+    REQUIRE(Serial.AssetsBuilt == 64);
+    REQUIRE(Parallel.AssetsBuilt == Serial.AssetsBuilt);
+    REQUIRE(Parallel.AssetsFailed == Serial.AssetsFailed);
+    REQUIRE(Parallel.Warnings == Serial.Warnings);
+    REQUIRE(Parallel.Errors == Serial.Errors);
+    REQUIRE(ReadFileBytes(ParallelPack) == ReadFileBytes(SerialPack));
+}
+
+TEST_CASE("BuildChanged compacts the pack once enough of it is dead", "[pipeline]")
+{
+    ScopedTempDir SourceDir("snapi_compact_src_");
+    ScopedTempDir OutputDir("snapi_compact_out_");
+    const auto PackPath = OutputDir.Path / "compact.snpak";
+
+    // Incompressible sources so the dead share tracks the number of replaced assets
+    auto WriteSources = [&](const int Count, const uint32_t Round) {
+        std::mt19937 Rng(Round);
+        for (int I = 0; I < Count; ++I)
+        {
+            std::string Bytes(2048, '\0');
+            for (char& Byte : Bytes)
+            {
+                Byte = static_cast<char>(Rng());
+            }
+            std::ofstream(SourceDir.Path / ("asset_" + std::to_string(I) + ".ptest"), std::ios::binary) << Bytes;
+        }
+    };
+
+    WriteSources(16, 0);
+
+    AssetPipelineEngine Engine;
+    PipelineBuildConfig Config;
+    Config.SourceRoots = {SourceDir.Path.string()};
+    Config.OutputPackPath = PackPath.string();
+    Config.AutoCompactDeadRatio = 0.4;
+    REQUIRE(Engine.Initialize(Config).has_value());
+    Engine.RegisterImporter(std::make_unique<ParallelTestImporter>());
+    Engine.RegisterCooker(std::make_unique<ParallelTestCooker>());
+
+    BuildResult Initial = Engine.BuildAll();
+    REQUIRE(Initial.bSuccess);
+    REQUIRE(Initial.CompactedBytes == 0);
+
+    // Each round replaces half of the assets: about a third of the pack is dead after one round,
+    // half after two
+    std::vector<uint64_t> Compacted;
+    for (uint32_t Round = 1; Round <= 3; ++Round)
+    {
+        WriteSources(8, Round);
+        BuildResult Result = Engine.BuildChanged();
+        REQUIRE(Result.bSuccess);
+        REQUIRE(Result.AssetsBuilt == 8);
+        Compacted.push_back(Result.CompactedBytes);
+    }
+    CHECK(Compacted[0] == 0);
+    CHECK(Compacted[1] > 0);
+    CHECK(Compacted[2] == 0);
+
+    AssetPackReader Reader;
+    REQUIRE(Reader.Open(PackPath.string()).has_value());
+    REQUIRE(Reader.GetAssetCount() == 16);
+    for (uint32_t I = 0; I < Reader.GetAssetCount(); ++I)
+    {
+        auto Info = Reader.GetAssetInfo(I);
+        REQUIRE(Info.has_value());
+        const auto Source = ReadFileBytes(SourceDir.Path / Info->Name);
+        CHECK(Reader.LoadCookedPayload(Info->Id).value().Bytes == Source);
+    }
+}
+
+TEST_CASE("Compression policy resolves per asset kind and bulk semantic", "[pipeline]")
+{
+    ScopedTempDir SourceDir("snapi_policy_src_");
+    ScopedTempDir OutputDir("snapi_policy_out_");
+
+    for (int I = 0; I < 8; ++I)
+    {
+        std::ofstream File(SourceDir.Path / ("asset_" + std::to_string(I) + ".ptest"), std::ios::binary);
+        File << std::string(static_cast<size_t>(4096 + I * 512), static_cast<char>('a' + I));
+    }
+
+    AssetPipelineEngine Engine;
+
+    PipelineBuildConfig Config;
+    Config.SourceRoots = {SourceDir.Path.string()};
+    Config.OutputPackPath = (OutputDir.Path / "policy.snpak").string();
+
+    // The kind rule beats the later catch-all; the kind + semantic rule beats both for bulk chunks
+    PackCompressionRule KindRule;
+    KindRule.AssetKind = kParallelAssetKind;
+    KindRule.Compression = EPackCompression::LZ4;
+    PackCompressionRule AnyRule;
+    AnyRule.Compression = EPackCompression::ZstdFast;
+    PackCompressionRule LevelRule;
+    LevelRule.AssetKind = kParallelAssetKind;
+    LevelRule.BulkSemantic = EBulkSemantic::Reserved_Level;
+    LevelRule.Compression = EPackCompression::None;
+    Config.CompressionPolicy = {KindRule, AnyRule, LevelRule};
+    REQUIRE(Engine.Initialize(Config).has_value());
+
+    Engine.RegisterImporter(std::make_unique<ParallelTestImporter>());
+    Engine.RegisterCooker(std::make_unique<ParallelTestCooker>());
+    BuildResult Result = Engine.BuildAll();
+    REQUIRE(Result.AssetsBuilt == 8);
+
+    uint32_t Lz4Chunks = 0;
+    uint32_t RawChunks = 0;
+    for (const PackCodecStats& Stats : Result.CompressionStats)
+    {
+        REQUIRE((Stats.Compression == EPackCompression::LZ4 || Stats.Compression == EPackCompression::None));
+        (Stats.Compression == EPackCompression::LZ4 ? Lz4Chunks : RawChunks) += Stats.ChunkCount;
+    }
+    REQUIRE(Lz4Chunks == 8);
+    REQUIRE(RawChunks == 8);
+}
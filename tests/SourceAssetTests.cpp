@@ -16,7 +16,14 @@
 #include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <mutex>
 #include <optional>
+#include <unordered_map>
+
+#if defined(__linux__)
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
 
 using namespace SnAPI::AssetPipeline;
 
@@ -800,3 +807,190 @@ TEST_CASE("AssetManager pipeline handles multiple source files", "[source][pipel
   REQUIRE(Fixture.CookerPtr->CookCount == 2);
   REQUIRE(Manager->GetDirtyAssetCount() == 2);
 }
+
+TEST_CASE("AssetManager async loads from a cold pack through the read stage", "[source][async]")
+{
+  TempDir PackDir;
+  const auto PackPath = PackDir.Path / "async.snpak";
+
+  // Payloads above the stage's 1 MiB read size so each load is split into several reads, and a
+  // pack large enough that read-ahead while opening it does not pull every asset back in
+  constexpr int kAssetCount = 12;
+  {
+    AssetPackWriter Writer;
+    Writer.SetCompression(EPackCompression::None);
+    for (int I = 0; I < kAssetCount; ++I)
+    {
+      std::vector<uint8_t> Bytes(static_cast<size_t>(2048 * 1024 + I));
+      for (size_t B = 0; B < Bytes.size(); ++B)
+      {
+        Bytes[B] = static_cast<uint8_t>(B * 7 + I);
+      }
+      AssetPackEntry Entry{};
+      Entry.Id = Uuid::Generate();
+      Entry.AssetKind = kTestAssetKind;
+      Entry.Name = "Async" + std::to_string(I);
+      Entry.Cooked = TypedPayload(kTestCookedType, 1, std::move(Bytes));
+      Writer.AddAsset(std::move(Entry));
+    }
+    REQUIRE(Writer.Write(PackPath.string()).has_value());
+  }
+
+#if defined(__linux__)
+  // Drop the freshly written pages so the loads actually have to go to disk
+  {
+    const int Fd = open(PackPath.c_str(), O_RDONLY);
+    REQUIRE(Fd >= 0);
+    fsync(Fd);
+    posix_fadvise(Fd, 0, 0, POSIX_FADV_DONTNEED);
+    close(Fd);
+  }
+#endif
+
+  for (const uint32_t QueueDepth : {4u, 0u})
+  {
+    AssetManagerConfig Config;
+    Config.AsyncLoaderThreads = 2;
+    Config.AsyncLoaderIoQueueDepth = QueueDepth;
+    AssetManager Manager(Config);
+    Manager.RegisterSerializer(std::make_unique<MockBytesPayloadSerializer>(kTestCookedType, "MockCookedPayload"));
+    Manager.RegisterFactory<TestRuntimeObject>(std::make_unique<MockFactory>());
+    REQUIRE(Manager.MountPack(PackPath.string()).has_value());
+    if (QueueDepth == 0)
+    {
+      CHECK_FALSE(Manager.GetAsyncLoader().IsUsingIoUring());
+    }
+
+    std::mutex ResultsMutex;
+    std::vector<std::string> Errors;
+    std::vector<uint32_t> Lengths(kAssetCount, 0);
+    for (int I = 0; I < kAssetCount; ++I)
+    {
+      Manager.LoadAsync<TestRuntimeObject>("Async" + std::to_string(I), ELoadPriority::Normal, {},
+                                           [&, I](AsyncLoadResult<TestRuntimeObject> Result) {
+                                             std::lock_guard Lock(ResultsMutex);
+                                             if (!Result.IsSuccess())
+                                             {
+                                               Errors.push_back(Result.Error);
+                                               return;
+                                             }
+                                             Lengths[I] = Result.Asset->ProcessedLength;
+                                           });
+    }
+    Manager.GetAsyncLoader().WaitAll();
+
+    CHECK(Manager.GetAsyncLoader().GetPendingCount() == 0u);
+    CHECK(Errors.empty());
+    for (int I = 0; I < kAssetCount; ++I)
+    {
+      CHECK(Lengths[I] == 2048u * 1024u + static_cast<uint32_t>(I));
+    }
+  }
+}
+
+TEST_CASE("AssetManager resolves assets across mounted packs by priority", "[source][pack]")
+{
+  TempDir PackDir;
+  const AssetId Rock = Uuid::Generate();
+  const AssetId Tree = Uuid::Generate();
+  const AssetId DlcRock = Uuid::Generate();
+  const AssetId Bush = Uuid::Generate();
+
+  struct TestAsset
+  {
+      AssetId Id;
+      std::string Name;
+      uint8_t Value;
+  };
+  auto WritePack = [&](const std::string& FileName, const std::vector<TestAsset>& Assets) {
+    AssetPackWriter Writer;
+    for (const TestAsset& Asset : Assets)
+    {
+      AssetPackEntry Entry{};
+      Entry.Id = Asset.Id;
+      Entry.AssetKind = kTestAssetKind;
+      Entry.Name = Asset.Name;
+      Entry.Cooked = TypedPayload(kTestCookedType, 1, std::vector<uint8_t>{Asset.Value});
+      Writer.AddAsset(std::move(Entry));
+    }
+    const auto Path = PackDir.Path / FileName;
+    REQUIRE(Writer.Write(Path.string()).has_value());
+    return Path.string();
+  };
+
+  const std::string BasePack = WritePack("base.snpak", {{Rock, "Textures/Rock", 1}, {Tree, "Meshes/Tree", 2}});
+  const std::string PatchPack = WritePack("patch.snpak", {{Rock, "Textures/Rock", 3}});
+  const std::string DlcPack = WritePack("dlc.snpak", {{DlcRock, "Textures/Rock", 4}, {Tree, "Meshes/Tree", 5}});
+  const std::string TiePack = WritePack("tie.snpak", {{Tree, "Meshes/Tree", 6}});
+
+  AssetManagerConfig Config;
+  Config.bEnableHotReload = true;
+  AssetManager Manager(Config);
+  Manager.RegisterSerializer(std::make_unique<MockBytesPayloadSerializer>(kTestCookedType, "MockCookedPayload"));
+
+  PackMountOptions PatchOptions;
+  PatchOptions.Priority = 10;
+  PackMountOptions DlcOptions;
+  DlcOptions.MountPoint = "DLC/";
+  REQUIRE(Manager.MountPack(PatchPack, PatchOptions).has_value());
+  REQUIRE(Manager.MountPack(BasePack).has_value());
+  REQUIRE(Manager.MountPack(DlcPack, DlcOptions).has_value());
+  REQUIRE(Manager.MountPack(TiePack).has_value());
+
+  auto ValueOf = [&](const auto& Key) -> int {
+    auto Payload = Manager.LoadCookedPayload(Key);
+    return Payload.has_value() && Payload->Bytes.size() == 1 ? Payload->Bytes[0] : -1;
+  };
+
+  // Higher priority wins; equal priorities resolve to the pack mounted first
+  CHECK(ValueOf(Rock) == 3);
+  CHECK(ValueOf(Tree) == 2);
+  CHECK(ValueOf(DlcRock) == 4);
+  CHECK(Manager.FindAsset("Textures/Rock")->Id == Rock);
+  CHECK(ValueOf("Textures/Rock") == 3);
+  CHECK(Manager.FindAsset("DLC/Textures/Rock")->Id == DlcRock);
+  CHECK(ValueOf("DLC/Meshes/Tree") == 5);
+  CHECK(ValueOf("Meshes/Tree") == 2);
+  CHECK_FALSE(Manager.FindAsset(Uuid::Generate()).has_value());
+  CHECK_FALSE(Manager.FindAsset("DLC/Missing").has_value());
+  CHECK(Manager.GetPackReadPlan("DLC/Textures/Rock").PackPath == DlcPack);
+
+  // Enumeration lists each asset once, from the pack lookups resolve it to
+  std::unordered_map<AssetId, std::string, UuidHash> Owners;
+  Manager.ForEachPackAsset([&](const AssetInfoView& Info, const std::string& PackPath) {
+    CHECK(Owners.emplace(Info.Id, PackPath).second);
+  });
+  CHECK(Owners == std::unordered_map<AssetId, std::string, UuidHash>{{Rock, PatchPack}, {Tree, BasePack}, {DlcRock, DlcPack}});
+  const auto Catalog = Manager.ListAssetCatalog();
+  REQUIRE(Catalog.size() == Owners.size());
+  for (const AssetCatalogEntry& Entry : Catalog)
+  {
+    CHECK(Entry.OwningPackPath == Owners.at(Entry.Info.Id));
+  }
+  CHECK(Manager.ListAssets().size() == Owners.size());
+
+  // A reloaded pack is indexed again
+  WritePack("patch.snpak", {{Rock, "Textures/Rock", 7}, {Bush, "Plants/Bush", 8}});
+  std::filesystem::last_write_time(PatchPack, std::filesystem::last_write_time(PatchPack) + std::chrono::seconds(2));
+  CHECK(Manager.CheckForChanges() == std::vector<std::string>{PatchPack});
+  CHECK(ValueOf(Rock) == 7);
+  CHECK(ValueOf("Plants/Bush") == 8);
+
+  // Unmounting hands assets to the next pack in line
+  Manager.UnmountPack(PatchPack);
+  CHECK(ValueOf(Rock) == 1);
+  CHECK(ValueOf("Textures/Rock") == 1);
+  CHECK_FALSE(Manager.FindAsset(Bush).has_value());
+  CHECK_FALSE(Manager.FindAsset("Plants/Bush").has_value());
+
+  Manager.UnmountPack(BasePack);
+  CHECK(ValueOf(Tree) == 5);
+  CHECK(ValueOf("Meshes/Tree") == 6);
+  CHECK_FALSE(Manager.FindAsset(Rock).has_value());
+  CHECK_FALSE(Manager.FindAsset("Textures/Rock").has_value());
+  CHECK(ValueOf("DLC/Textures/Rock") == 4);
+
+  Manager.UnmountAll();
+  CHECK_FALSE(Manager.FindAsset(Tree).has_value());
+  CHECK_FALSE(Manager.FindAsset("DLC/Textures/Rock").has_value());
+}